@@ -1,71 +1,74 @@
-#include "vex.h"
-#include <stdbool.h>
-#include <unistd.h>
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     loader.cpp                                                  */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    loader.cpp
+  * @brief   Waits for a code module on the SD card, loads it and runs it
+*//*---------------------------------------------------------------------------*/
+//
+// The payload is an ARM shared object, see vex_module.h for how to build
+// one.  Its main() is called with no arguments once it is loaded.  The
+// program exports what a payload built with -nostdlib is most likely to
+// need, anything in the firmware jumptable is bound without help.
+//
+
 #include <string.h>
-#include <dlfcn.h>
-#include <stdlib.h>
+#include "v5_cpp.h"
+#include "vex_module.h"
 
-#define NAME "vexec.so";
-#define BRAIN vex::brain;
-#define SDCARD vex::brain::sdcard;
+#define PAYLOAD         "payload.so"
+#define POLL_TIME       200               // mS
 
-typedef int (*libMain)(int, char**);
-typedef int (*libEntrypoint)(libMain, int, char**, void (*)(void));
+vex::brain  Brain;
 
-public bool doLoad;
+static const vex::module::symbol exports[] = {
+    { "memcpy",         (void *)memcpy        },
+    { "memmove",        (void *)memmove       },
+    { "memset",         (void *)memset        },
+    { "memcmp",         (void *)memcmp        },
+    { "strlen",         (void *)strlen        },
+    { "strcmp",         (void *)strcmp        },
+    { "vex_printf",     (void *)vex_printf    },
+    { "vex_sprintf",    (void *)vex_sprintf   },
+    { "vex_snprintf",   (void *)vex_snprintf  },
+};
 
-int main(void)
-{
-    while (true)
-    {
-        // This may all be broken and not work, 
-        // it's sketchy because we don't have access to the file system
-        // May be far easier if we have firmware access,
-        // also, dlopen may work regardless, but I doubt so
-        if (SDCARD.isInserted && SDCARD.exists(NAME)
-        {
-            // Prevent constantly reloading the same file
-            doLoad = false;
-            uint8_t[] buffer = new uint8_t[SDCard.size(NAME)]
+static const char *
+reason( vex::module::statusType status ) {
+    switch( status ) {
+      case vex::module::statusType::fileError:      return( "could not be read" );
+      case vex::module::statusType::badFormat:      return( "is not an ARM shared object" );
+      case vex::module::statusType::noMemory:       return( "does not fit in memory" );
+      case vex::module::statusType::badRelocation:  return( "has an unsupported relocation" );
+      case vex::module::statusType::unresolved:     return( "imports an unknown symbol" );
+      default:                                      return( "was not loaded" );
+    }
+}
 
-            SDCARD.loadfile(NAME, buffer, sizeof(buffer));
-            // Make buffer RWX so it's executable memory (unnecessary?)
-            if (mprotect(buffer, sizeof(buffer), PROT_READ | PROT_WRITE | PROT_EXEC) == -1)
-                BRAIN.print("Failed to make file buffer RWX!");
+int
+main() {
+    vex::module payload;
 
-            dlerror(); 
-            // Load buffer so we can get the symbols
-            void* lib = dlopen(buffer, RTLD_NOW);
-            char* error = dlerror();
-            if (error != NULL)
-            {
-                BRAIN.print(error);
-                break;
-            }
+    while( !Brain.SDcard.isInserted() || !Brain.SDcard.exists( PAYLOAD ) ) {
+      Brain.Screen.printAt( 10, 20, true, "Awaiting %s...", PAYLOAD );
+      vex::task::sleep( POLL_TIME );
+    }
 
-            // Get entrypoint (and load globals)
-            libMain pEntry = dlsym(lib, "main");
-            libEntrypoint pMain = dlsym(lib, "__libc_start_main");
-            dl_error = dlerror();
-            if (error != NULL)
-            {
-                BRAIN.print(error);
-                break;
-            }
-                
-            BRAIN.print("Loaded payload!");
-            int argc = 1;
-            char* argv[1] = {""};
-            pEntry(pMain, argc, argv, NULL);  
-        }
-        else
-        {
-            doLoad = true;
-            char* msg;
-            asprintf(&msg, "Awaiting %s...", name);
-            BRAIN.print(msg);
-        }
+    if( !payload.load( PAYLOAD, exports, sizeof(exports) / sizeof(exports[0]) ) ) {
+      Brain.Screen.printAt( 10, 20, true, "%s %s %s", PAYLOAD, reason( payload.status() ), payload.missing() );
+      return( 1 );
+    }
 
-        sleep(0.2);
+    int (*entry)( void ) = payload.get<int (*)( void )>( "main" );
+    if( entry == NULL ) {
+      Brain.Screen.printAt( 10, 20, true, "%s has no main", PAYLOAD );
+      return( 1 );
     }
-}
\ No newline at end of file
+
+    Brain.Screen.printAt( 10, 20, true, "Loaded %s, %lu bytes at %p", PAYLOAD, (unsigned long)payload.size(), payload.base() );
+    return( entry() );
+}
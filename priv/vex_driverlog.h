@@ -0,0 +1,157 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_driverlog.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_DRIVERLOG_CLASS_H
+#define   VEX_DRIVERLOG_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_driverlog.h
+  * @brief   Recording and playback of driver controller input
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  class task;
+
+  /**
+    * @brief Use the driverlog class to record a driver on the SD card and play the run back as an autonomous.
+    * @details
+    *  record() starts a task that samples every V5_ControllerIndex channel
+    *  and the connection status of both controllers every 10 mS.  A
+    *  frame stores only the channels that changed since the last frame.
+    *  A change of one or two counts costs a single byte.  Frames with no
+    *  change are run length encoded, up to 128 in a byte, so a robot that
+    *  sits still costs almost nothing.  A match of driving is tens of KB
+    *  and even an hour of all four sticks moving is under 5 MB.
+    *
+    *  Frames go into one of two RAM buffers and a low priority task writes
+    *  full buffers to the SD card.  The drive loop never waits for the card.
+    *  If the card falls behind, the frame is counted in dropped() and the
+    *  previous input is kept for it.
+    *
+    *  play() swaps the jumptable slots of vexControllerGet and
+    *  vexControllerConnectionStatusGet through vex::interpose::exchange(),
+    *  so a wrapper installed on either keeps timing the playback.  A task
+    *  steps through the frames at the recorded rate, so
+    *  controller::axis::position(), button::pressing() and anything else
+    *  that reads the controller see the recording.  Callbacks such as
+    *  button::pressed() fire only if their change detection also goes
+    *  through vexControllerGet.
+    *
+    *  Do not use this at the same time as vex::replay, both take the
+    *  vexControllerGet slot.
+  */
+  class driverlog  {
+    public:
+      static const uint32_t MAGIC       = 0x4C565244;   // 'DRVL'
+      static const uint32_t VERSION     = 1;
+      static const int32_t  CHANNELS    = BatteryCapacity + 2;  // every V5_ControllerIndex and the connection status
+      static const int32_t  CONTROLLERS = 2;
+      static const int32_t  VALUES      = CHANNELS * CONTROLLERS;
+      static const uint32_t PERIOD      = 10;           // mS
+
+      typedef struct _header {
+        uint32_t    magic;
+        uint32_t    version;
+        uint32_t    values;                             // values per frame, CHANNELS for each controller
+        uint32_t    period;                             // mS between frames
+        uint32_t    time;                               // vexSystemTimeGet when recording started
+      } header;
+
+      enum class modeType {
+        idle,
+        recording,
+        playing
+      };
+
+    private:
+      static const int32_t  BUFFER_SIZE = 8192;
+      static const int32_t  MAX_FRAME   = 1 + VALUES * 7;
+      static const int32_t  MAX_RUN     = 128;
+      static const int32_t  ESCAPE      = 63;           // channel field of an entry with a varint delta
+
+      static volatile modeType _mode;
+      static int32_t    _values[VALUES];              // last frame written, or the frame being played
+      static uint8_t    _buffer[2][BUFFER_SIZE];
+      static int32_t    _current;
+      static int32_t    _length;                      // bytes in the current buffer
+      static int32_t    _position;                    // read position while playing
+      static volatile int32_t _pending[2];          // bytes waiting to be written
+      static int32_t    _run;                         // unchanged frames not yet written, or still to play
+      static uint32_t   _frames;
+      static uint32_t   _dropped;
+      static volatile bool _stopping;
+      static volatile bool _sampling;
+      static volatile bool _writing;
+      static void      *_savedGet;
+      static void      *_savedStatus;
+      static vex::task *_task;
+      static vex::task *_writer;
+      static FIL       *_file;
+
+      static void       _reset();
+      static void       _release();
+      static bool       _room( int32_t bytes );
+      static void       _putRun();
+      static void       _encode( int32_t channel, int32_t delta );
+      static void       _flush( int32_t index );
+      static void       _record();
+      static bool       _refill();
+      static int32_t    _next();
+      static bool       _play();
+
+      static int        _sampleTask( void *arg );
+      static int        _writeTask( void *arg );
+      static int        _playTask( void *arg );
+
+      static int32_t    _playGet( V5_ControllerId id, V5_ControllerIndex index );
+      static V5_ControllerStatus _playStatus( V5_ControllerId id );
+
+      static inline void _put( uint8_t b ) {
+        _buffer[_current][_length++] = b;
+      }
+
+    public:
+      /**
+       * @brief Starts recording both controllers to a file.
+       * @return Returns false if a recording or playback is running or the file could not be created.
+       * @param name The name of the file on the SD card.
+       */
+      static bool     record( const char *name );
+
+      /**
+       * @brief Starts playing a recording back through the controller functions.
+       * @return Returns false if a recording or playback is running or the file is not a recording.
+       * @param name The name of the file on the SD card.
+       */
+      static bool     play( const char *name );
+
+      /**
+       * @brief Stops recording or playback, a recording is written out and closed.
+       */
+      static void     stop();
+
+      /**
+       * @brief Gets the current mode, playback returns to idle by itself at the end of the recording.
+       * @return Returns idle, recording or playing.
+       */
+      static modeType mode();
+
+      /**
+       * @brief Gets the number of frames recorded or played so far.
+       * @return Returns the frame count, one per 10 mS.
+       */
+      static uint32_t frames();
+
+      /**
+       * @brief Gets the number of frames that were not written because the SD card fell behind.
+       * @return Returns the count.
+       */
+      static uint32_t dropped();
+  };
+};
+
+#endif // VEX_DRIVERLOG_CLASS_H
@@ -0,0 +1,114 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_firmware.h                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_FIRMWARE_CLASS_H
+#define   VEX_FIRMWARE_CLASS_H
+
+#include "vex_firmware_offsets.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_firmware.h
+  * @brief   Version aware dispatch of private firmware functions
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the firmware class to call private functions on any supported VEXos version.
+    * @details
+    *  libv5rt reaches the firmware through fixed jumptable offsets, which is
+    *  only safe for the public API.  Private functions can move between
+    *  builds, so their offsets are kept per version in
+    *  vex_firmware_offsets.h.  Before any user global is constructed the
+    *  table for the running firmware is chosen from vexSystemVersion() and
+    *  every private function is resolved into a flat array of pointers.  A
+    *  call is then one load and an indirect branch, the same as the
+    *  libv5rt thunks.
+    *
+    *     typedef void (* yield_t)( void );
+    *     if( vex::firmware::supported() )
+    *       VEX_FIRMWARE( vexTaskYield, yield_t )();
+    *
+    *  Pointers are read from the jumptable when the table is selected,
+    *  functions wrapped later with vex::interpose are not seen here.
+  */
+  class firmware  {
+    public:
+      #define VEX_FIRMWARE_ENUM( fn )   fn,
+      enum class function : uint16_t {
+        VEX_FIRMWARE_FUNCTIONS( VEX_FIRMWARE_ENUM )
+        count
+      };
+      #undef  VEX_FIRMWARE_ENUM
+
+      typedef struct _offset {
+        uint16_t    function;
+        uint16_t    offset;
+      } offset;
+
+      typedef struct _build {
+        uint32_t        version;                  // as returned by vexSystemVersion
+        const offset   *offsets;
+        uint32_t        count;
+      } build;
+
+    private:
+      static const uint32_t TABLE_SIZE = 0x1000;
+      static const int32_t  COUNT      = (int32_t)function::count;
+
+      static void      *_functions[COUNT];
+      static uint32_t   _version;
+      static const build *_build;
+
+    public:
+      /**
+       * @brief Selects the offset table for a firmware version and resolves every function. Called automatically at startup.
+       * @return Returns true if a table was found for the version.
+       * @param version The version in vexSystemVersion() format, 0 to read it from the firmware.
+       */
+      static bool     select( uint32_t version = 0 );
+
+      /**
+       * @brief Checks if the running firmware is in the database.
+       * @return Returns true if private functions can be called.
+       */
+      static bool     supported();
+
+      /**
+       * @brief Gets the firmware version that was used to select the table.
+       * @return Returns the version as major, minor, build and beta bytes.
+       */
+      static uint32_t version();
+
+      /**
+       * @brief Checks if a function exists in the running firmware.
+       * @return Returns true if the function can be called.
+       * @param f The function.
+       */
+      static bool     available( function f );
+
+      /**
+       * @brief Gets a function as a typed pointer, use the VEX_FIRMWARE macro rather than calling this directly.
+       * @return Returns the function or NULL if the running firmware does not have it.
+       * @param f The function.
+       */
+      template <typename F>
+      static inline F get( function f ) {
+        return( (F)_functions[ (int32_t)f ] );
+      }
+
+      /**
+       * @brief Gets the table of every known firmware build.
+       * @return Returns a pointer to the first build.
+       * @param count Set to the number of builds.
+       */
+      static const build *builds( int32_t &count );
+  };
+};
+
+#define VEX_FIRMWARE( fn, type )    vex::firmware::get<type>( vex::firmware::function::fn )
+
+#endif // VEX_FIRMWARE_CLASS_H
@@ -0,0 +1,382 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_firmware_offsets.h                                      */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_FIRMWARE_OFFSETS_H
+#define   VEX_FIRMWARE_OFFSETS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_firmware_offsets.h
+  * @brief   Jumptable offsets of private functions by firmware version
+*//*---------------------------------------------------------------------------*/
+
+//
+// Every private function known in any version, the order is the index
+// into the dispatch table.  Add new functions at the end.
+//
+#define VEX_FIRMWARE_FUNCTIONS( X ) \
+  X( vexStdlibMismatchError ) \
+  X( vexPrivateApiDisable ) \
+  X( vexPrivateApiEnable ) \
+  X( vexTaskAdd ) \
+  X( vexTaskAddWithPriority ) \
+  X( vexTaskAddSimple ) \
+  X( vexTaskAddSimpleWithPriority ) \
+  X( vexTaskStop ) \
+  X( vexTaskSuspend ) \
+  X( vexTaskResume ) \
+  X( vexTaskSuspendCurrent ) \
+  X( vexTaskResumeCurrent ) \
+  X( vexTaskProgramSuspend ) \
+  X( vexTaskProgramResume ) \
+  X( vexTaskPriorityGet ) \
+  X( vexTaskPrioritySet ) \
+  X( vexTasksRun ) \
+  X( vexTaskYield ) \
+  X( vexTaskCheckTimeslice ) \
+  X( vexTaskGetIndex ) \
+  X( vexTaskSleep ) \
+  X( vexSemaphoreInit ) \
+  X( vexSemaphoreLock ) \
+  X( vexSemaphoreUnlock ) \
+  X( vexSemaphoreGetOwner ) \
+  X( vexTasksDump ) \
+  X( vexTaskGetCallbackAndId ) \
+  X( vexTaskGetCallback ) \
+  X( vexTaskWaitForExitWithId ) \
+  X( vexTaskWaitForExit ) \
+  X( vexTaskStateGet ) \
+  X( vexTaskGetTaskIndex ) \
+  X( vexTaskStopAll ) \
+  X( vexTaskStopAllUser ) \
+  X( vexTaskRemoveAllUser ) \
+  X( vexEventBroadcastAndWait ) \
+  X( vexEventBroadcast ) \
+  X( vexEventAdd ) \
+  X( vexEventUserIndexGet ) \
+  X( vexEventAddWithArg ) \
+  X( vexEventsCleanup ) \
+  X( vexEventsDump ) \
+  X( vexEventGetArg ) \
+  X( vexEventsGetMax ) \
+  X( vexEventsGetCount ) \
+  X( vexBreak ) \
+  X( vexTaskBreakpointSet ) \
+  X( vexTaskBreakpointDump ) \
+  X( vexTaskHardwareConcurrency ) \
+  X( vexTaskCompletionIdSet ) \
+  X( vexTaskStackSizeGet ) \
+  X( vexTaskStackDefaultSizeGet ) \
+  X( vexTaskStackUseGet ) \
+  X( vexTaskStackTopGet ) \
+  X( vexTaskFree ) \
+  X( vexTaskGetArgs ) \
+  X( vexTaskSetArgs ) \
+  X( vexSystemTimerGet ) \
+  X( vexSystemTimerEnable ) \
+  X( vexSystemTimerDisable ) \
+  X( vexDeviceTypeGetByIndex ) \
+  X( vexDeviceTypeSetByIndex ) \
+  X( vexDeviceValueGetByIndex ) \
+  X( vexDeviceValueSetByIndex ) \
+  X( vexDeviceDatarateSet ) \
+  X( vexDeviceTimerSet ) \
+  X( vexDeviceTimerSetWithArg ) \
+  X( vexDeviceTimerDump ) \
+  X( vexDeviceFlagsGetByIndex ) \
+  X( vexDeviceAdiVoltageGet ) \
+  X( vexDeviceImuTemperatureGet ) \
+  X( vexDeviceImuDebugGet ) \
+  X( vexDeviceImuCollisionDataGet ) \
+  X( vexDeviceRadioUserDataReceive ) \
+  X( vexDeviceRadioModeSet ) \
+  X( vexDeviceAbsEncTemperatureGet ) \
+  X( vexDeviceAbsEncDebugGet ) \
+  X( vexDeviceAbsEncModeSet ) \
+  X( vexDeviceAbsEncModeGet ) \
+  X( vexDeviceAbsEncOffsetSet ) \
+  X( vexDeviceAbsEncOffsetGet ) \
+  X( vexDeviceDistanceDebugGet ) \
+  X( vexDeviceDistanceModeSet ) \
+  X( vexDeviceDistanceModeGet ) \
+  X( vexDeviceOpticalDebugGet ) \
+  X( vexDeviceOpticalGainSet ) \
+  X( vexDeviceOpticalMatrixSet ) \
+  X( vexDeviceOpticalMatrixGet ) \
+  X( vexDeviceMagnetDebugGet ) \
+  X( vexDeviceMagnetModeSet ) \
+  X( vexDeviceMagnetModeGet ) \
+  X( vexDeviceGpsTemperatureGet ) \
+  X( vexDeviceGpsDebugGet ) \
+  X( vexDeviceGpsTestDataSet ) \
+  X( vexDisplayTextSmoothing ) \
+  X( vexDisplayTextReference ) \
+  X( vexDisplayScreenGrab ) \
+  X( vexDisplayTextSpacing ) \
+  X( vexDisplayPenSizeSet ) \
+  X( vexDisplayPenSizeGet ) \
+  X( vexDisplayFontCustomSet ) \
+  X( vexDisplayOrientation ) \
+  X( vexDisplayLanguageSet ) \
+  X( vexDisplayStringGet ) \
+  X( vexDisplayClearVsyncState ) \
+  X( vexDisplayGetVsyncState ) \
+  X( vexDisplayRotateFlagGet ) \
+  X( vexDisplayThemeIdGet ) \
+  X( vexDisplayClipRegionSetWithIndex ) \
+  X( vexSystemFileReopen ) \
+  X( vexSerialEnableRemoteConsole ) \
+  X( vexSystemTimerCallbackInstall ) \
+  X( vexSystemVSyncCallbackInstall ) \
+  X( vexSystemIRQInterrupt ) \
+  X( vexAssetsFind ) \
+  X( vexAssetsDump ) \
+  X( vexSystemPdataSet ) \
+  X( vexSystemPdataGet ) \
+  X( vexSystemPdataIdGet ) \
+  X( vexSystemPdataFlagsGet ) \
+  X( vexSystemAppDataOptionsGet ) \
+  X( vexSystemAppDataLinkAddrGet ) \
+  X( vexSystemAppDataRes1Get ) \
+  X( vexSystemAppExtendedDataGet ) \
+  X( vexSystemAppDebugDataGet ) \
+  X( vexBatteryDataGet ) \
+  X( vexBatteryDataSet ) \
+  X( vexDeviceEventMaskSet ) \
+  X( vexDeviceEventMaskGet ) \
+  X( vexDeviceEventDataSet ) \
+  X( vexDeviceEventDataGet ) \
+  X( vexDeviceEventBitsSet ) \
+  X( vexDeviceEventBitsGet ) \
+  X( vexDeviceGenericSerialDisableAll ) \
+  X( vexDeviceGenericSerialCdcRead ) \
+  X( vexDeviceGenericRadioConnection ) \
+  X( vexDeviceGenericRadioWriteChar ) \
+  X( vexDeviceGenericRadioWriteFree ) \
+  X( vexDeviceGenericRadioTransmit ) \
+  X( vexDeviceGenericRadioReadChar ) \
+  X( vexDeviceGenericRadioPeekChar ) \
+  X( vexDeviceGenericRadioReceiveAvail ) \
+  X( vexDeviceGenericRadioReceive ) \
+  X( vexDeviceGenericRadioFlush ) \
+  X( vexDeviceGenericRadioLinkStatus ) \
+  X( vexDeviceGenericRadioDebugGet ) \
+  X( vexDeviceGenericCdcEnable ) \
+  X( vexDeviceGenericCdcConnection ) \
+  X( vexDeviceGenericCdcWriteChar ) \
+  X( vexDeviceGenericCdcWriteFree ) \
+  X( vexDeviceGenericCdcTransmit ) \
+  X( vexDeviceGenericCdcReadChar ) \
+  X( vexDeviceGenericCdcPeekChar ) \
+  X( vexDeviceGenericCdcReceiveAvail ) \
+  X( vexDeviceGenericCdcReceive ) \
+  X( vexDeviceGenericCdcFlush ) \
+  X( vexDeviceGenericCdcLinkStatus ) \
+  X( vexDeviceGenericCdcDebugGet ) \
+  X( vexGzipInflateBuffer ) \
+  X( vexGzipInflateBufferRaw ) \
+  X( vexCdc2Command ) \
+  X( vexCdc2ReplyWithoutPacket ) \
+  X( vexCdc2SendSimpleMessage ) \
+  X( vexCdc2SendExtMessage ) \
+  X( vexTaskAddWithArg ) \
+  X( vexTaskAddWithPriorityWithArg ) \
+  X( vexTaskStopWithId ) \
+  X( vexTaskSuspendWithId ) \
+  X( vexTaskResumeWithId ) \
+  X( vexTaskPriorityGetWithId ) \
+  X( vexTaskPrioritySetWithId ) \
+  X( vexTaskStateGetWithId ) \
+  X( vexTaskGetTaskIndexWithId ) \
+  X( vexTaskGet ) \
+  X( vexSystemErrorMessageSet ) \
+  X( vexSystemFwUpdateRequest ) \
+  X( vexIntegrityCheck )
+
+//
+// VEXos 1.1.2.0, from firmware_offsets.txt.  Functions that share an
+// offset are aliases in the firmware.
+//
+#define VEX_FIRMWARE_V1_1_2_0( X ) \
+  X( vexStdlibMismatchError,            0x010 ) \
+  X( vexPrivateApiDisable,              0x020 ) \
+  X( vexPrivateApiEnable,               0x024 ) \
+  X( vexTaskAdd,                        0x028 ) \
+  X( vexTaskAddWithPriority,            0x02c ) \
+  X( vexTaskAddSimple,                  0x030 ) \
+  X( vexTaskAddSimpleWithPriority,      0x034 ) \
+  X( vexTaskStop,                       0x038 ) \
+  X( vexTaskSuspend,                    0x03c ) \
+  X( vexTaskResume,                     0x040 ) \
+  X( vexTaskSuspendCurrent,             0x044 ) \
+  X( vexTaskResumeCurrent,              0x048 ) \
+  X( vexTaskProgramSuspend,             0x04c ) \
+  X( vexTaskProgramResume,              0x050 ) \
+  X( vexTaskPriorityGet,                0x054 ) \
+  X( vexTaskPrioritySet,                0x058 ) \
+  X( vexTasksRun,                       0x05c ) \
+  X( vexTaskYield,                      0x060 ) \
+  X( vexTaskCheckTimeslice,             0x064 ) \
+  X( vexTaskGetIndex,                   0x068 ) \
+  X( vexTaskSleep,                      0x06c ) \
+  X( vexSemaphoreInit,                  0x070 ) \
+  X( vexSemaphoreLock,                  0x074 ) \
+  X( vexSemaphoreUnlock,                0x078 ) \
+  X( vexSemaphoreGetOwner,              0x07c ) \
+  X( vexTasksDump,                      0x080 ) \
+  X( vexTaskGetCallbackAndId,           0x084 ) \
+  X( vexTaskGetCallback,                0x084 ) \
+  X( vexTaskWaitForExitWithId,          0x088 ) \
+  X( vexTaskWaitForExit,                0x088 ) \
+  X( vexTaskStateGet,                   0x08c ) \
+  X( vexTaskGetTaskIndex,               0x090 ) \
+  X( vexTaskStopAll,                    0x094 ) \
+  X( vexTaskStopAllUser,                0x098 ) \
+  X( vexTaskRemoveAllUser,              0x09c ) \
+  X( vexEventBroadcastAndWait,          0x0a0 ) \
+  X( vexEventBroadcast,                 0x0a4 ) \
+  X( vexEventAdd,                       0x0a8 ) \
+  X( vexEventUserIndexGet,              0x0ac ) \
+  X( vexEventAddWithArg,                0x0b0 ) \
+  X( vexEventsCleanup,                  0x0b4 ) \
+  X( vexEventsDump,                     0x0b8 ) \
+  X( vexEventGetArg,                    0x0bc ) \
+  X( vexEventsGetMax,                   0x0c0 ) \
+  X( vexEventsGetCount,                 0x0c4 ) \
+  X( vexBreak,                          0x0c8 ) \
+  X( vexTaskBreakpointSet,              0x0cc ) \
+  X( vexTaskBreakpointDump,             0x0d0 ) \
+  X( vexTaskHardwareConcurrency,        0x140 ) \
+  X( vexTaskCompletionIdSet,            0x144 ) \
+  X( vexTaskStackSizeGet,               0x148 ) \
+  X( vexTaskStackDefaultSizeGet,        0x14c ) \
+  X( vexTaskStackUseGet,                0x150 ) \
+  X( vexTaskStackTopGet,                0x154 ) \
+  X( vexTaskFree,                       0x158 ) \
+  X( vexTaskGetArgs,                    0x15c ) \
+  X( vexTaskSetArgs,                    0x160 ) \
+  X( vexSystemTimerGet,                 0x168 ) \
+  X( vexSystemTimerEnable,              0x16c ) \
+  X( vexSystemTimerDisable,             0x170 ) \
+  X( vexDeviceTypeGetByIndex,           0x1b8 ) \
+  X( vexDeviceTypeSetByIndex,           0x1bc ) \
+  X( vexDeviceValueGetByIndex,          0x1c0 ) \
+  X( vexDeviceValueSetByIndex,          0x1c4 ) \
+  X( vexDeviceDatarateSet,              0x1c8 ) \
+  X( vexDeviceTimerSet,                 0x1cc ) \
+  X( vexDeviceTimerSetWithArg,          0x1d0 ) \
+  X( vexDeviceTimerDump,                0x1d4 ) \
+  X( vexDeviceFlagsGetByIndex,          0x1d8 ) \
+  X( vexDeviceAdiVoltageGet,            0x218 ) \
+  X( vexDeviceImuTemperatureGet,        0x430 ) \
+  X( vexDeviceImuDebugGet,              0x434 ) \
+  X( vexDeviceImuCollisionDataGet,      0x440 ) \
+  X( vexDeviceRadioUserDataReceive,     0x460 ) \
+  X( vexDeviceRadioModeSet,             0x464 ) \
+  X( vexDeviceAbsEncTemperatureGet,     0x4a8 ) \
+  X( vexDeviceAbsEncDebugGet,           0x4ac ) \
+  X( vexDeviceAbsEncModeSet,            0x4b0 ) \
+  X( vexDeviceAbsEncModeGet,            0x4b4 ) \
+  X( vexDeviceAbsEncOffsetSet,          0x4b8 ) \
+  X( vexDeviceAbsEncOffsetGet,          0x4bc ) \
+  X( vexDeviceDistanceDebugGet,         0x50c ) \
+  X( vexDeviceDistanceModeSet,          0x510 ) \
+  X( vexDeviceDistanceModeGet,          0x514 ) \
+  X( vexDeviceOpticalDebugGet,          0x54c ) \
+  X( vexDeviceOpticalGainSet,           0x568 ) \
+  X( vexDeviceOpticalMatrixSet,         0x56c ) \
+  X( vexDeviceOpticalMatrixGet,         0x570 ) \
+  X( vexDeviceMagnetDebugGet,           0x594 ) \
+  X( vexDeviceMagnetModeSet,            0x598 ) \
+  X( vexDeviceMagnetModeGet,            0x59c ) \
+  X( vexDeviceGpsTemperatureGet,        0x5e8 ) \
+  X( vexDeviceGpsDebugGet,              0x5ec ) \
+  X( vexDeviceGpsTestDataSet,           0x610 ) \
+  X( vexDisplayTextSmoothing,           0x69c ) \
+  X( vexDisplayTextReference,           0x6a0 ) \
+  X( vexDisplayScreenGrab,              0x6a4 ) \
+  X( vexDisplayTextSpacing,             0x6ac ) \
+  X( vexDisplayPenSizeSet,              0x6c8 ) \
+  X( vexDisplayPenSizeGet,              0x6cc ) \
+  X( vexDisplayFontCustomSet,           0x6d0 ) \
+  X( vexDisplayOrientation,             0x780 ) \
+  X( vexDisplayLanguageSet,             0x784 ) \
+  X( vexDisplayStringGet,               0x788 ) \
+  X( vexDisplayClearVsyncState,         0x78c ) \
+  X( vexDisplayGetVsyncState,           0x790 ) \
+  X( vexDisplayRotateFlagGet,           0x798 ) \
+  X( vexDisplayThemeIdGet,              0x79c ) \
+  X( vexDisplayClipRegionSetWithIndex,  0x7a8 ) \
+  X( vexSystemFileReopen,               0x840 ) \
+  X( vexSerialEnableRemoteConsole,      0x8a8 ) \
+  X( vexSystemTimerCallbackInstall,     0x8d8 ) \
+  X( vexSystemVSyncCallbackInstall,     0x8dc ) \
+  X( vexSystemIRQInterrupt,             0x91c ) \
+  X( vexAssetsFind,                     0x988 ) \
+  X( vexAssetsDump,                     0x98c ) \
+  X( vexSystemPdataSet,                 0x9b0 ) \
+  X( vexSystemPdataGet,                 0x9b4 ) \
+  X( vexSystemPdataIdGet,               0x9b8 ) \
+  X( vexSystemPdataFlagsGet,            0x9bc ) \
+  X( vexSystemAppDataOptionsGet,        0x9c0 ) \
+  X( vexSystemAppDataLinkAddrGet,       0x9c4 ) \
+  X( vexSystemAppDataRes1Get,           0x9c8 ) \
+  X( vexSystemAppExtendedDataGet,       0x9cc ) \
+  X( vexSystemAppDebugDataGet,          0x9d0 ) \
+  X( vexBatteryDataGet,                 0xa10 ) \
+  X( vexBatteryDataSet,                 0xa14 ) \
+  X( vexDeviceEventMaskSet,             0xa28 ) \
+  X( vexDeviceEventMaskGet,             0xa2c ) \
+  X( vexDeviceEventDataSet,             0xa30 ) \
+  X( vexDeviceEventDataGet,             0xa34 ) \
+  X( vexDeviceEventBitsSet,             0xa38 ) \
+  X( vexDeviceEventBitsGet,             0xa3c ) \
+  X( vexDeviceGenericSerialDisableAll,  0xa78 ) \
+  X( vexDeviceGenericSerialCdcRead,     0xa7c ) \
+  X( vexDeviceGenericRadioConnection,   0xaa4 ) \
+  X( vexDeviceGenericRadioWriteChar,    0xaa8 ) \
+  X( vexDeviceGenericRadioWriteFree,    0xaac ) \
+  X( vexDeviceGenericRadioTransmit,     0xab0 ) \
+  X( vexDeviceGenericRadioReadChar,     0xab4 ) \
+  X( vexDeviceGenericRadioPeekChar,     0xab8 ) \
+  X( vexDeviceGenericRadioReceiveAvail, 0xabc ) \
+  X( vexDeviceGenericRadioReceive,      0xac0 ) \
+  X( vexDeviceGenericRadioFlush,        0xac4 ) \
+  X( vexDeviceGenericRadioLinkStatus,   0xac8 ) \
+  X( vexDeviceGenericRadioDebugGet,     0xacc ) \
+  X( vexDeviceGenericCdcEnable,         0xaf0 ) \
+  X( vexDeviceGenericCdcConnection,     0xaf4 ) \
+  X( vexDeviceGenericCdcWriteChar,      0xaf8 ) \
+  X( vexDeviceGenericCdcWriteFree,      0xafc ) \
+  X( vexDeviceGenericCdcTransmit,       0xb00 ) \
+  X( vexDeviceGenericCdcReadChar,       0xb04 ) \
+  X( vexDeviceGenericCdcPeekChar,       0xb08 ) \
+  X( vexDeviceGenericCdcReceiveAvail,   0xb0c ) \
+  X( vexDeviceGenericCdcReceive,        0xb10 ) \
+  X( vexDeviceGenericCdcFlush,          0xb14 ) \
+  X( vexDeviceGenericCdcLinkStatus,     0xb18 ) \
+  X( vexDeviceGenericCdcDebugGet,       0xb1c ) \
+  X( vexGzipInflateBuffer,              0xf00 ) \
+  X( vexGzipInflateBufferRaw,           0xf04 ) \
+  X( vexCdc2Command,                    0xf28 ) \
+  X( vexCdc2ReplyWithoutPacket,         0xf2c ) \
+  X( vexCdc2SendSimpleMessage,          0xf30 ) \
+  X( vexCdc2SendExtMessage,             0xf34 ) \
+  X( vexTaskAddWithArg,                 0xf50 ) \
+  X( vexTaskAddWithPriorityWithArg,     0xf54 ) \
+  X( vexTaskStopWithId,                 0xf58 ) \
+  X( vexTaskSuspendWithId,              0xf5c ) \
+  X( vexTaskResumeWithId,               0xf60 ) \
+  X( vexTaskPriorityGetWithId,          0xf64 ) \
+  X( vexTaskPrioritySetWithId,          0xf68 ) \
+  X( vexTaskStateGetWithId,             0xf6c ) \
+  X( vexTaskGetTaskIndexWithId,         0xf70 ) \
+  X( vexTaskGet,                        0xf7c ) \
+  X( vexSystemErrorMessageSet,          0xf94 ) \
+  X( vexSystemFwUpdateRequest,          0xf98 ) \
+  X( vexIntegrityCheck,                 0xf9c )
+
+#endif // VEX_FIRMWARE_OFFSETS_H
@@ -0,0 +1,151 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_hotswap.h                                               */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_HOTSWAP_CLASS_H
+#define   VEX_HOTSWAP_CLASS_H
+
+#include "vex_module.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_hotswap.h
+  * @brief   Code modules that can be reloaded while the program runs
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the hotswap class to reload a code module from the SD card without restarting the program.
+    * @details
+    *  Tasks and event handlers that run module code are registered with
+    *  the hotswap object, not directly.  handler() returns a trampoline, a
+    *  function in the program that calls the module function of the same
+    *  name.  The trampoline can be given to any vex::event or button, and
+    *  it stays valid across reloads because only its target changes.
+    *  task() starts a task that calls the named module function.
+    *
+    *     vex::hotswap auton( "auton.so", exports, count );
+    *     auton.task( "odometry", vex::task::taskPriorityHigh );
+    *     Controller.ButtonA.pressed( auton.handler( "onButtonA" ) );
+    *     auton.reload();
+    *     ...
+    *     Controller.ButtonX.pressed( reloadAuton );     // calls auton.reload()
+    *
+    *  reload() loads the new module before it touches the old one.  Then
+    *  it waits for running handlers to return and stops the module tasks.
+    *  It passes state from the old module to the new one, retargets every
+    *  trampoline and restarts the tasks in the new code.  If the new
+    *  module does not load, the old one keeps running.
+    *
+    *  State is handed over through two optional functions in the module.
+    *
+    *     extern "C" uint32_t vex_module_save( void *state, uint32_t size );
+    *     extern "C" void     vex_module_restore( const void *state, uint32_t size );
+    *
+    *  save returns the number of bytes it wrote, at most STATE_SIZE.
+    *  restore is called after every load, with size 0 the first time.
+    *  Module tasks are restarted from the top, so anything a task needs
+    *  to continue where it stopped has to be in the saved state.
+    *
+    *  Never call reload() from module code.  The caller would return into
+    *  memory that has been freed.
+  */
+  class hotswap  {
+    public:
+      static const uint32_t STATE_SIZE  = 4096;
+      static const int32_t  MAX_SLOTS   = 32;       // handlers and tasks, shared by every hotswap object
+
+      typedef struct _slot {
+        hotswap      *owner;
+        const char   *name;
+        void         *target;                       // in the current module, NULL if it has none
+        vex::task    *task;                         // NULL for a handler
+        int32_t       priority;
+      } slot;
+
+    private:
+      static const int32_t  QUIESCE_TIMEOUT = 1000; // mS to wait for handlers to return
+
+      static slot       _slots[MAX_SLOTS];
+      static int32_t    _slotCount;
+      static uint8_t    _state[STATE_SIZE];
+
+      vex::module       _modules[2];
+      int32_t           _current;                   // index of the running module, -1 before the first load
+      int32_t           _last;                      // index of the last module load() was tried on
+      const char       *_name;
+      const module::symbol *_exports;
+      int32_t           _count;
+      uint32_t          _reloads;
+
+      volatile bool     _swapping;
+      volatile int32_t  _active;                    // handlers inside module code
+
+      int32_t           _reserve( const char *name, int32_t priority, bool task );
+      void              _start( slot &s );
+      void              _stop( slot &s );
+
+      // one distinct function per slot, callbacks such as button presses take no argument
+      template <int32_t N>
+      static void       _trampoline() {
+        _call( N );
+      }
+      static void    (* const _trampolines[MAX_SLOTS])( void );
+
+      static void       _call( int32_t index );
+      static int        _run( void *arg );
+
+    public:
+      hotswap( const char *name, const module::symbol *exports = NULL, int32_t count = 0 );
+      ~hotswap();
+
+      /**
+       * @brief Loads the module file again and moves state, tasks and handlers over to it.
+       * @return Returns false if the new module could not be loaded or handlers did not return in time, the old module keeps running.
+       */
+      bool          reload();
+
+      /**
+       * @brief Gets a trampoline for a module function, for use as an event or button callback.
+       * @return Returns a function that calls the module function of that name, or NULL if every slot is used.
+       * @param name The name of a void function in the module, extern "C" or mangled.
+       */
+      void       (* handler( const char *name ))( void );
+
+      /**
+       * @brief Starts a task that runs a module function, it is restarted on every reload.
+       * @return Returns false if every slot is used.
+       * @param name The name of an int function with no arguments in the module.
+       * @param priority The task priority.
+       */
+      bool          task( const char *name, int32_t priority = vex::task::taskPriorityNormal );
+
+      /**
+       * @brief Checks if a module is running.
+       * @return Returns true once a module has loaded.
+       */
+      bool          loaded();
+
+      /**
+       * @brief Gets the result of the last load.
+       * @return Returns the status of the last module loaded or tried.
+       */
+      module::statusType status();
+
+      /**
+       * @brief Gets the import that could not be bound when status() is unresolved.
+       * @return Returns the symbol name, or an empty string.
+       */
+      const char   *missing();
+
+      /**
+       * @brief Gets the number of successful loads.
+       * @return Returns the count, the first load is 1.
+       */
+      uint32_t      reloads();
+  };
+};
+
+#endif // VEX_HOTSWAP_CLASS_H
@@ -0,0 +1,186 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_interpose.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_INTERPOSE_CLASS_H
+#define   VEX_INTERPOSE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_interpose.h
+  * @brief   Firmware jumptable interposition for call counts and latency
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the interpose class to count and time calls to vex* firmware functions.
+    * @details
+    *  Every vex* function in libv5rt is a thunk that loads its target from
+    *  the firmware jumptable at 0x037FC000 and branches to it.  install()
+    *  swaps one table slot for a typed wrapper that reads the clock, calls
+    *  the original and records the time, so every caller in the program is
+    *  measured.  Only a data word changes, no code is patched, so there is
+    *  no cache maintenance to do and remove() restores the slot exactly.
+    *
+    *  Offsets are listed in firmware_offsets.txt and vex::offsets
+    *
+    *     VEX_INTERPOSE( vexDeviceMotorVoltageSet, vex::offsets::vexDeviceMotorVoltageSet );
+    *     VEX_INTERPOSE( vexDeviceGetTimestamp,    vex::offsets::vexDeviceGetTimestamp );
+    *     ...
+    *     vex::interpose::print();
+    *
+    *  Variadic functions such as vex_printf cannot be wrapped.
+    *
+    *  Anything else that replaces a slot, such as vex::driverlog, goes
+    *  through exchange() so a wrapper stays in the slot and times the
+    *  replacement instead of being overwritten by it.
+  */
+  class interpose  {
+    public:
+      static const uint32_t TABLE_SIZE = 0x1000;
+      static const int32_t  BUCKETS    = 20;        // bucket n counts calls of 2^(n-1) to 2^n uS
+
+      typedef struct _stats {
+        const char *name;
+        uint32_t    offset;
+        void       *original;                       // the function the wrapper calls
+        bool        wrapped;
+        uint32_t    calls;
+        uint32_t    max;                            // uS
+        uint64_t    total;                          // uS
+        uint32_t    histogram[BUCKETS];
+      } stats;
+
+    private:
+      static const int32_t  MAX_HOOKS  = 64;
+
+      static stats      _stats[MAX_HOOKS];
+      static int32_t    _count;
+      static uint64_t (*_clock)( void );
+
+      static int32_t    _reserve( const char *name, uint32_t offset );
+      static void       _patch( int32_t index, void *thunk );
+
+      // one instance per slot and signature, the target is read from the
+      // statistics entry on every call so exchange() can replace it
+      template <uint32_t OFFSET, typename F> struct _hook;
+
+      template <uint32_t OFFSET, typename R, typename... Args>
+      struct _hook<OFFSET, R (*)( Args... )> {
+        static int32_t  index;
+
+        static R thunk( Args... args ) {
+          uint64_t start = _clock();
+          R r = ( (R (*)( Args... ))_stats[index].original )( args... );
+          _record( index, start );
+          return r;
+        }
+      };
+
+      template <uint32_t OFFSET, typename... Args>
+      struct _hook<OFFSET, void (*)( Args... )> {
+        static int32_t  index;
+
+        static void thunk( Args... args ) {
+          uint64_t start = _clock();
+          ( (void (*)( Args... ))_stats[index].original )( args... );
+          _record( index, start );
+        }
+      };
+
+      static inline void _record( int32_t index, uint64_t start ) {
+        uint32_t us = (uint32_t)( _clock() - start );
+        stats   *s  = &_stats[index];
+        int32_t  b  = (us == 0) ? 0 : 32 - __builtin_clz( us );
+
+        s->calls++;
+        s->total += us;
+        if( us > s->max )
+          s->max = us;
+        s->histogram[ (b < BUCKETS) ? b : BUCKETS - 1 ]++;
+      }
+
+    public:
+      /**
+       * @brief Wraps one jumptable entry, use the VEX_INTERPOSE macro rather than calling this directly.
+       * @return Returns true if the entry is wrapped, also when it already was.  Returns false if the offset is invalid or there is no free entry.
+       * @param fn Any pointer of the function type, only the type is used.
+       * @param name The function name used in reports.
+       */
+      template <uint32_t OFFSET, typename F>
+      static bool install( F fn, const char *name ) {
+        int32_t index = _reserve( name, OFFSET );
+        if( index < 0 )
+          return false;
+        if( _stats[index].wrapped )
+          return true;
+
+        // the thunk can run as soon as the slot is written, set it up first
+        _hook<OFFSET, F>::index = index;
+        _patch( index, (void *)&_hook<OFFSET, F>::thunk );
+        return true;
+      }
+
+      /**
+       * @brief Restores one jumptable entry, its statistics are kept.
+       * @return Returns false if the offset is not wrapped.
+       * @param offset The jumptable offset.
+       */
+      static bool     remove( uint32_t offset );
+
+      /**
+       * @brief Restores every wrapped jumptable entry.
+       */
+      static void     removeAll();
+
+      /**
+       * @brief Replaces the function behind a jumptable entry, a wrapped entry stays wrapped and calls the new function.
+       * @return Returns the function that was replaced, pass it back to restore the entry.
+       * @param offset The jumptable offset.
+       * @param fn The new function.
+       */
+      static void    *exchange( uint32_t offset, void *fn );
+
+      /**
+       * @brief Clears all counts, times and histograms.
+       */
+      static void     reset();
+
+      /**
+       * @brief Gets the number of wrapped functions.
+       * @return Returns the number of entries.
+       */
+      static int32_t  count();
+
+      /**
+       * @brief Gets the statistics of one wrapped function.
+       * @return Returns a pointer to the statistics or NULL if index is out of range.
+       * @param index The entry index.
+       */
+      static const stats *data( int32_t index );
+
+      /**
+       * @brief Prints all statistics to the serial console, sorted by total time.
+       */
+      static void     print();
+
+      /**
+       * @brief Saves all statistics to the SD card as CSV.
+       * @return Returns true if the file was written.
+       * @param name The name of the file.
+       */
+      static bool     save( const char *name );
+  };
+
+  template <uint32_t OFFSET, typename R, typename... Args>
+  int32_t interpose::_hook<OFFSET, R (*)( Args... )>::index = 0;
+
+  template <uint32_t OFFSET, typename... Args>
+  int32_t interpose::_hook<OFFSET, void (*)( Args... )>::index = 0;
+};
+
+#define VEX_INTERPOSE( fn, offset )   vex::interpose::install<offset>( &fn, #fn )
+
+#endif // VEX_INTERPOSE_CLASS_H
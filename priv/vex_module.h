@@ -0,0 +1,168 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_module.h                                                */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_MODULE_CLASS_H
+#define   VEX_MODULE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_module.h
+  * @brief   Relocating loader for code modules on the SD card
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the module class to load position independent code from the SD card and call it.
+    * @details
+    *  A module is an ARM ELF shared object.  load() allocates the memory it
+    *  needs, then reads each PT_LOAD segment from the file into its final
+    *  address, so the only copy of the payload is the loaded image.  The
+    *  dynamic relocations are applied in place and the constructors run.
+    *
+    *  Imports are bound by name.  The exports passed to load() are searched
+    *  first, then every function in the firmware jumptable.  Jumptable
+    *  imports call the firmware directly and skip the libv5rt thunk.
+    *  Variadic functions such as vex_printf are not in the table by name,
+    *  so export them from the program if a module uses them.
+    *
+    *     arm-none-eabi-g++ -mcpu=cortex-a9 -mfpu=neon-fp16 -mfloat-abi=softfp
+    *       -fPIC -shared -nostdlib -Wl,--hash-style=sysv -o auton.so auton.cpp
+    *
+    *     vex::module auton;
+    *     if( auton.load( "auton.so", exports, count ) )
+    *       auton.get<int (*)(void)>( "main" )();
+    *
+    *  Symbols are resolved once, at load time.  Slots that vex::interpose
+    *  changes later are not seen by a module that is already loaded.
+  */
+  class module  {
+    public:
+      enum class statusType {
+        /** @brief nothing loaded */
+        unloaded,
+        /** @brief loaded and relocated */
+        loaded,
+        /** @brief the file could not be opened or read */
+        fileError,
+        /** @brief not a 32 bit little endian ARM shared object with softfp calls */
+        badFormat,
+        /** @brief not enough memory for the image */
+        noMemory,
+        /** @brief a relocation type that is not supported or outside the image */
+        badRelocation,
+        /** @brief an import was not found, see missing() */
+        unresolved
+      };
+
+      typedef struct _symbol {
+        const char   *name;
+        void         *address;
+      } symbol;
+
+    private:
+      static const int32_t  MAX_SEGMENTS = 8;
+      static const uint32_t ALIGNMENT    = 64;        // A9 cache line is 32, keep the image on 64
+      static const int32_t  NAME_SIZE    = 48;
+
+      uint8_t      *_memory;                          // as allocated
+      uint8_t      *_base;                            // address of vaddr 0
+      uint32_t      _low;                             // lowest vaddr in the image
+      uint32_t      _end;                             // vaddr after the image
+      uint32_t      _size;                            // _end - _low
+      uint32_t      _entry;
+      statusType    _status;
+      char          _missing[NAME_SIZE];
+
+      // from the dynamic section, all addresses in the image
+      const uint32_t *_hash;
+      const uint8_t  *_symtab;
+      const char     *_strtab;
+      uint32_t      _symbols;                         // nchain, entries in the symbol table
+      uint32_t      _strsz;
+      uint32_t      _finiArray;
+      uint32_t      _finiArraySize;
+      uint32_t      _fini;
+
+      bool          _fail( statusType status );
+      bool          _read( FIL *fp, uint32_t offset, void *to, uint32_t size );
+      bool          _relocate( const uint8_t *rel, uint32_t size, const symbol *exports, int32_t count );
+      bool          _resolve( uint32_t index, const symbol *exports, int32_t count, uint32_t &value );
+      void          _sync();
+
+    public:
+      module();
+      ~module();
+
+      /**
+       * @brief Loads a module, any module already loaded is unloaded first.
+       * @return Returns true if the module was loaded, status() gives the reason if not.
+       * @param name The name of the file on the SD card.
+       * @param exports Symbols from the program that the module may import, searched before the jumptable.
+       * @param count The number of exports.
+       */
+      bool    load( const char *name, const symbol *exports = NULL, int32_t count = 0 );
+
+      /**
+       * @brief Runs the module destructors and frees its memory.
+       */
+      void    unload();
+
+      /**
+       * @brief Checks if a module is loaded.
+       * @return Returns true if the module is loaded.
+       */
+      bool    loaded();
+
+      /**
+       * @brief Gets the result of the last load.
+       * @return Returns the status.
+       */
+      statusType  status();
+
+      /**
+       * @brief Gets the import that could not be bound when status() is unresolved.
+       * @return Returns the symbol name, or an empty string.
+       */
+      const char *missing();
+
+      /**
+       * @brief Finds a symbol the module defines.
+       * @return Returns its address or NULL.
+       * @param name The symbol name.
+       */
+      void   *find( const char *name );
+
+      /**
+       * @brief Finds a function the module defines as a typed pointer.
+       * @return Returns the function or NULL.
+       * @param name The symbol name.
+       */
+      template <typename F>
+      F       get( const char *name ) {
+        return( (F)find( name ) );
+      }
+
+      /**
+       * @brief Gets the ELF entry point.
+       * @return Returns the address, or NULL if the module was linked without one.
+       */
+      void   *entry();
+
+      /**
+       * @brief Gets the address the module was loaded at.
+       * @return Returns the address of virtual address 0 in the module.
+       */
+      void   *base();
+
+      /**
+       * @brief Gets the size of the loaded image.
+       * @return Returns the size in bytes.
+       */
+      uint32_t size();
+  };
+};
+
+#endif // VEX_MODULE_CLASS_H
@@ -0,0 +1,450 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_replay.h                                                */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_REPLAY_CLASS_H
+#define   VEX_REPLAY_CLASS_H
+
+#include <string.h>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_replay.h
+  * @brief   Record and replay of firmware inputs
+*//*---------------------------------------------------------------------------*/
+
+//
+// Every function whose results are recorded.  The id is written to the
+// stream and must never change, add new entries at the end.  The arity is
+// only used by the host build to define the functions.
+//
+#define VEX_REPLAY_FUNCTIONS( X ) \
+  X(   1, 0x118, vexSystemTimeGet,                        0 ) \
+  X(   2, 0x134, vexSystemHighResTimeGet,                 0 ) \
+  X(   3, 0x138, vexSystemPowerupTimeGet,                 0 ) \
+  X(   4, 0xa00, vexBatteryVoltageGet,                    0 ) \
+  X(   5, 0xa04, vexBatteryCurrentGet,                    0 ) \
+  X(   6, 0xa08, vexBatteryTemperatureGet,                0 ) \
+  X(   7, 0xa0c, vexBatteryCapacityGet,                   0 ) \
+  X(   8, 0x9d8, vexCompetitionStatus,                    0 ) \
+  X(   9, 0x1a4, vexControllerGet,                        2 ) \
+  X(  10, 0x1a8, vexControllerConnectionStatusGet,        1 ) \
+  X(  11, 0x964, vexTouchDataGet,                         1 ) \
+  X(  12, 0x1b4, vexDeviceButtonStateGet,                 0 ) \
+  X(  13, 0x1a0, vexDeviceGetStatus,                      1 ) \
+  X(  14, 0x1b0, vexDeviceGetTimestamp,                   1 ) \
+  X(  15, 0x1e8, vexDeviceLedGet,                         1 ) \
+  X(  16, 0x1ec, vexDeviceLedRgbGet,                      1 ) \
+  X(  17, 0x20c, vexDeviceAdiPortConfigGet,               2 ) \
+  X(  18, 0x214, vexDeviceAdiValueGet,                    2 ) \
+  X(  19, 0x230, vexDeviceBumperGet,                      1 ) \
+  X(  20, 0x25c, vexDeviceGyroHeadingGet,                 1 ) \
+  X(  21, 0x260, vexDeviceGyroDegreesGet,                 1 ) \
+  X(  22, 0x280, vexDeviceSonarValueGet,                  1 ) \
+  X(  23, 0x2a8, vexDeviceGenericValueGet,                1 ) \
+  X(  24, 0x2d4, vexDeviceMotorVelocityGet,               1 ) \
+  X(  25, 0x2d8, vexDeviceMotorActualVelocityGet,         1 ) \
+  X(  26, 0x2dc, vexDeviceMotorDirectionGet,              1 ) \
+  X(  27, 0x2e4, vexDeviceMotorModeGet,                   1 ) \
+  X(  28, 0x2ec, vexDeviceMotorPwmGet,                    1 ) \
+  X(  29, 0x2f4, vexDeviceMotorCurrentLimitGet,           1 ) \
+  X(  30, 0x370, vexDeviceMotorVoltageLimitGet,           1 ) \
+  X(  31, 0x2f8, vexDeviceMotorCurrentGet,                1 ) \
+  X(  32, 0x360, vexDeviceMotorVoltageGet,                1 ) \
+  X(  33, 0x2fc, vexDeviceMotorPowerGet,                  1 ) \
+  X(  34, 0x300, vexDeviceMotorTorqueGet,                 1 ) \
+  X(  35, 0x304, vexDeviceMotorEfficiencyGet,             1 ) \
+  X(  36, 0x308, vexDeviceMotorTemperatureGet,            1 ) \
+  X(  37, 0x30c, vexDeviceMotorOverTempFlagGet,           1 ) \
+  X(  38, 0x310, vexDeviceMotorCurrentLimitFlagGet,       1 ) \
+  X(  39, 0x354, vexDeviceMotorFaultsGet,                 1 ) \
+  X(  40, 0x314, vexDeviceMotorZeroVelocityFlagGet,       1 ) \
+  X(  41, 0x318, vexDeviceMotorZeroPositionFlagGet,       1 ) \
+  X(  42, 0x358, vexDeviceMotorFlagsGet,                  1 ) \
+  X(  43, 0x320, vexDeviceMotorReverseFlagGet,            1 ) \
+  X(  44, 0x328, vexDeviceMotorEncoderUnitsGet,           1 ) \
+  X(  45, 0x330, vexDeviceMotorBrakeModeGet,              1 ) \
+  X(  46, 0x338, vexDeviceMotorPositionGet,               1 ) \
+  X(  47, 0x33c, vexDeviceMotorPositionRawGet,            2 ) \
+  X(  48, 0x344, vexDeviceMotorTargetGet,                 1 ) \
+  X(  49, 0x368, vexDeviceMotorGearingGet,                1 ) \
+  X(  50, 0x39c, vexDeviceVisionModeGet,                  1 ) \
+  X(  51, 0x3a0, vexDeviceVisionObjectCountGet,           1 ) \
+  X(  52, 0x3a4, vexDeviceVisionObjectGet,                3 ) \
+  X(  53, 0x3ac, vexDeviceVisionSignatureGet,             3 ) \
+  X(  54, 0x3b4, vexDeviceVisionBrightnessGet,            1 ) \
+  X(  55, 0x3bc, vexDeviceVisionWhiteBalanceModeGet,      1 ) \
+  X(  56, 0x3c4, vexDeviceVisionWhiteBalanceGet,          1 ) \
+  X(  57, 0x3cc, vexDeviceVisionLedModeGet,               1 ) \
+  X(  58, 0x3d4, vexDeviceVisionLedBrigntnessGet,         1 ) \
+  X(  59, 0x3dc, vexDeviceVisionLedColorGet,              1 ) \
+  X(  60, 0x3e4, vexDeviceVisionWifiModeGet,              1 ) \
+  X(  61, 0x414, vexDeviceImuHeadingGet,                  1 ) \
+  X(  62, 0x418, vexDeviceImuDegreesGet,                  1 ) \
+  X(  63, 0x41c, vexDeviceImuQuaternionGet,               2 ) \
+  X(  64, 0x420, vexDeviceImuAttitudeGet,                 2 ) \
+  X(  65, 0x424, vexDeviceImuRawGyroGet,                  2 ) \
+  X(  66, 0x428, vexDeviceImuRawAccelGet,                 2 ) \
+  X(  67, 0x42c, vexDeviceImuStatusGet,                   1 ) \
+  X(  68, 0x43c, vexDeviceImuModeGet,                     1 ) \
+  X(  69, 0x4d8, vexDeviceRangeValueGet,                  1 ) \
+  X(  70, 0x490, vexDeviceAbsEncPositionGet,              1 ) \
+  X(  71, 0x494, vexDeviceAbsEncVelocityGet,              1 ) \
+  X(  72, 0x498, vexDeviceAbsEncAngleGet,                 1 ) \
+  X(  73, 0x4a0, vexDeviceAbsEncReverseFlagGet,           1 ) \
+  X(  74, 0x4a4, vexDeviceAbsEncStatusGet,                1 ) \
+  X(  75, 0x528, vexDeviceOpticalHueGet,                  1 ) \
+  X(  76, 0x52c, vexDeviceOpticalSatGet,                  1 ) \
+  X(  77, 0x530, vexDeviceOpticalBrightnessGet,           1 ) \
+  X(  78, 0x534, vexDeviceOpticalProximityGet,            1 ) \
+  X(  79, 0x538, vexDeviceOpticalRgbGet,                  2 ) \
+  X(  80, 0x540, vexDeviceOpticalLedPwmGet,               1 ) \
+  X(  81, 0x544, vexDeviceOpticalStatusGet,               1 ) \
+  X(  82, 0x548, vexDeviceOpticalRawGet,                  2 ) \
+  X(  83, 0x554, vexDeviceOpticalModeGet,                 1 ) \
+  X(  84, 0x558, vexDeviceOpticalGestureGet,              2 ) \
+  X(  85, 0xb44, vexDeviceOpticalIntegrationTimeGet,      1 ) \
+  X(  86, 0x57c, vexDeviceMagnetPowerGet,                 1 ) \
+  X(  87, 0x588, vexDeviceMagnetTemperatureGet,           1 ) \
+  X(  88, 0x58c, vexDeviceMagnetCurrentGet,               1 ) \
+  X(  89, 0x590, vexDeviceMagnetStatusGet,                1 ) \
+  X(  90, 0x500, vexDeviceDistanceDistanceGet,            1 ) \
+  X(  91, 0x504, vexDeviceDistanceConfidenceGet,          1 ) \
+  X(  92, 0x518, vexDeviceDistanceObjectSizeGet,          1 ) \
+  X(  93, 0x51c, vexDeviceDistanceObjectVelocityGet,      1 ) \
+  X(  94, 0x508, vexDeviceDistanceStatusGet,              1 ) \
+  X(  95, 0x5cc, vexDeviceGpsHeadingGet,                  1 ) \
+  X(  96, 0x5d0, vexDeviceGpsDegreesGet,                  1 ) \
+  X(  97, 0x5d4, vexDeviceGpsQuaternionGet,               2 ) \
+  X(  98, 0x5d8, vexDeviceGpsAttitudeGet,                 3 ) \
+  X(  99, 0x5dc, vexDeviceGpsRawGyroGet,                  2 ) \
+  X( 100, 0x5e0, vexDeviceGpsRawAccelGet,                 2 ) \
+  X( 101, 0x5e4, vexDeviceGpsStatusGet,                   1 ) \
+  X( 102, 0x5f4, vexDeviceGpsModeGet,                     1 ) \
+  X( 103, 0x600, vexDeviceGpsOriginGet,                   3 ) \
+  X( 104, 0x608, vexDeviceGpsRotationGet,                 1 ) \
+  X( 105, 0x614, vexDeviceGpsErrorGet,                    1 )
+
+namespace vex {
+  class task;
+  class replay_host;
+
+  /**
+    * @brief Use the replay class to record every firmware input a program reads and feed it back later.
+    * @details
+    *  record() swaps the jumptable slots of the functions listed in
+    *  VEX_REPLAY_FUNCTIONS for wrappers that call the firmware and append
+    *  the results, including structures returned through pointers, to a file
+    *  on the SD card.  play() swaps them for wrappers that return the
+    *  recorded values instead, so a program that only depends on its inputs
+    *  runs exactly as it did during the recording.
+    *
+    *  The same stream can be played on a host, tools/replay_host.cpp
+    *  defines the recorded functions so control code written against
+    *  v5_api.h can be compiled and run on a PC.
+    *
+    *  Each call is written as its function id followed by the result as
+    *  32 bit words, every word is the zigzag varint of its difference from
+    *  the previous result of the same function with the same arguments.
+    *  Unchanged values cost one byte per word.
+    *
+    *  The scheduler is cooperative so no locking is done, but a program with
+    *  several tasks may not call the functions in the same order when played
+    *  back.  The first call that does not match the recording is reported by
+    *  diverged() and the real firmware is used from then on.  During play on
+    *  the brain motor commands still reach the motors.
+  */
+  class replay  {
+    public:
+      static const uint32_t MAGIC       = 0x594C5052;   // 'RPLY'
+      static const uint32_t VERSION     = 1;
+
+      typedef struct _header {
+        uint32_t    magic;
+        uint32_t    version;
+        uint32_t    functions;                    // entries in VEX_REPLAY_FUNCTIONS when recorded
+        uint32_t    time;                         // vexSystemTimeGet when recorded
+      } header;
+
+      enum class modeType {
+        idle,
+        recording,
+        playing
+      };
+
+    private:
+      static const int32_t  BUFFER_SIZE = 8192;
+      static const int32_t  MAX_RECORD  = 512;          // largest single call, vexDeviceGetStatus is 161 bytes
+      static const int32_t  LAST_SIZE   = 4096;
+
+      static volatile modeType _mode;
+      static uint32_t   _last[LAST_SIZE];
+      static uint8_t    _buffer[2][BUFFER_SIZE];
+      static int32_t    _current;
+      static int32_t    _length;                      // bytes in the current buffer
+      static int32_t    _position;                    // read position while playing
+      static volatile int32_t _pending[2];          // bytes waiting to be written
+      static volatile bool _writing;
+      static uint32_t   _calls;
+      static uint32_t   _stalls;
+      static int32_t    _diverged;
+      static uint8_t   *_deviceBase;
+      static int32_t    _deviceStride;
+
+      // platform, brain in src/vex_replay.cpp and host in tools/replay_host.cpp
+      static void       _swap();
+      static bool       _refill();
+      static void      *_exchange( uint32_t offset, void *fn );
+
+      static inline uint32_t _port( V5_DeviceT device ) {
+        int32_t d = (int32_t)( (uint8_t *)device - _deviceBase );
+        if( _deviceStride <= 0 || d < 0 || d >= _deviceStride * V5_MAX_DEVICE_PORTS )
+          return( 0xFF );
+        return( (uint32_t)( d / _deviceStride ) );
+      }
+
+      // arguments that select a value, pointers other than devices are outputs
+      template <typename T>
+      static inline void _keyOf( uint32_t &key, T value ) {
+        key = key * 33 + (uint32_t)value;
+      }
+      template <typename T>
+      static inline void _keyOf( uint32_t &key, T *p ) {
+      }
+      static inline void _keyOf( uint32_t &key, V5_DeviceT device ) {
+        key = key * 33 + _port( device );
+      }
+
+      static inline uint32_t _slot( uint32_t key, int32_t word ) {
+        return( ( key * 2654435761u + (uint32_t)word ) & (LAST_SIZE - 1) );
+      }
+
+      static inline void _put( uint8_t b ) {
+        _buffer[_current][_length++] = b;
+      }
+      static inline uint8_t _get() {
+        if( _position >= _length && !_refill() )
+          return( 0 );
+        return( _buffer[0][_position++] );
+      }
+
+      static inline void _encode( uint32_t slot, uint32_t value ) {
+        int32_t  d = (int32_t)( value - _last[slot] );
+        uint32_t z = ( (uint32_t)d << 1 ) ^ (uint32_t)( d >> 31 );
+        _last[slot] = value;
+
+        while( z >= 0x80 ) {
+          _put( (uint8_t)( z | 0x80 ) );
+          z >>= 7;
+        }
+        _put( (uint8_t)z );
+      }
+      static inline uint32_t _decode( uint32_t slot ) {
+        uint32_t z = 0;
+        for( int s=0;s<35;s+=7 ) {
+          uint8_t b = _get();
+          z |= (uint32_t)( b & 0x7F ) << s;
+          if( (b & 0x80) == 0 )
+            break;
+        }
+        _last[slot] += ( z >> 1 ) ^ ( 0u - ( z & 1 ) );
+        return( _last[slot] );
+      }
+
+      static inline void _encodeObject( uint32_t key, int32_t &word, const void *p, uint32_t size ) {
+        for( uint32_t i=0;i<size;i+=4 ) {
+          uint32_t w = 0;
+          memcpy( &w, (const uint8_t *)p + i, (size - i < 4) ? size - i : 4 );
+          _encode( _slot( key, word++ ), w );
+        }
+      }
+      static inline void _decodeObject( uint32_t key, int32_t &word, void *p, uint32_t size ) {
+        for( uint32_t i=0;i<size;i+=4 ) {
+          uint32_t w = _decode( _slot( key, word++ ) );
+          memcpy( (uint8_t *)p + i, &w, (size - i < 4) ? size - i : 4 );
+        }
+      }
+
+      template <typename T>
+      static inline void _output( uint32_t key, int32_t &word, T value, bool write ) {
+      }
+      template <typename T>
+      static inline void _output( uint32_t key, int32_t &word, T *p, bool write ) {
+        if( write )
+          _encodeObject( key, word, p, sizeof(T) );
+        else
+          _decodeObject( key, word, p, sizeof(T) );
+      }
+      static inline void _output( uint32_t key, int32_t &word, V5_DeviceT device, bool write ) {
+      }
+      static inline void _output( uint32_t key, int32_t &word, V5_DeviceType *buffer, bool write ) {
+        if( write )
+          _encodeObject( key, word, buffer, sizeof(V5_DeviceTypeBuffer) );
+        else
+          _decodeObject( key, word, buffer, sizeof(V5_DeviceTypeBuffer) );
+      }
+
+      static inline bool _begin( uint8_t id ) {
+        if( _mode == modeType::recording ) {
+          if( _length > BUFFER_SIZE - MAX_RECORD )
+            _swap();
+          _put( id );
+          _calls++;
+          return( true );
+        }
+        if( _mode == modeType::playing && _diverged < 0 ) {
+          if( _get() == id ) {
+            _calls++;
+            return( true );
+          }
+          _diverged = (int32_t)_calls;
+        }
+        return( false );
+      }
+
+      template <int32_t ID, typename... Args>
+      static inline uint32_t _key( Args... args ) {
+        uint32_t key = ID;
+        int      unused[] = { 0, ( _keyOf( key, args ), 0 )... };
+        (void)unused;
+        return( key );
+      }
+
+      template <int32_t ID, typename F> struct _hook;
+
+      template <int32_t ID, typename R, typename... Args>
+      struct _hook<ID, R (*)( Args... )> {
+        static R      (*original)( Args... );
+
+        static R record( Args... args ) {
+          R r = original( args... );
+          if( _begin( ID ) ) {
+            uint32_t key  = _key<ID>( args... );
+            int32_t  word = 0;
+            _encodeObject( key, word, &r, sizeof(R) );
+            int      unused[] = { 0, ( _output( key, word, args, true ), 0 )... };
+            (void)unused;
+          }
+          return r;
+        }
+
+        static R play( Args... args ) {
+          if( !_begin( ID ) )
+            return (original != NULL) ? original( args... ) : R();
+
+          R        r;
+          uint32_t key  = _key<ID>( args... );
+          int32_t  word = 0;
+          _decodeObject( key, word, &r, sizeof(R) );
+          int      unused[] = { 0, ( _output( key, word, args, false ), 0 )... };
+          (void)unused;
+          return r;
+        }
+      };
+
+      template <int32_t ID, typename... Args>
+      struct _hook<ID, void (*)( Args... )> {
+        static void   (*original)( Args... );
+
+        static void record( Args... args ) {
+          original( args... );
+          if( _begin( ID ) ) {
+            uint32_t key  = _key<ID>( args... );
+            int32_t  word = 0;
+            int      unused[] = { 0, ( _output( key, word, args, true ), 0 )... };
+            (void)unused;
+          }
+        }
+
+        static void play( Args... args ) {
+          if( !_begin( ID ) ) {
+            if( original != NULL )
+              original( args... );
+            return;
+          }
+
+          uint32_t key  = _key<ID>( args... );
+          int32_t  word = 0;
+          int      unused[] = { 0, ( _output( key, word, args, false ), 0 )... };
+          (void)unused;
+        }
+      };
+
+      template <int32_t ID, typename F>
+      static void _install( uint32_t offset, F fn, bool play ) {
+        void *thunk = play ? (void *)&_hook<ID, F>::play : (void *)&_hook<ID, F>::record;
+        _hook<ID, F>::original = (F)_exchange( offset, thunk );
+      }
+      template <int32_t ID, typename F>
+      static void _remove( uint32_t offset, F fn ) {
+        if( _hook<ID, F>::original != NULL )
+          _exchange( offset, (void *)_hook<ID, F>::original );
+      }
+
+      static void       _reset();
+      static void       _installAll( bool play );
+      static void       _removeAll();
+
+      // the host build defines the recorded functions with the play wrappers
+      friend class      replay_host;
+
+      static vex::task *_task;
+      static FIL       *_file;
+      static void       _flush( int32_t index );
+      static int        _run( void *arg );
+
+    public:
+      /**
+       * @brief Starts recording every function in VEX_REPLAY_FUNCTIONS to a file.
+       * @return Returns false if a recording or playback is running or the file could not be created.
+       * @param name The name of the file on the SD card.
+       */
+      static bool     record( const char *name );
+
+      /**
+       * @brief Starts playing a recording back.
+       * @return Returns false if a recording or playback is running or the file is not a recording.
+       * @param name The name of the file on the SD card, or on the host a path.
+       */
+      static bool     play( const char *name );
+
+      /**
+       * @brief Stops recording or playback and restores the firmware functions.
+       */
+      static void     stop();
+
+      /**
+       * @brief Gets the current mode.
+       * @return Returns idle, recording or playing.
+       */
+      static modeType mode();
+
+      /**
+       * @brief Gets the number of calls recorded or played so far.
+       * @return Returns the call count.
+       */
+      static uint32_t calls();
+
+      /**
+       * @brief Gets the number of times recording had to wait for the SD card.
+       * @return Returns the count, anything other than 0 means the recording changed the program timing.
+       */
+      static uint32_t stalls();
+
+      /**
+       * @brief Checks if playback has left the recording.
+       * @return Returns the index of the first call that did not match or came after the end of the recording, or -1.
+       */
+      static int32_t  diverged();
+  };
+
+  template <int32_t ID, typename R, typename... Args>
+  R (*replay::_hook<ID, R (*)( Args... )>::original)( Args... ) = NULL;
+
+  template <int32_t ID, typename... Args>
+  void (*replay::_hook<ID, void (*)( Args... )>::original)( Args... ) = NULL;
+};
+
+#endif // VEX_REPLAY_CLASS_H
@@ -0,0 +1,2035 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_thunks.h                                                */
+/*                                                                            */
+/*    Generated by tools/thunkgen.cpp from firmware_offsets.txt, do not edit  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_THUNKS_H
+#define   VEX_THUNKS_H
+
+#include <cstdint>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_thunks.h
+  * @brief   Jumptable offsets and inline thunks
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  namespace offsets {
+    constexpr uint32_t TABLE_BASE                         = 0x037FC000;
+
+    constexpr uint32_t vexUnnamed_000                     = 0x000;
+    constexpr uint32_t vexUnnamed_004                     = 0x004;
+    constexpr uint32_t vexStdlibMismatchError             = 0x010;
+    constexpr uint32_t vexUnnamed_018                     = 0x018;
+    constexpr uint32_t vexScratchMemoryPtr                = 0x01c;
+    constexpr uint32_t vexPrivateApiDisable               = 0x020;
+    constexpr uint32_t vexPrivateApiEnable                = 0x024;
+    constexpr uint32_t vexTaskAdd                         = 0x028;
+    constexpr uint32_t vexTaskAddWithPriority             = 0x02c;
+    constexpr uint32_t vexTaskAddSimple                   = 0x030;
+    constexpr uint32_t vexTaskAddSimpleWithPriority       = 0x034;
+    constexpr uint32_t vexTaskStop                        = 0x038;
+    constexpr uint32_t vexTaskSuspend                     = 0x03c;
+    constexpr uint32_t vexTaskResume                      = 0x040;
+    constexpr uint32_t vexTaskSuspendCurrent              = 0x044;
+    constexpr uint32_t vexTaskResumeCurrent               = 0x048;
+    constexpr uint32_t vexTaskProgramSuspend              = 0x04c;
+    constexpr uint32_t vexTaskProgramResume               = 0x050;
+    constexpr uint32_t vexTaskPriorityGet                 = 0x054;
+    constexpr uint32_t vexTaskPrioritySet                 = 0x058;
+    constexpr uint32_t vexTasksRun                        = 0x05c;
+    constexpr uint32_t vexTaskYield                       = 0x060;
+    constexpr uint32_t vexTaskCheckTimeslice              = 0x064;
+    constexpr uint32_t vexTaskGetIndex                    = 0x068;
+    constexpr uint32_t vexTaskSleep                       = 0x06c;
+    constexpr uint32_t vexSemaphoreInit                   = 0x070;
+    constexpr uint32_t vexSemaphoreLock                   = 0x074;
+    constexpr uint32_t vexSemaphoreUnlock                 = 0x078;
+    constexpr uint32_t vexSemaphoreGetOwner               = 0x07c;
+    constexpr uint32_t vexTasksDump                       = 0x080;
+    constexpr uint32_t vexTaskGetCallbackAndId            = 0x084;
+    constexpr uint32_t vexTaskGetCallback                 = 0x084;    // alias of vexTaskGetCallbackAndId
+    constexpr uint32_t vexTaskWaitForExitWithId           = 0x088;
+    constexpr uint32_t vexTaskWaitForExit                 = 0x088;    // alias of vexTaskWaitForExitWithId
+    constexpr uint32_t vexTaskStateGet                    = 0x08c;
+    constexpr uint32_t vexTaskGetTaskIndex                = 0x090;
+    constexpr uint32_t vexTaskStopAll                     = 0x094;
+    constexpr uint32_t vexTaskStopAllUser                 = 0x098;
+    constexpr uint32_t vexTaskRemoveAllUser               = 0x09c;
+    constexpr uint32_t vexEventBroadcastAndWait           = 0x0a0;
+    constexpr uint32_t vexEventBroadcast                  = 0x0a4;
+    constexpr uint32_t vexEventAdd                        = 0x0a8;
+    constexpr uint32_t vexEventUserIndexGet               = 0x0ac;
+    constexpr uint32_t vexEventAddWithArg                 = 0x0b0;
+    constexpr uint32_t vexEventsCleanup                   = 0x0b4;
+    constexpr uint32_t vexEventsDump                      = 0x0b8;
+    constexpr uint32_t vexEventGetArg                     = 0x0bc;
+    constexpr uint32_t vexEventsGetMax                    = 0x0c0;
+    constexpr uint32_t vexEventsGetCount                  = 0x0c4;
+    constexpr uint32_t vexBreak                           = 0x0c8;
+    constexpr uint32_t vexTaskBreakpointSet               = 0x0cc;
+    constexpr uint32_t vexTaskBreakpointDump              = 0x0d0;
+    constexpr uint32_t vex_printf                         = 0x0f0;
+    constexpr uint32_t vexDebug                           = 0x0f0;    // alias of vex_printf
+    constexpr uint32_t vex_sprintf                        = 0x0f4;
+    constexpr uint32_t vex_vsprintf                       = 0x0f4;    // alias of vex_sprintf
+    constexpr uint32_t vex_snprintf                       = 0x0f8;
+    constexpr uint32_t vex_vsnprintf                      = 0x0f8;    // alias of vex_snprintf
+    constexpr uint32_t vexSystemTimeGet                   = 0x118;
+    constexpr uint32_t vexGettime                         = 0x11c;
+    constexpr uint32_t vexGetdate                         = 0x120;
+    constexpr uint32_t vexSystemMemoryDump                = 0x124;
+    constexpr uint32_t vexSystemDigitalIO                 = 0x128;
+    constexpr uint32_t vexSystemStartupOptions            = 0x12c;
+    constexpr uint32_t vexSystemExitRequest               = 0x130;
+    constexpr uint32_t vexSystemHighResTimeGet            = 0x134;
+    constexpr uint32_t vexSystemPowerupTimeGet            = 0x138;
+    constexpr uint32_t vexSystemLinkAddrGet               = 0x13c;
+    constexpr uint32_t vexTaskHardwareConcurrency         = 0x140;
+    constexpr uint32_t vexTaskCompletionIdSet             = 0x144;
+    constexpr uint32_t vexTaskStackSizeGet                = 0x148;
+    constexpr uint32_t vexTaskStackDefaultSizeGet         = 0x14c;
+    constexpr uint32_t vexTaskStackUseGet                 = 0x150;
+    constexpr uint32_t vexTaskStackTopGet                 = 0x154;
+    constexpr uint32_t vexTaskFree                        = 0x158;
+    constexpr uint32_t vexTaskGetArgs                     = 0x15c;
+    constexpr uint32_t vexTaskSetArgs                     = 0x160;
+    constexpr uint32_t vexSystemTimerGet                  = 0x168;
+    constexpr uint32_t vexSystemTimerEnable               = 0x16c;
+    constexpr uint32_t vexSystemTimerDisable              = 0x170;
+    constexpr uint32_t vexSystemUsbStatus                 = 0x174;
+    constexpr uint32_t vexDevicesGetNumber                = 0x190;
+    constexpr uint32_t vexDevicesGetNumberByType          = 0x194;
+    constexpr uint32_t vexDevicesGet                      = 0x198;
+    constexpr uint32_t vexDeviceGetByIndex                = 0x19c;
+    constexpr uint32_t vexDeviceGetStatus                 = 0x1a0;
+    constexpr uint32_t vexControllerGet                   = 0x1a4;
+    constexpr uint32_t vexControllerConnectionStatusGet   = 0x1a8;
+    constexpr uint32_t vexControllerTextSet               = 0x1ac;
+    constexpr uint32_t vexDeviceGetTimestamp              = 0x1b0;
+    constexpr uint32_t vexDeviceButtonStateGet            = 0x1b4;
+    constexpr uint32_t vexDeviceTypeGetByIndex            = 0x1b8;
+    constexpr uint32_t vexDeviceTypeSetByIndex            = 0x1bc;
+    constexpr uint32_t vexDeviceValueGetByIndex           = 0x1c0;
+    constexpr uint32_t vexDeviceValueSetByIndex           = 0x1c4;
+    constexpr uint32_t vexDeviceDatarateSet               = 0x1c8;
+    constexpr uint32_t vexDeviceTimerSet                  = 0x1cc;
+    constexpr uint32_t vexDeviceTimerSetWithArg           = 0x1d0;
+    constexpr uint32_t vexDeviceTimerDump                 = 0x1d4;
+    constexpr uint32_t vexDeviceFlagsGetByIndex           = 0x1d8;
+    constexpr uint32_t vexDeviceLedSet                    = 0x1e0;
+    constexpr uint32_t vexDeviceLedRgbSet                 = 0x1e4;
+    constexpr uint32_t vexDeviceLedGet                    = 0x1e8;
+    constexpr uint32_t vexDeviceLedRgbGet                 = 0x1ec;
+    constexpr uint32_t vexDeviceAdiPortConfigSet          = 0x208;
+    constexpr uint32_t vexDeviceAdiPortConfigGet          = 0x20c;
+    constexpr uint32_t vexDeviceAdiValueSet               = 0x210;
+    constexpr uint32_t vexDeviceAdiValueGet               = 0x214;
+    constexpr uint32_t vexDeviceAdiVoltageGet             = 0x218;
+    constexpr uint32_t vexUnnamed_21c                     = 0x21c;
+    constexpr uint32_t vexDeviceBumperGet                 = 0x230;
+    constexpr uint32_t vexDeviceGyroReset                 = 0x258;
+    constexpr uint32_t vexDeviceGyroHeadingGet            = 0x25c;
+    constexpr uint32_t vexDeviceGyroDegreesGet            = 0x260;
+    constexpr uint32_t vexDeviceSonarValueGet             = 0x280;
+    constexpr uint32_t vexDeviceGenericValueGet           = 0x2a8;
+    constexpr uint32_t vexDeviceMotorVelocitySet          = 0x2d0;
+    constexpr uint32_t vexDeviceMotorVelocityGet          = 0x2d4;
+    constexpr uint32_t vexDeviceMotorActualVelocityGet    = 0x2d8;
+    constexpr uint32_t vexDeviceMotorDirectionGet         = 0x2dc;
+    constexpr uint32_t vexDeviceMotorModeSet              = 0x2e0;
+    constexpr uint32_t vexDeviceMotorModeGet              = 0x2e4;
+    constexpr uint32_t vexDeviceMotorPwmSet               = 0x2e8;
+    constexpr uint32_t vexDeviceMotorPwmGet               = 0x2ec;
+    constexpr uint32_t vexDeviceMotorCurrentLimitSet      = 0x2f0;
+    constexpr uint32_t vexDeviceMotorCurrentLimitGet      = 0x2f4;
+    constexpr uint32_t vexDeviceMotorCurrentGet           = 0x2f8;
+    constexpr uint32_t vexDeviceMotorPowerGet             = 0x2fc;
+    constexpr uint32_t vexDeviceMotorTorqueGet            = 0x300;
+    constexpr uint32_t vexDeviceMotorEfficiencyGet        = 0x304;
+    constexpr uint32_t vexDeviceMotorTemperatureGet       = 0x308;
+    constexpr uint32_t vexDeviceMotorOverTempFlagGet      = 0x30c;
+    constexpr uint32_t vexDeviceMotorCurrentLimitFlagGet  = 0x310;
+    constexpr uint32_t vexDeviceMotorZeroVelocityFlagGet  = 0x314;
+    constexpr uint32_t vexDeviceMotorZeroPositionFlagGet  = 0x318;
+    constexpr uint32_t vexDeviceMotorReverseFlagSet       = 0x31c;
+    constexpr uint32_t vexDeviceMotorReverseFlagGet       = 0x320;
+    constexpr uint32_t vexDeviceMotorEncoderUnitsSet      = 0x324;
+    constexpr uint32_t vexDeviceMotorEncoderUnitsGet      = 0x328;
+    constexpr uint32_t vexDeviceMotorBrakeModeSet         = 0x32c;
+    constexpr uint32_t vexDeviceMotorBrakeModeGet         = 0x330;
+    constexpr uint32_t vexDeviceMotorPositionSet          = 0x334;
+    constexpr uint32_t vexDeviceMotorPositionGet          = 0x338;
+    constexpr uint32_t vexDeviceMotorPositionRawGet       = 0x33c;
+    constexpr uint32_t vexDeviceMotorPositionReset        = 0x340;
+    constexpr uint32_t vexDeviceMotorTargetGet            = 0x344;
+    constexpr uint32_t vexDeviceMotorServoTargetSet       = 0x348;
+    constexpr uint32_t vexDeviceMotorAbsoluteTargetSet    = 0x34c;
+    constexpr uint32_t vexDeviceMotorRelativeTargetSet    = 0x350;
+    constexpr uint32_t vexDeviceMotorFaultsGet            = 0x354;
+    constexpr uint32_t vexDeviceMotorFlagsGet             = 0x358;
+    constexpr uint32_t vexDeviceMotorVoltageSet           = 0x35c;
+    constexpr uint32_t vexDeviceMotorVoltageGet           = 0x360;
+    constexpr uint32_t vexDeviceMotorGearingSet           = 0x364;
+    constexpr uint32_t vexDeviceMotorGearingGet           = 0x368;
+    constexpr uint32_t vexDeviceMotorVoltageLimitSet      = 0x36c;
+    constexpr uint32_t vexDeviceMotorVoltageLimitGet      = 0x370;
+    constexpr uint32_t vexDeviceMotorVelocityUpdate       = 0x374;
+    constexpr uint32_t vexDeviceMotorPositionPidSet       = 0x378;
+    constexpr uint32_t vexDeviceMotorVelocityPidSet       = 0x37c;
+    constexpr uint32_t vexDeviceMotorExternalProfileSet   = 0x380;
+    constexpr uint32_t vexDeviceVisionModeSet             = 0x398;
+    constexpr uint32_t vexDeviceVisionModeGet             = 0x39c;
+    constexpr uint32_t vexDeviceVisionObjectCountGet      = 0x3a0;
+    constexpr uint32_t vexDeviceVisionObjectGet           = 0x3a4;
+    constexpr uint32_t vexDeviceVisionSignatureSet        = 0x3a8;
+    constexpr uint32_t vexDeviceVisionSignatureGet        = 0x3ac;
+    constexpr uint32_t vexDeviceVisionBrightnessSet       = 0x3b0;
+    constexpr uint32_t vexDeviceVisionBrightnessGet       = 0x3b4;
+    constexpr uint32_t vexDeviceVisionWhiteBalanceModeSet = 0x3b8;
+    constexpr uint32_t vexDeviceVisionWhiteBalanceModeGet = 0x3bc;
+    constexpr uint32_t vexDeviceVisionWhiteBalanceSet     = 0x3c0;
+    constexpr uint32_t vexDeviceVisionWhiteBalanceGet     = 0x3c4;
+    constexpr uint32_t vexDeviceVisionLedModeSet          = 0x3c8;
+    constexpr uint32_t vexDeviceVisionLedModeGet          = 0x3cc;
+    constexpr uint32_t vexDeviceVisionLedBrigntnessSet    = 0x3d0;
+    constexpr uint32_t vexDeviceVisionLedBrigntnessGet    = 0x3d4;
+    constexpr uint32_t vexDeviceVisionLedColorSet         = 0x3d8;
+    constexpr uint32_t vexDeviceVisionLedColorGet         = 0x3dc;
+    constexpr uint32_t vexDeviceVisionWifiModeSet         = 0x3e0;
+    constexpr uint32_t vexDeviceVisionWifiModeGet         = 0x3e4;
+    constexpr uint32_t vexDeviceImuReset                  = 0x410;
+    constexpr uint32_t vexDeviceImuHeadingGet             = 0x414;
+    constexpr uint32_t vexDeviceImuDegreesGet             = 0x418;
+    constexpr uint32_t vexDeviceImuQuaternionGet          = 0x41c;
+    constexpr uint32_t vexDeviceImuAttitudeGet            = 0x420;
+    constexpr uint32_t vexDeviceImuRawGyroGet             = 0x424;
+    constexpr uint32_t vexDeviceImuRawAccelGet            = 0x428;
+    constexpr uint32_t vexDeviceImuStatusGet              = 0x42c;
+    constexpr uint32_t vexDeviceImuTemperatureGet         = 0x430;
+    constexpr uint32_t vexDeviceImuDebugGet               = 0x434;
+    constexpr uint32_t vexDeviceImuModeSet                = 0x438;
+    constexpr uint32_t vexDeviceImuModeGet                = 0x43c;
+    constexpr uint32_t vexDeviceImuCollisionDataGet       = 0x440;
+    constexpr uint32_t vexDeviceImuDataRateSet            = 0x444;
+    constexpr uint32_t vexDeviceRadioUserDataReceive      = 0x460;
+    constexpr uint32_t vexDeviceRadioModeSet              = 0x464;
+    constexpr uint32_t vexDeviceAbsEncReset               = 0x488;
+    constexpr uint32_t vexDeviceAbsEncPositionSet         = 0x48c;
+    constexpr uint32_t vexDeviceAbsEncPositionGet         = 0x490;
+    constexpr uint32_t vexDeviceAbsEncVelocityGet         = 0x494;
+    constexpr uint32_t vexDeviceAbsEncAngleGet            = 0x498;
+    constexpr uint32_t vexDeviceAbsEncReverseFlagSet      = 0x49c;
+    constexpr uint32_t vexDeviceAbsEncReverseFlagGet      = 0x4a0;
+    constexpr uint32_t vexDeviceAbsEncStatusGet           = 0x4a4;
+    constexpr uint32_t vexDeviceAbsEncTemperatureGet      = 0x4a8;
+    constexpr uint32_t vexDeviceAbsEncDebugGet            = 0x4ac;
+    constexpr uint32_t vexDeviceAbsEncModeSet             = 0x4b0;
+    constexpr uint32_t vexDeviceAbsEncModeGet             = 0x4b4;
+    constexpr uint32_t vexDeviceAbsEncOffsetSet           = 0x4b8;
+    constexpr uint32_t vexDeviceAbsEncOffsetGet           = 0x4bc;
+    constexpr uint32_t vexDeviceAbsEncDataRateSet         = 0x4c0;
+    constexpr uint32_t vexDeviceRangeValueGet             = 0x4d8;
+    constexpr uint32_t vexDeviceDistanceDistanceGet       = 0x500;
+    constexpr uint32_t vexDeviceDistanceConfidenceGet     = 0x504;
+    constexpr uint32_t vexDeviceDistanceStatusGet         = 0x508;
+    constexpr uint32_t vexDeviceDistanceDebugGet          = 0x50c;
+    constexpr uint32_t vexDeviceDistanceModeSet           = 0x510;
+    constexpr uint32_t vexDeviceDistanceModeGet           = 0x514;
+    constexpr uint32_t vexDeviceDistanceObjectSizeGet     = 0x518;
+    constexpr uint32_t vexDeviceDistanceObjectVelocityGet = 0x51c;
+    constexpr uint32_t vexDeviceOpticalHueGet             = 0x528;
+    constexpr uint32_t vexDeviceOpticalSatGet             = 0x52c;
+    constexpr uint32_t vexDeviceOpticalBrightnessGet      = 0x530;
+    constexpr uint32_t vexDeviceOpticalProximityGet       = 0x534;
+    constexpr uint32_t vexDeviceOpticalRgbGet             = 0x538;
+    constexpr uint32_t vexDeviceOpticalLedPwmSet          = 0x53c;
+    constexpr uint32_t vexDeviceOpticalLedPwmGet          = 0x540;
+    constexpr uint32_t vexDeviceOpticalStatusGet          = 0x544;
+    constexpr uint32_t vexDeviceOpticalRawGet             = 0x548;
+    constexpr uint32_t vexDeviceOpticalDebugGet           = 0x54c;
+    constexpr uint32_t vexDeviceOpticalModeSet            = 0x550;
+    constexpr uint32_t vexDeviceOpticalModeGet            = 0x554;
+    constexpr uint32_t vexDeviceOpticalGestureGet         = 0x558;
+    constexpr uint32_t vexDeviceOpticalGestureEnable      = 0x55c;
+    constexpr uint32_t vexDeviceOpticalGestureDisable     = 0x560;
+    constexpr uint32_t vexDeviceOpticalProximityThreshold = 0x564;
+    constexpr uint32_t vexDeviceOpticalGainSet            = 0x568;
+    constexpr uint32_t vexDeviceOpticalMatrixSet          = 0x56c;
+    constexpr uint32_t vexDeviceOpticalMatrixGet          = 0x570;
+    constexpr uint32_t vexDeviceMagnetPowerSet            = 0x578;
+    constexpr uint32_t vexDeviceMagnetPowerGet            = 0x57c;
+    constexpr uint32_t vexDeviceMagnetPickup              = 0x580;
+    constexpr uint32_t vexDeviceMagnetDrop                = 0x584;
+    constexpr uint32_t vexDeviceMagnetTemperatureGet      = 0x588;
+    constexpr uint32_t vexDeviceMagnetCurrentGet          = 0x58c;
+    constexpr uint32_t vexDeviceMagnetStatusGet           = 0x590;
+    constexpr uint32_t vexDeviceMagnetDebugGet            = 0x594;
+    constexpr uint32_t vexDeviceMagnetModeSet             = 0x598;
+    constexpr uint32_t vexDeviceMagnetModeGet             = 0x59c;
+    constexpr uint32_t vexDeviceGpsReset                  = 0x5c8;
+    constexpr uint32_t vexDeviceGpsHeadingGet             = 0x5cc;
+    constexpr uint32_t vexDeviceGpsDegreesGet             = 0x5d0;
+    constexpr uint32_t vexDeviceGpsQuaternionGet          = 0x5d4;
+    constexpr uint32_t vexDeviceGpsAttitudeGet            = 0x5d8;
+    constexpr uint32_t vexDeviceGpsRawGyroGet             = 0x5dc;
+    constexpr uint32_t vexDeviceGpsRawAccelGet            = 0x5e0;
+    constexpr uint32_t vexDeviceGpsStatusGet              = 0x5e4;
+    constexpr uint32_t vexDeviceGpsTemperatureGet         = 0x5e8;
+    constexpr uint32_t vexDeviceGpsDebugGet               = 0x5ec;
+    constexpr uint32_t vexDeviceGpsModeSet                = 0x5f0;
+    constexpr uint32_t vexDeviceGpsModeGet                = 0x5f4;
+    constexpr uint32_t vexDeviceGpsDataRateSet            = 0x5f8;
+    constexpr uint32_t vexDeviceGpsOriginSet              = 0x5fc;
+    constexpr uint32_t vexDeviceGpsOriginGet              = 0x600;
+    constexpr uint32_t vexDeviceGpsRotationSet            = 0x604;
+    constexpr uint32_t vexDeviceGpsRotationGet            = 0x608;
+    constexpr uint32_t vexDeviceGpsInitialPositionSet     = 0x60c;
+    constexpr uint32_t vexDeviceGpsTestDataSet            = 0x610;
+    constexpr uint32_t vexDeviceGpsErrorGet               = 0x614;
+    constexpr uint32_t vexDisplayForegroundColor          = 0x640;
+    constexpr uint32_t vexDisplayBackgroundColor          = 0x644;
+    constexpr uint32_t vexDisplayErase                    = 0x648;
+    constexpr uint32_t vexDisplayScroll                   = 0x64c;
+    constexpr uint32_t vexDisplayScrollRect               = 0x650;
+    constexpr uint32_t vexDisplayCopyRect                 = 0x654;
+    constexpr uint32_t vexDisplayPixelSet                 = 0x658;
+    constexpr uint32_t vexDisplayPixelClear               = 0x65c;
+    constexpr uint32_t vexDisplayLineDraw                 = 0x660;
+    constexpr uint32_t vexDisplayLineClear                = 0x664;
+    constexpr uint32_t vexDisplayRectDraw                 = 0x668;
+    constexpr uint32_t vexDisplayRectClear                = 0x66c;
+    constexpr uint32_t vexDisplayRectFill                 = 0x670;
+    constexpr uint32_t vexDisplayCircleDraw               = 0x674;
+    constexpr uint32_t vexDisplayCircleClear              = 0x678;
+    constexpr uint32_t vexDisplayCircleFill               = 0x67c;
+    constexpr uint32_t vexDisplayVPrintf                  = 0x680;
+    constexpr uint32_t vexDisplayPrintf                   = 0x680;    // alias of vexDisplayVPrintf
+    constexpr uint32_t vexDisplayVString                  = 0x684;
+    constexpr uint32_t vexDisplayString                   = 0x684;    // alias of vexDisplayVString
+    constexpr uint32_t vexDisplayVStringAt                = 0x688;
+    constexpr uint32_t vexDisplayStringAt                 = 0x688;    // alias of vexDisplayVStringAt
+    constexpr uint32_t vexDisplayVBigString               = 0x68c;
+    constexpr uint32_t vexDisplayBigString                = 0x68c;    // alias of vexDisplayVBigString
+    constexpr uint32_t vexDisplayVBigStringAt             = 0x690;
+    constexpr uint32_t vexDisplayBigStringAt              = 0x690;    // alias of vexDisplayVBigStringAt
+    constexpr uint32_t vexDisplayVCenteredString          = 0x694;
+    constexpr uint32_t vexDisplayCenteredString           = 0x694;    // alias of vexDisplayVCenteredString
+    constexpr uint32_t vexDisplayVBigCenteredString       = 0x698;
+    constexpr uint32_t vexDisplayBigCenteredString        = 0x698;    // alias of vexDisplayVBigCenteredString
+    constexpr uint32_t vexDisplayTextSmoothing            = 0x69c;
+    constexpr uint32_t vexDisplayTextReference            = 0x6a0;
+    constexpr uint32_t vexDisplayScreenGrab               = 0x6a4;
+    constexpr uint32_t vexDisplayTextSize                 = 0x6a8;
+    constexpr uint32_t vexDisplayTextSpacing              = 0x6ac;
+    constexpr uint32_t vexDisplayVSmallStringAt           = 0x6b0;
+    constexpr uint32_t vexDisplaySmallStringAt            = 0x6b0;    // alias of vexDisplayVSmallStringAt
+    constexpr uint32_t vexDisplayFontNamedSet             = 0x6b4;
+    constexpr uint32_t vexDisplayForegroundColorGet       = 0x6b8;
+    constexpr uint32_t vexDisplayBackgroundColorGet       = 0x6bc;
+    constexpr uint32_t vexDisplayStringWidthGet           = 0x6c0;
+    constexpr uint32_t vexDisplayStringHeightGet          = 0x6c4;
+    constexpr uint32_t vexDisplayPenSizeSet               = 0x6c8;
+    constexpr uint32_t vexDisplayPenSizeGet               = 0x6cc;
+    constexpr uint32_t vexDisplayFontCustomSet            = 0x6d0;
+    constexpr uint32_t vexDisplayOrientation              = 0x780;
+    constexpr uint32_t vexDisplayLanguageSet              = 0x784;
+    constexpr uint32_t vexDisplayStringGet                = 0x788;
+    constexpr uint32_t vexDisplayClearVsyncState          = 0x78c;
+    constexpr uint32_t vexDisplayGetVsyncState            = 0x790;
+    constexpr uint32_t vexDisplayClipRegionSet            = 0x794;
+    constexpr uint32_t vexDisplayRotateFlagGet            = 0x798;
+    constexpr uint32_t vexDisplayThemeIdGet               = 0x79c;
+    constexpr uint32_t vexDisplayRender                   = 0x7a0;
+    constexpr uint32_t vexDisplayDoubleBufferDisable      = 0x7a4;
+    constexpr uint32_t vexDisplayClipRegionSetWithIndex   = 0x7a8;
+    constexpr uint32_t vexFileMountSD                     = 0x7d0;
+    constexpr uint32_t vexFileDirectoryGet                = 0x7d4;
+    constexpr uint32_t vexFileOpen                        = 0x7d8;
+    constexpr uint32_t vexFileOpenWrite                   = 0x7dc;
+    constexpr uint32_t vexFileOpenCreate                  = 0x7e0;
+    constexpr uint32_t vexFileClose                       = 0x7e4;
+    constexpr uint32_t vexFileWrite                       = 0x7ec;
+    constexpr uint32_t vexFileSize                        = 0x7f0;
+    constexpr uint32_t vexFileSeek                        = 0x7f4;
+    constexpr uint32_t vexFileRead                        = 0x7f8;
+    constexpr uint32_t vexFileDriveStatus                 = 0x7fc;
+    constexpr uint32_t vexFileTell                        = 0x800;
+    constexpr uint32_t vexFileSync                        = 0x804;
+    constexpr uint32_t vexFileStatus                      = 0x808;
+    constexpr uint32_t _write_user                        = 0x820;
+    constexpr uint32_t _read_user                         = 0x824;
+    constexpr uint32_t _open_user                         = 0x828;
+    constexpr uint32_t _close_user                        = 0x82c;
+    constexpr uint32_t _lseek_user                        = 0x830;
+    constexpr uint32_t _fstat_user                        = 0x834;
+    constexpr uint32_t _fcntl_user                        = 0x838;
+    constexpr uint32_t _isatty_user                       = 0x83c;
+    constexpr uint32_t vexSystemFileReopen                = 0x840;
+    constexpr uint32_t vexSerialWriteChar                 = 0x898;
+    constexpr uint32_t vexSerialWriteBuffer               = 0x89c;
+    constexpr uint32_t vexSerialReadChar                  = 0x8a0;
+    constexpr uint32_t vexSerialPeekChar                  = 0x8a4;
+    constexpr uint32_t vexSerialEnableRemoteConsole       = 0x8a8;
+    constexpr uint32_t vexSerialWriteFree                 = 0x8ac;
+    constexpr uint32_t vexSystemTimerStop                 = 0x8c0;
+    constexpr uint32_t vexSystemTimerClearInterrupt       = 0x8c4;
+    constexpr uint32_t vexSystemTimerReinitForRtos        = 0x8c8;
+    constexpr uint32_t vexSystemApplicationIRQHandler     = 0x8cc;
+    constexpr uint32_t vexSystemWatchdogReinitRtos        = 0x8d0;
+    constexpr uint32_t vexSystemWatchdogGet               = 0x8d4;
+    constexpr uint32_t vexSystemTimerCallbackInstall      = 0x8d8;
+    constexpr uint32_t vexSystemVSyncCallbackInstall      = 0x8dc;
+    constexpr uint32_t vexSystemBoot                      = 0x910;
+    constexpr uint32_t vexSystemUndefinedException        = 0x914;
+    constexpr uint32_t vexSystemFIQInterrupt              = 0x918;
+    constexpr uint32_t vexSystemIRQInterrupt              = 0x91c;
+    constexpr uint32_t vexSystemSWInterrupt               = 0x920;
+    constexpr uint32_t vexSystemDataAbortInterrupt        = 0x924;
+    constexpr uint32_t vexSystemPrefetchAbortInterrupt    = 0x928;
+    constexpr uint32_t vexTouchUserCallbackSet            = 0x960;
+    constexpr uint32_t vexTouchDataGet                    = 0x964;
+    constexpr uint32_t vexAssetsFind                      = 0x988;
+    constexpr uint32_t vexAssetsDump                      = 0x98c;
+    constexpr uint32_t vexImageBmpRead                    = 0x990;
+    constexpr uint32_t vexImagePngRead                    = 0x994;
+    constexpr uint32_t vexScratchMemoryLock               = 0x998;
+    constexpr uint32_t vexScratchMemoryUnlock             = 0x99c;
+    constexpr uint32_t vexSystemPdataSet                  = 0x9b0;
+    constexpr uint32_t vexSystemPdataGet                  = 0x9b4;
+    constexpr uint32_t vexSystemPdataIdGet                = 0x9b8;
+    constexpr uint32_t vexSystemPdataFlagsGet             = 0x9bc;
+    constexpr uint32_t vexSystemAppDataOptionsGet         = 0x9c0;
+    constexpr uint32_t vexSystemAppDataLinkAddrGet        = 0x9c4;
+    constexpr uint32_t vexSystemAppDataRes1Get            = 0x9c8;
+    constexpr uint32_t vexSystemAppExtendedDataGet        = 0x9cc;
+    constexpr uint32_t vexSystemAppDebugDataGet           = 0x9d0;
+    constexpr uint32_t vexCompetitionStatus               = 0x9d8;
+    constexpr uint32_t vexCompetitionControl              = 0x9dc;
+    constexpr uint32_t vexBatteryVoltageGet               = 0xa00;
+    constexpr uint32_t vexBatteryCurrentGet               = 0xa04;
+    constexpr uint32_t vexBatteryTemperatureGet           = 0xa08;
+    constexpr uint32_t vexBatteryCapacityGet              = 0xa0c;
+    constexpr uint32_t vexBatteryDataGet                  = 0xa10;
+    constexpr uint32_t vexBatteryDataSet                  = 0xa14;
+    constexpr uint32_t vexDeviceEventMaskSet              = 0xa28;
+    constexpr uint32_t vexDeviceEventMaskGet              = 0xa2c;
+    constexpr uint32_t vexDeviceEventDataSet              = 0xa30;
+    constexpr uint32_t vexDeviceEventDataGet              = 0xa34;
+    constexpr uint32_t vexDeviceEventBitsSet              = 0xa38;
+    constexpr uint32_t vexDeviceEventBitsGet              = 0xa3c;
+    constexpr uint32_t vexDeviceGenericSerialEnable       = 0xa50;
+    constexpr uint32_t vexDeviceGenericSerialBaudrate     = 0xa54;
+    constexpr uint32_t vexDeviceGenericSerialWriteChar    = 0xa58;
+    constexpr uint32_t vexDeviceGenericSerialWriteFree    = 0xa5c;
+    constexpr uint32_t vexDeviceGenericSerialTransmit     = 0xa60;
+    constexpr uint32_t vexDeviceGenericSerialReadChar     = 0xa64;
+    constexpr uint32_t vexDeviceGenericSerialPeekChar     = 0xa68;
+    constexpr uint32_t vexDeviceGenericSerialReceiveAvail = 0xa6c;
+    constexpr uint32_t vexDeviceGenericSerialReceive      = 0xa70;
+    constexpr uint32_t vexDeviceGenericSerialFlush        = 0xa74;
+    constexpr uint32_t vexDeviceGenericSerialDisableAll   = 0xa78;
+    constexpr uint32_t vexDeviceGenericSerialCdcRead      = 0xa7c;
+    constexpr uint32_t vexDeviceGenericRadioEnable        = 0xaa0;
+    constexpr uint32_t vexDeviceGenericRadioConnection    = 0xaa4;
+    constexpr uint32_t vexDeviceGenericRadioWriteChar     = 0xaa8;
+    constexpr uint32_t vexDeviceGenericRadioWriteFree     = 0xaac;
+    constexpr uint32_t vexDeviceGenericRadioTransmit      = 0xab0;
+    constexpr uint32_t vexDeviceGenericRadioReadChar      = 0xab4;
+    constexpr uint32_t vexDeviceGenericRadioPeekChar      = 0xab8;
+    constexpr uint32_t vexDeviceGenericRadioReceiveAvail  = 0xabc;
+    constexpr uint32_t vexDeviceGenericRadioReceive       = 0xac0;
+    constexpr uint32_t vexDeviceGenericRadioFlush         = 0xac4;
+    constexpr uint32_t vexDeviceGenericRadioLinkStatus    = 0xac8;
+    constexpr uint32_t vexDeviceGenericRadioDebugGet      = 0xacc;
+    constexpr uint32_t vexDeviceGenericCdcEnable          = 0xaf0;
+    constexpr uint32_t vexDeviceGenericCdcConnection      = 0xaf4;
+    constexpr uint32_t vexDeviceGenericCdcWriteChar       = 0xaf8;
+    constexpr uint32_t vexDeviceGenericCdcWriteFree       = 0xafc;
+    constexpr uint32_t vexDeviceGenericCdcTransmit        = 0xb00;
+    constexpr uint32_t vexDeviceGenericCdcReadChar        = 0xb04;
+    constexpr uint32_t vexDeviceGenericCdcPeekChar        = 0xb08;
+    constexpr uint32_t vexDeviceGenericCdcReceiveAvail    = 0xb0c;
+    constexpr uint32_t vexDeviceGenericCdcReceive         = 0xb10;
+    constexpr uint32_t vexDeviceGenericCdcFlush           = 0xb14;
+    constexpr uint32_t vexDeviceGenericCdcLinkStatus      = 0xb18;
+    constexpr uint32_t vexDeviceGenericCdcDebugGet        = 0xb1c;
+    constexpr uint32_t vexDeviceOpticalIntegrationTimeSet = 0xb40;
+    constexpr uint32_t vexDeviceOpticalIntegrationTimeGet = 0xb44;
+    constexpr uint32_t vexUnnamed_b68                     = 0xb68;
+    constexpr uint32_t vexUnnamed_b6c                     = 0xb6c;
+    constexpr uint32_t vexUnnamed_b70                     = 0xb70;
+    constexpr uint32_t vexUnnamed_b78                     = 0xb78;
+    constexpr uint32_t vexUnnamed_b7c                     = 0xb7c;
+    constexpr uint32_t vexUnnamed_b80                     = 0xb80;
+    constexpr uint32_t vexUnnamed_b84                     = 0xb84;
+    constexpr uint32_t vexUnnamed_b88                     = 0xb88;
+    constexpr uint32_t vexUnnamed_b8c                     = 0xb8c;
+    constexpr uint32_t vexUnnamed_b90                     = 0xb90;
+    constexpr uint32_t vexUnnamed_b94                     = 0xb94;
+    constexpr uint32_t vexUnnamed_b98                     = 0xb98;
+    constexpr uint32_t vexUnnamed_b9c                     = 0xb9c;
+    constexpr uint32_t vexUnnamed_ba0                     = 0xba0;
+    constexpr uint32_t vexUnnamed_ba4                     = 0xba4;
+    constexpr uint32_t vexUnnamed_ba8                     = 0xba8;
+    constexpr uint32_t vexUnnamed_bac                     = 0xbac;
+    constexpr uint32_t vexUnnamed_bb0                     = 0xbb0;
+    constexpr uint32_t vexUnnamed_bb4                     = 0xbb4;
+    constexpr uint32_t vexUnnamed_bb8                     = 0xbb8;
+    constexpr uint32_t vexUnnamed_bbc                     = 0xbbc;
+    constexpr uint32_t vexUnnamed_bc0                     = 0xbc0;
+    constexpr uint32_t vexGzipInflateBuffer               = 0xf00;
+    constexpr uint32_t vexGzipInflateBufferRaw            = 0xf04;
+    constexpr uint32_t vexCdc2Command                     = 0xf28;
+    constexpr uint32_t vexCdc2ReplyWithoutPacket          = 0xf2c;
+    constexpr uint32_t vexCdc2SendSimpleMessage           = 0xf30;
+    constexpr uint32_t vexCdc2SendExtMessage              = 0xf34;
+    constexpr uint32_t vexTaskAddWithArg                  = 0xf50;
+    constexpr uint32_t vexTaskAddWithPriorityWithArg      = 0xf54;
+    constexpr uint32_t vexTaskStopWithId                  = 0xf58;
+    constexpr uint32_t vexTaskSuspendWithId               = 0xf5c;
+    constexpr uint32_t vexTaskResumeWithId                = 0xf60;
+    constexpr uint32_t vexTaskPriorityGetWithId           = 0xf64;
+    constexpr uint32_t vexTaskPrioritySetWithId           = 0xf68;
+    constexpr uint32_t vexTaskStateGetWithId              = 0xf6c;
+    constexpr uint32_t vexTaskGetTaskIndexWithId          = 0xf70;
+    constexpr uint32_t vexBackgroundProcessing            = 0xf74;
+    constexpr uint32_t vexUnnamed_f78                     = 0xf78;
+    constexpr uint32_t vexTaskGet                         = 0xf7c;
+    constexpr uint32_t vexUnnamed_f80                     = 0xf80;
+    constexpr uint32_t vexSystemErrorMessageSet           = 0xf94;
+    constexpr uint32_t vexSystemFwUpdateRequest           = 0xf98;
+    constexpr uint32_t vexIntegrityCheck                  = 0xf9c;
+    constexpr uint32_t vexSystemStdlibImpurePtrAddr       = 0xfa0;
+    constexpr uint32_t vexSystemStdlibImpureDataAddr      = 0xfa4;
+    constexpr uint32_t vexSystemStdlibImpureDataSize      = 0xfa8;
+    constexpr uint32_t vexUnnamed_fac                     = 0xfac;
+    constexpr uint32_t vexUnnamed_ffc                     = 0xffc;
+
+    typedef struct _symbol {
+      const char   *name;
+      uint32_t      offset;
+    } symbol;
+
+    // every name above in strcmp order, variadic functions left out
+    constexpr uint32_t SYMBOL_COUNT = 476;
+    constexpr symbol   symbols[SYMBOL_COUNT] = {
+      { "_close_user",                        0x82c },
+      { "_fcntl_user",                        0x838 },
+      { "_fstat_user",                        0x834 },
+      { "_isatty_user",                       0x83c },
+      { "_lseek_user",                        0x830 },
+      { "_open_user",                         0x828 },
+      { "_read_user",                         0x824 },
+      { "_write_user",                        0x820 },
+      { "vexAssetsDump",                      0x98c },
+      { "vexAssetsFind",                      0x988 },
+      { "vexBackgroundProcessing",            0xf74 },
+      { "vexBatteryCapacityGet",              0xa0c },
+      { "vexBatteryCurrentGet",               0xa04 },
+      { "vexBatteryDataGet",                  0xa10 },
+      { "vexBatteryDataSet",                  0xa14 },
+      { "vexBatteryTemperatureGet",           0xa08 },
+      { "vexBatteryVoltageGet",               0xa00 },
+      { "vexBreak",                           0x0c8 },
+      { "vexCdc2Command",                     0xf28 },
+      { "vexCdc2ReplyWithoutPacket",          0xf2c },
+      { "vexCdc2SendExtMessage",              0xf34 },
+      { "vexCdc2SendSimpleMessage",           0xf30 },
+      { "vexCompetitionControl",              0x9dc },
+      { "vexCompetitionStatus",               0x9d8 },
+      { "vexControllerConnectionStatusGet",   0x1a8 },
+      { "vexControllerGet",                   0x1a4 },
+      { "vexControllerTextSet",               0x1ac },
+      { "vexDeviceAbsEncAngleGet",            0x498 },
+      { "vexDeviceAbsEncDataRateSet",         0x4c0 },
+      { "vexDeviceAbsEncDebugGet",            0x4ac },
+      { "vexDeviceAbsEncModeGet",             0x4b4 },
+      { "vexDeviceAbsEncModeSet",             0x4b0 },
+      { "vexDeviceAbsEncOffsetGet",           0x4bc },
+      { "vexDeviceAbsEncOffsetSet",           0x4b8 },
+      { "vexDeviceAbsEncPositionGet",         0x490 },
+      { "vexDeviceAbsEncPositionSet",         0x48c },
+      { "vexDeviceAbsEncReset",               0x488 },
+      { "vexDeviceAbsEncReverseFlagGet",      0x4a0 },
+      { "vexDeviceAbsEncReverseFlagSet",      0x49c },
+      { "vexDeviceAbsEncStatusGet",           0x4a4 },
+      { "vexDeviceAbsEncTemperatureGet",      0x4a8 },
+      { "vexDeviceAbsEncVelocityGet",         0x494 },
+      { "vexDeviceAdiPortConfigGet",          0x20c },
+      { "vexDeviceAdiPortConfigSet",          0x208 },
+      { "vexDeviceAdiValueGet",               0x214 },
+      { "vexDeviceAdiValueSet",               0x210 },
+      { "vexDeviceAdiVoltageGet",             0x218 },
+      { "vexDeviceBumperGet",                 0x230 },
+      { "vexDeviceButtonStateGet",            0x1b4 },
+      { "vexDeviceDatarateSet",               0x1c8 },
+      { "vexDeviceDistanceConfidenceGet",     0x504 },
+      { "vexDeviceDistanceDebugGet",          0x50c },
+      { "vexDeviceDistanceDistanceGet",       0x500 },
+      { "vexDeviceDistanceModeGet",           0x514 },
+      { "vexDeviceDistanceModeSet",           0x510 },
+      { "vexDeviceDistanceObjectSizeGet",     0x518 },
+      { "vexDeviceDistanceObjectVelocityGet", 0x51c },
+      { "vexDeviceDistanceStatusGet",         0x508 },
+      { "vexDeviceEventBitsGet",              0xa3c },
+      { "vexDeviceEventBitsSet",              0xa38 },
+      { "vexDeviceEventDataGet",              0xa34 },
+      { "vexDeviceEventDataSet",              0xa30 },
+      { "vexDeviceEventMaskGet",              0xa2c },
+      { "vexDeviceEventMaskSet",              0xa28 },
+      { "vexDeviceFlagsGetByIndex",           0x1d8 },
+      { "vexDeviceGenericCdcConnection",      0xaf4 },
+      { "vexDeviceGenericCdcDebugGet",        0xb1c },
+      { "vexDeviceGenericCdcEnable",          0xaf0 },
+      { "vexDeviceGenericCdcFlush",           0xb14 },
+      { "vexDeviceGenericCdcLinkStatus",      0xb18 },
+      { "vexDeviceGenericCdcPeekChar",        0xb08 },
+      { "vexDeviceGenericCdcReadChar",        0xb04 },
+      { "vexDeviceGenericCdcReceive",         0xb10 },
+      { "vexDeviceGenericCdcReceiveAvail",    0xb0c },
+      { "vexDeviceGenericCdcTransmit",        0xb00 },
+      { "vexDeviceGenericCdcWriteChar",       0xaf8 },
+      { "vexDeviceGenericCdcWriteFree",       0xafc },
+      { "vexDeviceGenericRadioConnection",    0xaa4 },
+      { "vexDeviceGenericRadioDebugGet",      0xacc },
+      { "vexDeviceGenericRadioEnable",        0xaa0 },
+      { "vexDeviceGenericRadioFlush",         0xac4 },
+      { "vexDeviceGenericRadioLinkStatus",    0xac8 },
+      { "vexDeviceGenericRadioPeekChar",      0xab8 },
+      { "vexDeviceGenericRadioReadChar",      0xab4 },
+      { "vexDeviceGenericRadioReceive",       0xac0 },
+      { "vexDeviceGenericRadioReceiveAvail",  0xabc },
+      { "vexDeviceGenericRadioTransmit",      0xab0 },
+      { "vexDeviceGenericRadioWriteChar",     0xaa8 },
+      { "vexDeviceGenericRadioWriteFree",     0xaac },
+      { "vexDeviceGenericSerialBaudrate",     0xa54 },
+      { "vexDeviceGenericSerialCdcRead",      0xa7c },
+      { "vexDeviceGenericSerialDisableAll",   0xa78 },
+      { "vexDeviceGenericSerialEnable",       0xa50 },
+      { "vexDeviceGenericSerialFlush",        0xa74 },
+      { "vexDeviceGenericSerialPeekChar",     0xa68 },
+      { "vexDeviceGenericSerialReadChar",     0xa64 },
+      { "vexDeviceGenericSerialReceive",      0xa70 },
+      { "vexDeviceGenericSerialReceiveAvail", 0xa6c },
+      { "vexDeviceGenericSerialTransmit",     0xa60 },
+      { "vexDeviceGenericSerialWriteChar",    0xa58 },
+      { "vexDeviceGenericSerialWriteFree",    0xa5c },
+      { "vexDeviceGenericValueGet",           0x2a8 },
+      { "vexDeviceGetByIndex",                0x19c },
+      { "vexDeviceGetStatus",                 0x1a0 },
+      { "vexDeviceGetTimestamp",              0x1b0 },
+      { "vexDeviceGpsAttitudeGet",            0x5d8 },
+      { "vexDeviceGpsDataRateSet",            0x5f8 },
+      { "vexDeviceGpsDebugGet",               0x5ec },
+      { "vexDeviceGpsDegreesGet",             0x5d0 },
+      { "vexDeviceGpsErrorGet",               0x614 },
+      { "vexDeviceGpsHeadingGet",             0x5cc },
+      { "vexDeviceGpsInitialPositionSet",     0x60c },
+      { "vexDeviceGpsModeGet",                0x5f4 },
+      { "vexDeviceGpsModeSet",                0x5f0 },
+      { "vexDeviceGpsOriginGet",              0x600 },
+      { "vexDeviceGpsOriginSet",              0x5fc },
+      { "vexDeviceGpsQuaternionGet",          0x5d4 },
+      { "vexDeviceGpsRawAccelGet",            0x5e0 },
+      { "vexDeviceGpsRawGyroGet",             0x5dc },
+      { "vexDeviceGpsReset",                  0x5c8 },
+      { "vexDeviceGpsRotationGet",            0x608 },
+      { "vexDeviceGpsRotationSet",            0x604 },
+      { "vexDeviceGpsStatusGet",              0x5e4 },
+      { "vexDeviceGpsTemperatureGet",         0x5e8 },
+      { "vexDeviceGpsTestDataSet",            0x610 },
+      { "vexDeviceGyroDegreesGet",            0x260 },
+      { "vexDeviceGyroHeadingGet",            0x25c },
+      { "vexDeviceGyroReset",                 0x258 },
+      { "vexDeviceImuAttitudeGet",            0x420 },
+      { "vexDeviceImuCollisionDataGet",       0x440 },
+      { "vexDeviceImuDataRateSet",            0x444 },
+      { "vexDeviceImuDebugGet",               0x434 },
+      { "vexDeviceImuDegreesGet",             0x418 },
+      { "vexDeviceImuHeadingGet",             0x414 },
+      { "vexDeviceImuModeGet",                0x43c },
+      { "vexDeviceImuModeSet",                0x438 },
+      { "vexDeviceImuQuaternionGet",          0x41c },
+      { "vexDeviceImuRawAccelGet",            0x428 },
+      { "vexDeviceImuRawGyroGet",             0x424 },
+      { "vexDeviceImuReset",                  0x410 },
+      { "vexDeviceImuStatusGet",              0x42c },
+      { "vexDeviceImuTemperatureGet",         0x430 },
+      { "vexDeviceLedGet",                    0x1e8 },
+      { "vexDeviceLedRgbGet",                 0x1ec },
+      { "vexDeviceLedRgbSet",                 0x1e4 },
+      { "vexDeviceLedSet",                    0x1e0 },
+      { "vexDeviceMagnetCurrentGet",          0x58c },
+      { "vexDeviceMagnetDebugGet",            0x594 },
+      { "vexDeviceMagnetDrop",                0x584 },
+      { "vexDeviceMagnetModeGet",             0x59c },
+      { "vexDeviceMagnetModeSet",             0x598 },
+      { "vexDeviceMagnetPickup",              0x580 },
+      { "vexDeviceMagnetPowerGet",            0x57c },
+      { "vexDeviceMagnetPowerSet",            0x578 },
+      { "vexDeviceMagnetStatusGet",           0x590 },
+      { "vexDeviceMagnetTemperatureGet",      0x588 },
+      { "vexDeviceMotorAbsoluteTargetSet",    0x34c },
+      { "vexDeviceMotorActualVelocityGet",    0x2d8 },
+      { "vexDeviceMotorBrakeModeGet",         0x330 },
+      { "vexDeviceMotorBrakeModeSet",         0x32c },
+      { "vexDeviceMotorCurrentGet",           0x2f8 },
+      { "vexDeviceMotorCurrentLimitFlagGet",  0x310 },
+      { "vexDeviceMotorCurrentLimitGet",      0x2f4 },
+      { "vexDeviceMotorCurrentLimitSet",      0x2f0 },
+      { "vexDeviceMotorDirectionGet",         0x2dc },
+      { "vexDeviceMotorEfficiencyGet",        0x304 },
+      { "vexDeviceMotorEncoderUnitsGet",      0x328 },
+      { "vexDeviceMotorEncoderUnitsSet",      0x324 },
+      { "vexDeviceMotorExternalProfileSet",   0x380 },
+      { "vexDeviceMotorFaultsGet",            0x354 },
+      { "vexDeviceMotorFlagsGet",             0x358 },
+      { "vexDeviceMotorGearingGet",           0x368 },
+      { "vexDeviceMotorGearingSet",           0x364 },
+      { "vexDeviceMotorModeGet",              0x2e4 },
+      { "vexDeviceMotorModeSet",              0x2e0 },
+      { "vexDeviceMotorOverTempFlagGet",      0x30c },
+      { "vexDeviceMotorPositionGet",          0x338 },
+      { "vexDeviceMotorPositionPidSet",       0x378 },
+      { "vexDeviceMotorPositionRawGet",       0x33c },
+      { "vexDeviceMotorPositionReset",        0x340 },
+      { "vexDeviceMotorPositionSet",          0x334 },
+      { "vexDeviceMotorPowerGet",             0x2fc },
+      { "vexDeviceMotorPwmGet",               0x2ec },
+      { "vexDeviceMotorPwmSet",               0x2e8 },
+      { "vexDeviceMotorRelativeTargetSet",    0x350 },
+      { "vexDeviceMotorReverseFlagGet",       0x320 },
+      { "vexDeviceMotorReverseFlagSet",       0x31c },
+      { "vexDeviceMotorServoTargetSet",       0x348 },
+      { "vexDeviceMotorTargetGet",            0x344 },
+      { "vexDeviceMotorTemperatureGet",       0x308 },
+      { "vexDeviceMotorTorqueGet",            0x300 },
+      { "vexDeviceMotorVelocityGet",          0x2d4 },
+      { "vexDeviceMotorVelocityPidSet",       0x37c },
+      { "vexDeviceMotorVelocitySet",          0x2d0 },
+      { "vexDeviceMotorVelocityUpdate",       0x374 },
+      { "vexDeviceMotorVoltageGet",           0x360 },
+      { "vexDeviceMotorVoltageLimitGet",      0x370 },
+      { "vexDeviceMotorVoltageLimitSet",      0x36c },
+      { "vexDeviceMotorVoltageSet",           0x35c },
+      { "vexDeviceMotorZeroPositionFlagGet",  0x318 },
+      { "vexDeviceMotorZeroVelocityFlagGet",  0x314 },
+      { "vexDeviceOpticalBrightnessGet",      0x530 },
+      { "vexDeviceOpticalDebugGet",           0x54c },
+      { "vexDeviceOpticalGainSet",            0x568 },
+      { "vexDeviceOpticalGestureDisable",     0x560 },
+      { "vexDeviceOpticalGestureEnable",      0x55c },
+      { "vexDeviceOpticalGestureGet",         0x558 },
+      { "vexDeviceOpticalHueGet",             0x528 },
+      { "vexDeviceOpticalIntegrationTimeGet", 0xb44 },
+      { "vexDeviceOpticalIntegrationTimeSet", 0xb40 },
+      { "vexDeviceOpticalLedPwmGet",          0x540 },
+      { "vexDeviceOpticalLedPwmSet",          0x53c },
+      { "vexDeviceOpticalMatrixGet",          0x570 },
+      { "vexDeviceOpticalMatrixSet",          0x56c },
+      { "vexDeviceOpticalModeGet",            0x554 },
+      { "vexDeviceOpticalModeSet",            0x550 },
+      { "vexDeviceOpticalProximityGet",       0x534 },
+      { "vexDeviceOpticalProximityThreshold", 0x564 },
+      { "vexDeviceOpticalRawGet",             0x548 },
+      { "vexDeviceOpticalRgbGet",             0x538 },
+      { "vexDeviceOpticalSatGet",             0x52c },
+      { "vexDeviceOpticalStatusGet",          0x544 },
+      { "vexDeviceRadioModeSet",              0x464 },
+      { "vexDeviceRadioUserDataReceive",      0x460 },
+      { "vexDeviceRangeValueGet",             0x4d8 },
+      { "vexDeviceSonarValueGet",             0x280 },
+      { "vexDeviceTimerDump",                 0x1d4 },
+      { "vexDeviceTimerSet",                  0x1cc },
+      { "vexDeviceTimerSetWithArg",           0x1d0 },
+      { "vexDeviceTypeGetByIndex",            0x1b8 },
+      { "vexDeviceTypeSetByIndex",            0x1bc },
+      { "vexDeviceValueGetByIndex",           0x1c0 },
+      { "vexDeviceValueSetByIndex",           0x1c4 },
+      { "vexDeviceVisionBrightnessGet",       0x3b4 },
+      { "vexDeviceVisionBrightnessSet",       0x3b0 },
+      { "vexDeviceVisionLedBrigntnessGet",    0x3d4 },
+      { "vexDeviceVisionLedBrigntnessSet",    0x3d0 },
+      { "vexDeviceVisionLedColorGet",         0x3dc },
+      { "vexDeviceVisionLedColorSet",         0x3d8 },
+      { "vexDeviceVisionLedModeGet",          0x3cc },
+      { "vexDeviceVisionLedModeSet",          0x3c8 },
+      { "vexDeviceVisionModeGet",             0x39c },
+      { "vexDeviceVisionModeSet",             0x398 },
+      { "vexDeviceVisionObjectCountGet",      0x3a0 },
+      { "vexDeviceVisionObjectGet",           0x3a4 },
+      { "vexDeviceVisionSignatureGet",        0x3ac },
+      { "vexDeviceVisionSignatureSet",        0x3a8 },
+      { "vexDeviceVisionWhiteBalanceGet",     0x3c4 },
+      { "vexDeviceVisionWhiteBalanceModeGet", 0x3bc },
+      { "vexDeviceVisionWhiteBalanceModeSet", 0x3b8 },
+      { "vexDeviceVisionWhiteBalanceSet",     0x3c0 },
+      { "vexDeviceVisionWifiModeGet",         0x3e4 },
+      { "vexDeviceVisionWifiModeSet",         0x3e0 },
+      { "vexDevicesGet",                      0x198 },
+      { "vexDevicesGetNumber",                0x190 },
+      { "vexDevicesGetNumberByType",          0x194 },
+      { "vexDisplayBackgroundColor",          0x644 },
+      { "vexDisplayBackgroundColorGet",       0x6bc },
+      { "vexDisplayCircleClear",              0x678 },
+      { "vexDisplayCircleDraw",               0x674 },
+      { "vexDisplayCircleFill",               0x67c },
+      { "vexDisplayClearVsyncState",          0x78c },
+      { "vexDisplayClipRegionSet",            0x794 },
+      { "vexDisplayClipRegionSetWithIndex",   0x7a8 },
+      { "vexDisplayCopyRect",                 0x654 },
+      { "vexDisplayDoubleBufferDisable",      0x7a4 },
+      { "vexDisplayErase",                    0x648 },
+      { "vexDisplayFontCustomSet",            0x6d0 },
+      { "vexDisplayFontNamedSet",             0x6b4 },
+      { "vexDisplayForegroundColor",          0x640 },
+      { "vexDisplayForegroundColorGet",       0x6b8 },
+      { "vexDisplayGetVsyncState",            0x790 },
+      { "vexDisplayLanguageSet",              0x784 },
+      { "vexDisplayLineClear",                0x664 },
+      { "vexDisplayLineDraw",                 0x660 },
+      { "vexDisplayOrientation",              0x780 },
+      { "vexDisplayPenSizeGet",               0x6cc },
+      { "vexDisplayPenSizeSet",               0x6c8 },
+      { "vexDisplayPixelClear",               0x65c },
+      { "vexDisplayPixelSet",                 0x658 },
+      { "vexDisplayRectClear",                0x66c },
+      { "vexDisplayRectDraw",                 0x668 },
+      { "vexDisplayRectFill",                 0x670 },
+      { "vexDisplayRender",                   0x7a0 },
+      { "vexDisplayRotateFlagGet",            0x798 },
+      { "vexDisplayScreenGrab",               0x6a4 },
+      { "vexDisplayScroll",                   0x64c },
+      { "vexDisplayScrollRect",               0x650 },
+      { "vexDisplayStringGet",                0x788 },
+      { "vexDisplayStringHeightGet",          0x6c4 },
+      { "vexDisplayStringWidthGet",           0x6c0 },
+      { "vexDisplayTextReference",            0x6a0 },
+      { "vexDisplayTextSize",                 0x6a8 },
+      { "vexDisplayTextSmoothing",            0x69c },
+      { "vexDisplayTextSpacing",              0x6ac },
+      { "vexDisplayThemeIdGet",               0x79c },
+      { "vexDisplayVBigCenteredString",       0x698 },
+      { "vexDisplayVBigString",               0x68c },
+      { "vexDisplayVBigStringAt",             0x690 },
+      { "vexDisplayVCenteredString",          0x694 },
+      { "vexDisplayVPrintf",                  0x680 },
+      { "vexDisplayVSmallStringAt",           0x6b0 },
+      { "vexDisplayVString",                  0x684 },
+      { "vexDisplayVStringAt",                0x688 },
+      { "vexEventAdd",                        0x0a8 },
+      { "vexEventAddWithArg",                 0x0b0 },
+      { "vexEventBroadcast",                  0x0a4 },
+      { "vexEventBroadcastAndWait",           0x0a0 },
+      { "vexEventGetArg",                     0x0bc },
+      { "vexEventUserIndexGet",               0x0ac },
+      { "vexEventsCleanup",                   0x0b4 },
+      { "vexEventsDump",                      0x0b8 },
+      { "vexEventsGetCount",                  0x0c4 },
+      { "vexEventsGetMax",                    0x0c0 },
+      { "vexFileClose",                       0x7e4 },
+      { "vexFileDirectoryGet",                0x7d4 },
+      { "vexFileDriveStatus",                 0x7fc },
+      { "vexFileMountSD",                     0x7d0 },
+      { "vexFileOpen",                        0x7d8 },
+      { "vexFileOpenCreate",                  0x7e0 },
+      { "vexFileOpenWrite",                   0x7dc },
+      { "vexFileRead",                        0x7f8 },
+      { "vexFileSeek",                        0x7f4 },
+      { "vexFileSize",                        0x7f0 },
+      { "vexFileStatus",                      0x808 },
+      { "vexFileSync",                        0x804 },
+      { "vexFileTell",                        0x800 },
+      { "vexFileWrite",                       0x7ec },
+      { "vexGetdate",                         0x120 },
+      { "vexGettime",                         0x11c },
+      { "vexGzipInflateBuffer",               0xf00 },
+      { "vexGzipInflateBufferRaw",            0xf04 },
+      { "vexImageBmpRead",                    0x990 },
+      { "vexImagePngRead",                    0x994 },
+      { "vexIntegrityCheck",                  0xf9c },
+      { "vexPrivateApiDisable",               0x020 },
+      { "vexPrivateApiEnable",                0x024 },
+      { "vexScratchMemoryLock",               0x998 },
+      { "vexScratchMemoryPtr",                0x01c },
+      { "vexScratchMemoryUnlock",             0x99c },
+      { "vexSemaphoreGetOwner",               0x07c },
+      { "vexSemaphoreInit",                   0x070 },
+      { "vexSemaphoreLock",                   0x074 },
+      { "vexSemaphoreUnlock",                 0x078 },
+      { "vexSerialEnableRemoteConsole",       0x8a8 },
+      { "vexSerialPeekChar",                  0x8a4 },
+      { "vexSerialReadChar",                  0x8a0 },
+      { "vexSerialWriteBuffer",               0x89c },
+      { "vexSerialWriteChar",                 0x898 },
+      { "vexSerialWriteFree",                 0x8ac },
+      { "vexStdlibMismatchError",             0x010 },
+      { "vexSystemAppDataLinkAddrGet",        0x9c4 },
+      { "vexSystemAppDataOptionsGet",         0x9c0 },
+      { "vexSystemAppDataRes1Get",            0x9c8 },
+      { "vexSystemAppDebugDataGet",           0x9d0 },
+      { "vexSystemAppExtendedDataGet",        0x9cc },
+      { "vexSystemApplicationIRQHandler",     0x8cc },
+      { "vexSystemBoot",                      0x910 },
+      { "vexSystemDataAbortInterrupt",        0x924 },
+      { "vexSystemDigitalIO",                 0x128 },
+      { "vexSystemErrorMessageSet",           0xf94 },
+      { "vexSystemExitRequest",               0x130 },
+      { "vexSystemFIQInterrupt",              0x918 },
+      { "vexSystemFileReopen",                0x840 },
+      { "vexSystemFwUpdateRequest",           0xf98 },
+      { "vexSystemHighResTimeGet",            0x134 },
+      { "vexSystemIRQInterrupt",              0x91c },
+      { "vexSystemLinkAddrGet",               0x13c },
+      { "vexSystemMemoryDump",                0x124 },
+      { "vexSystemPdataFlagsGet",             0x9bc },
+      { "vexSystemPdataGet",                  0x9b4 },
+      { "vexSystemPdataIdGet",                0x9b8 },
+      { "vexSystemPdataSet",                  0x9b0 },
+      { "vexSystemPowerupTimeGet",            0x138 },
+      { "vexSystemPrefetchAbortInterrupt",    0x928 },
+      { "vexSystemSWInterrupt",               0x920 },
+      { "vexSystemStartupOptions",            0x12c },
+      { "vexSystemStdlibImpureDataAddr",      0xfa4 },
+      { "vexSystemStdlibImpureDataSize",      0xfa8 },
+      { "vexSystemStdlibImpurePtrAddr",       0xfa0 },
+      { "vexSystemTimeGet",                   0x118 },
+      { "vexSystemTimerCallbackInstall",      0x8d8 },
+      { "vexSystemTimerClearInterrupt",       0x8c4 },
+      { "vexSystemTimerDisable",              0x170 },
+      { "vexSystemTimerEnable",               0x16c },
+      { "vexSystemTimerGet",                  0x168 },
+      { "vexSystemTimerReinitForRtos",        0x8c8 },
+      { "vexSystemTimerStop",                 0x8c0 },
+      { "vexSystemUndefinedException",        0x914 },
+      { "vexSystemUsbStatus",                 0x174 },
+      { "vexSystemVSyncCallbackInstall",      0x8dc },
+      { "vexSystemWatchdogGet",               0x8d4 },
+      { "vexSystemWatchdogReinitRtos",        0x8d0 },
+      { "vexTaskAdd",                         0x028 },
+      { "vexTaskAddSimple",                   0x030 },
+      { "vexTaskAddSimpleWithPriority",       0x034 },
+      { "vexTaskAddWithArg",                  0xf50 },
+      { "vexTaskAddWithPriority",             0x02c },
+      { "vexTaskAddWithPriorityWithArg",      0xf54 },
+      { "vexTaskBreakpointDump",              0x0d0 },
+      { "vexTaskBreakpointSet",               0x0cc },
+      { "vexTaskCheckTimeslice",              0x064 },
+      { "vexTaskCompletionIdSet",             0x144 },
+      { "vexTaskFree",                        0x158 },
+      { "vexTaskGet",                         0xf7c },
+      { "vexTaskGetArgs",                     0x15c },
+      { "vexTaskGetCallback",                 0x084 },
+      { "vexTaskGetCallbackAndId",            0x084 },
+      { "vexTaskGetIndex",                    0x068 },
+      { "vexTaskGetTaskIndex",                0x090 },
+      { "vexTaskGetTaskIndexWithId",          0xf70 },
+      { "vexTaskHardwareConcurrency",         0x140 },
+      { "vexTaskPriorityGet",                 0x054 },
+      { "vexTaskPriorityGetWithId",           0xf64 },
+      { "vexTaskPrioritySet",                 0x058 },
+      { "vexTaskPrioritySetWithId",           0xf68 },
+      { "vexTaskProgramResume",               0x050 },
+      { "vexTaskProgramSuspend",              0x04c },
+      { "vexTaskRemoveAllUser",               0x09c },
+      { "vexTaskResume",                      0x040 },
+      { "vexTaskResumeCurrent",               0x048 },
+      { "vexTaskResumeWithId",                0xf60 },
+      { "vexTaskSetArgs",                     0x160 },
+      { "vexTaskSleep",                       0x06c },
+      { "vexTaskStackDefaultSizeGet",         0x14c },
+      { "vexTaskStackSizeGet",                0x148 },
+      { "vexTaskStackTopGet",                 0x154 },
+      { "vexTaskStackUseGet",                 0x150 },
+      { "vexTaskStateGet",                    0x08c },
+      { "vexTaskStateGetWithId",              0xf6c },
+      { "vexTaskStop",                        0x038 },
+      { "vexTaskStopAll",                     0x094 },
+      { "vexTaskStopAllUser",                 0x098 },
+      { "vexTaskStopWithId",                  0xf58 },
+      { "vexTaskSuspend",                     0x03c },
+      { "vexTaskSuspendCurrent",              0x044 },
+      { "vexTaskSuspendWithId",               0xf5c },
+      { "vexTaskWaitForExit",                 0x088 },
+      { "vexTaskWaitForExitWithId",           0x088 },
+      { "vexTaskYield",                       0x060 },
+      { "vexTasksDump",                       0x080 },
+      { "vexTasksRun",                        0x05c },
+      { "vexTouchDataGet",                    0x964 },
+      { "vexTouchUserCallbackSet",            0x960 },
+      { "vexUnnamed_000",                     0x000 },
+      { "vexUnnamed_004",                     0x004 },
+      { "vexUnnamed_018",                     0x018 },
+      { "vexUnnamed_21c",                     0x21c },
+      { "vexUnnamed_b68",                     0xb68 },
+      { "vexUnnamed_b6c",                     0xb6c },
+      { "vexUnnamed_b70",                     0xb70 },
+      { "vexUnnamed_b78",                     0xb78 },
+      { "vexUnnamed_b7c",                     0xb7c },
+      { "vexUnnamed_b80",                     0xb80 },
+      { "vexUnnamed_b84",                     0xb84 },
+      { "vexUnnamed_b88",                     0xb88 },
+      { "vexUnnamed_b8c",                     0xb8c },
+      { "vexUnnamed_b90",                     0xb90 },
+      { "vexUnnamed_b94",                     0xb94 },
+      { "vexUnnamed_b98",                     0xb98 },
+      { "vexUnnamed_b9c",                     0xb9c },
+      { "vexUnnamed_ba0",                     0xba0 },
+      { "vexUnnamed_ba4",                     0xba4 },
+      { "vexUnnamed_ba8",                     0xba8 },
+      { "vexUnnamed_bac",                     0xbac },
+      { "vexUnnamed_bb0",                     0xbb0 },
+      { "vexUnnamed_bb4",                     0xbb4 },
+      { "vexUnnamed_bb8",                     0xbb8 },
+      { "vexUnnamed_bbc",                     0xbbc },
+      { "vexUnnamed_bc0",                     0xbc0 },
+      { "vexUnnamed_f78",                     0xf78 },
+      { "vexUnnamed_f80",                     0xf80 },
+      { "vexUnnamed_fac",                     0xfac },
+      { "vexUnnamed_ffc",                     0xffc },
+      { "vex_vsnprintf",                      0x0f8 },
+      { "vex_vsprintf",                       0x0f4 },
+    };
+  };
+
+  namespace fast {
+    template <typename F>
+    [[gnu::always_inline]] inline F slot( uint32_t offset ) {
+      return( reinterpret_cast<F>( *reinterpret_cast<void * const *>( offsets::TABLE_BASE + offset ) ) );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexScratchMemoryPtr( void **ptr ) {
+      return slot<int32_t (*)( void **ptr )>( offsets::vexScratchMemoryPtr )( ptr );
+    }
+
+    [[gnu::always_inline]] inline int32_t vex_vsprintf( char *out, const char *format, va_list args ) {
+      return slot<int32_t (*)( char *out, const char *format, va_list args )>( offsets::vex_vsprintf )( out, format, args );
+    }
+
+    [[gnu::always_inline]] inline int32_t vex_vsnprintf( char *out, uint32_t max_len, const char *format, va_list args ) {
+      return slot<int32_t (*)( char *out, uint32_t max_len, const char *format, va_list args )>( offsets::vex_vsnprintf )( out, max_len, format, args );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexSystemTimeGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexSystemTimeGet )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexGettime( struct time *pTime ) {
+      slot<void (*)( struct time *pTime )>( offsets::vexGettime )( pTime );
+    }
+
+    [[gnu::always_inline]] inline void vexGetdate( struct date *pDate ) {
+      slot<void (*)( struct date *pDate )>( offsets::vexGetdate )( pDate );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemMemoryDump( void ) {
+      slot<void (*)( void )>( offsets::vexSystemMemoryDump )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemDigitalIO( uint32_t pin, uint32_t value ) {
+      slot<void (*)( uint32_t pin, uint32_t value )>( offsets::vexSystemDigitalIO )( pin, value );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexSystemStartupOptions( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexSystemStartupOptions )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemExitRequest( void ) {
+      slot<void (*)( void )>( offsets::vexSystemExitRequest )(  );
+    }
+
+    [[gnu::always_inline]] inline uint64_t vexSystemHighResTimeGet( void ) {
+      return slot<uint64_t (*)( void )>( offsets::vexSystemHighResTimeGet )(  );
+    }
+
+    [[gnu::always_inline]] inline uint64_t vexSystemPowerupTimeGet( void ) {
+      return slot<uint64_t (*)( void )>( offsets::vexSystemPowerupTimeGet )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexSystemLinkAddrGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexSystemLinkAddrGet )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexSystemUsbStatus( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexSystemUsbStatus )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDevicesGetNumber( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexDevicesGetNumber )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDevicesGetNumberByType( V5_DeviceType type ) {
+      return slot<uint32_t (*)( V5_DeviceType type )>( offsets::vexDevicesGetNumberByType )( type );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceT vexDevicesGet( void ) {
+      return slot<V5_DeviceT (*)( void )>( offsets::vexDevicesGet )(  );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceT vexDeviceGetByIndex( uint32_t index ) {
+      return slot<V5_DeviceT (*)( uint32_t index )>( offsets::vexDeviceGetByIndex )( index );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGetStatus( V5_DeviceType *buffer ) {
+      return slot<int32_t (*)( V5_DeviceType *buffer )>( offsets::vexDeviceGetStatus )( buffer );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexControllerGet( V5_ControllerId id, V5_ControllerIndex index ) {
+      return slot<int32_t (*)( V5_ControllerId id, V5_ControllerIndex index )>( offsets::vexControllerGet )( id, index );
+    }
+
+    [[gnu::always_inline]] inline V5_ControllerStatus vexControllerConnectionStatusGet( V5_ControllerId id ) {
+      return slot<V5_ControllerStatus (*)( V5_ControllerId id )>( offsets::vexControllerConnectionStatusGet )( id );
+    }
+
+    [[gnu::always_inline]] inline bool vexControllerTextSet( V5_ControllerId id, uint32_t line, uint32_t col, const char *str ) {
+      return slot<bool (*)( V5_ControllerId id, uint32_t line, uint32_t col, const char *str )>( offsets::vexControllerTextSet )( id, line, col, str );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGetTimestamp( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGetTimestamp )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceButtonStateGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexDeviceButtonStateGet )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceLedSet( V5_DeviceT device, V5_DeviceLedColor value ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceLedColor value )>( offsets::vexDeviceLedSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceLedRgbSet( V5_DeviceT device, uint32_t color ) {
+      slot<void (*)( V5_DeviceT device, uint32_t color )>( offsets::vexDeviceLedRgbSet )( device, color );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceLedColor vexDeviceLedGet( V5_DeviceT device ) {
+      return slot<V5_DeviceLedColor (*)( V5_DeviceT device )>( offsets::vexDeviceLedGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceLedRgbGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceLedRgbGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAdiPortConfigSet( V5_DeviceT device, uint32_t port, V5_AdiPortConfiguration type ) {
+      slot<void (*)( V5_DeviceT device, uint32_t port, V5_AdiPortConfiguration type )>( offsets::vexDeviceAdiPortConfigSet )( device, port, type );
+    }
+
+    [[gnu::always_inline]] inline V5_AdiPortConfiguration vexDeviceAdiPortConfigGet( V5_DeviceT device, uint32_t port ) {
+      return slot<V5_AdiPortConfiguration (*)( V5_DeviceT device, uint32_t port )>( offsets::vexDeviceAdiPortConfigGet )( device, port );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAdiValueSet( V5_DeviceT device, uint32_t port, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, uint32_t port, int32_t value )>( offsets::vexDeviceAdiValueSet )( device, port, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceAdiValueGet( V5_DeviceT device, uint32_t port ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint32_t port )>( offsets::vexDeviceAdiValueGet )( device, port );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceBumperState vexDeviceBumperGet( V5_DeviceT device ) {
+      return slot<V5_DeviceBumperState (*)( V5_DeviceT device )>( offsets::vexDeviceBumperGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGyroReset( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceGyroReset )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGyroHeadingGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGyroHeadingGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGyroDegreesGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGyroDegreesGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceSonarValueGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceSonarValueGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericValueGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGenericValueGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorVelocitySet( V5_DeviceT device, int32_t velocity ) {
+      slot<void (*)( V5_DeviceT device, int32_t velocity )>( offsets::vexDeviceMotorVelocitySet )( device, velocity );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorVelocityGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorVelocityGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorActualVelocityGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorActualVelocityGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorDirectionGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorDirectionGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorModeSet( V5_DeviceT device, V5MotorControlMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5MotorControlMode mode )>( offsets::vexDeviceMotorModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5MotorControlMode vexDeviceMotorModeGet( V5_DeviceT device ) {
+      return slot<V5MotorControlMode (*)( V5_DeviceT device )>( offsets::vexDeviceMotorModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorPwmSet( V5_DeviceT device, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceMotorPwmSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorPwmGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorPwmGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorCurrentLimitSet( V5_DeviceT device, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceMotorCurrentLimitSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorCurrentLimitGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorCurrentLimitGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorCurrentGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorCurrentGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorPowerGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorPowerGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorTorqueGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorTorqueGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorEfficiencyGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorEfficiencyGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorTemperatureGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorTemperatureGet )( device );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceMotorOverTempFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceMotorOverTempFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceMotorCurrentLimitFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceMotorCurrentLimitFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceMotorZeroVelocityFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceMotorZeroVelocityFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceMotorZeroPositionFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceMotorZeroPositionFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorReverseFlagSet( V5_DeviceT device, bool value ) {
+      slot<void (*)( V5_DeviceT device, bool value )>( offsets::vexDeviceMotorReverseFlagSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceMotorReverseFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceMotorReverseFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorEncoderUnitsSet( V5_DeviceT device, V5MotorEncoderUnits units ) {
+      slot<void (*)( V5_DeviceT device, V5MotorEncoderUnits units )>( offsets::vexDeviceMotorEncoderUnitsSet )( device, units );
+    }
+
+    [[gnu::always_inline]] inline V5MotorEncoderUnits vexDeviceMotorEncoderUnitsGet( V5_DeviceT device ) {
+      return slot<V5MotorEncoderUnits (*)( V5_DeviceT device )>( offsets::vexDeviceMotorEncoderUnitsGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorBrakeModeSet( V5_DeviceT device, V5MotorBrakeMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5MotorBrakeMode mode )>( offsets::vexDeviceMotorBrakeModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5MotorBrakeMode vexDeviceMotorBrakeModeGet( V5_DeviceT device ) {
+      return slot<V5MotorBrakeMode (*)( V5_DeviceT device )>( offsets::vexDeviceMotorBrakeModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorPositionSet( V5_DeviceT device, double position ) {
+      slot<void (*)( V5_DeviceT device, double position )>( offsets::vexDeviceMotorPositionSet )( device, position );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorPositionGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorPositionGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorPositionRawGet( V5_DeviceT device, uint32_t *timestamp ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint32_t *timestamp )>( offsets::vexDeviceMotorPositionRawGet )( device, timestamp );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorPositionReset( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceMotorPositionReset )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMotorTargetGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMotorTargetGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorServoTargetSet( V5_DeviceT device, double position ) {
+      slot<void (*)( V5_DeviceT device, double position )>( offsets::vexDeviceMotorServoTargetSet )( device, position );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorAbsoluteTargetSet( V5_DeviceT device, double position, int32_t velocity ) {
+      slot<void (*)( V5_DeviceT device, double position, int32_t velocity )>( offsets::vexDeviceMotorAbsoluteTargetSet )( device, position, velocity );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorRelativeTargetSet( V5_DeviceT device, double position, int32_t velocity ) {
+      slot<void (*)( V5_DeviceT device, double position, int32_t velocity )>( offsets::vexDeviceMotorRelativeTargetSet )( device, position, velocity );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceMotorFaultsGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorFaultsGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceMotorFlagsGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorFlagsGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorVoltageSet( V5_DeviceT device, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceMotorVoltageSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorVoltageGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorVoltageGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorGearingSet( V5_DeviceT device, V5MotorGearset value ) {
+      slot<void (*)( V5_DeviceT device, V5MotorGearset value )>( offsets::vexDeviceMotorGearingSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline V5MotorGearset vexDeviceMotorGearingGet( V5_DeviceT device ) {
+      return slot<V5MotorGearset (*)( V5_DeviceT device )>( offsets::vexDeviceMotorGearingGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorVoltageLimitSet( V5_DeviceT device, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceMotorVoltageLimitSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMotorVoltageLimitGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMotorVoltageLimitGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorVelocityUpdate( V5_DeviceT device, int32_t velocity ) {
+      slot<void (*)( V5_DeviceT device, int32_t velocity )>( offsets::vexDeviceMotorVelocityUpdate )( device, velocity );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorPositionPidSet( V5_DeviceT device, V5_DeviceMotorPid *pid ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceMotorPid *pid )>( offsets::vexDeviceMotorPositionPidSet )( device, pid );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorVelocityPidSet( V5_DeviceT device, V5_DeviceMotorPid *pid ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceMotorPid *pid )>( offsets::vexDeviceMotorVelocityPidSet )( device, pid );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMotorExternalProfileSet( V5_DeviceT device, double position, int32_t velocity ) {
+      slot<void (*)( V5_DeviceT device, double position, int32_t velocity )>( offsets::vexDeviceMotorExternalProfileSet )( device, position, velocity );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionModeSet( V5_DeviceT device, V5VisionMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5VisionMode mode )>( offsets::vexDeviceVisionModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5VisionMode vexDeviceVisionModeGet( V5_DeviceT device ) {
+      return slot<V5VisionMode (*)( V5_DeviceT device )>( offsets::vexDeviceVisionModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceVisionObjectCountGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceVisionObjectCountGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceVisionObjectGet( V5_DeviceT device, uint32_t indexObj, V5_DeviceVisionObject *pObject ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint32_t indexObj, V5_DeviceVisionObject *pObject )>( offsets::vexDeviceVisionObjectGet )( device, indexObj, pObject );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionSignatureSet( V5_DeviceT device, V5_DeviceVisionSignature *pSignature ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceVisionSignature *pSignature )>( offsets::vexDeviceVisionSignatureSet )( device, pSignature );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceVisionSignatureGet( V5_DeviceT device, uint32_t id, V5_DeviceVisionSignature *pSignature ) {
+      return slot<bool (*)( V5_DeviceT device, uint32_t id, V5_DeviceVisionSignature *pSignature )>( offsets::vexDeviceVisionSignatureGet )( device, id, pSignature );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionBrightnessSet( V5_DeviceT device, uint8_t percent ) {
+      slot<void (*)( V5_DeviceT device, uint8_t percent )>( offsets::vexDeviceVisionBrightnessSet )( device, percent );
+    }
+
+    [[gnu::always_inline]] inline uint8_t vexDeviceVisionBrightnessGet( V5_DeviceT device ) {
+      return slot<uint8_t (*)( V5_DeviceT device )>( offsets::vexDeviceVisionBrightnessGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionWhiteBalanceModeSet( V5_DeviceT device, V5VisionWBMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5VisionWBMode mode )>( offsets::vexDeviceVisionWhiteBalanceModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5VisionWBMode vexDeviceVisionWhiteBalanceModeGet( V5_DeviceT device ) {
+      return slot<V5VisionWBMode (*)( V5_DeviceT device )>( offsets::vexDeviceVisionWhiteBalanceModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionWhiteBalanceSet( V5_DeviceT device, V5_DeviceVisionRgb color ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceVisionRgb color )>( offsets::vexDeviceVisionWhiteBalanceSet )( device, color );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceVisionRgb vexDeviceVisionWhiteBalanceGet( V5_DeviceT device ) {
+      return slot<V5_DeviceVisionRgb (*)( V5_DeviceT device )>( offsets::vexDeviceVisionWhiteBalanceGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionLedModeSet( V5_DeviceT device, V5VisionLedMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5VisionLedMode mode )>( offsets::vexDeviceVisionLedModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5VisionLedMode vexDeviceVisionLedModeGet( V5_DeviceT device ) {
+      return slot<V5VisionLedMode (*)( V5_DeviceT device )>( offsets::vexDeviceVisionLedModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionLedBrigntnessSet( V5_DeviceT device, uint8_t percent ) {
+      slot<void (*)( V5_DeviceT device, uint8_t percent )>( offsets::vexDeviceVisionLedBrigntnessSet )( device, percent );
+    }
+
+    [[gnu::always_inline]] inline uint8_t vexDeviceVisionLedBrigntnessGet( V5_DeviceT device ) {
+      return slot<uint8_t (*)( V5_DeviceT device )>( offsets::vexDeviceVisionLedBrigntnessGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionLedColorSet( V5_DeviceT device, V5_DeviceVisionRgb color ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceVisionRgb color )>( offsets::vexDeviceVisionLedColorSet )( device, color );
+    }
+
+    [[gnu::always_inline]] inline V5_DeviceVisionRgb vexDeviceVisionLedColorGet( V5_DeviceT device ) {
+      return slot<V5_DeviceVisionRgb (*)( V5_DeviceT device )>( offsets::vexDeviceVisionLedColorGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceVisionWifiModeSet( V5_DeviceT device, V5VisionWifiMode mode ) {
+      slot<void (*)( V5_DeviceT device, V5VisionWifiMode mode )>( offsets::vexDeviceVisionWifiModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline V5VisionWifiMode vexDeviceVisionWifiModeGet( V5_DeviceT device ) {
+      return slot<V5VisionWifiMode (*)( V5_DeviceT device )>( offsets::vexDeviceVisionWifiModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuReset( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceImuReset )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceImuHeadingGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceImuHeadingGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceImuDegreesGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceImuDegreesGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuQuaternionGet( V5_DeviceT device, V5_DeviceImuQuaternion *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceImuQuaternion *data )>( offsets::vexDeviceImuQuaternionGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuAttitudeGet( V5_DeviceT device, V5_DeviceImuAttitude *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceImuAttitude *data )>( offsets::vexDeviceImuAttitudeGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuRawGyroGet( V5_DeviceT device, V5_DeviceImuRaw *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceImuRaw *data )>( offsets::vexDeviceImuRawGyroGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuRawAccelGet( V5_DeviceT device, V5_DeviceImuRaw *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceImuRaw *data )>( offsets::vexDeviceImuRawAccelGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceImuStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceImuStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuModeSet( V5_DeviceT device, uint32_t mode ) {
+      slot<void (*)( V5_DeviceT device, uint32_t mode )>( offsets::vexDeviceImuModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceImuModeGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceImuModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceImuDataRateSet( V5_DeviceT device, uint32_t rate ) {
+      slot<void (*)( V5_DeviceT device, uint32_t rate )>( offsets::vexDeviceImuDataRateSet )( device, rate );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAbsEncReset( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncReset )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAbsEncPositionSet( V5_DeviceT device, int32_t position ) {
+      slot<void (*)( V5_DeviceT device, int32_t position )>( offsets::vexDeviceAbsEncPositionSet )( device, position );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceAbsEncPositionGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncPositionGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceAbsEncVelocityGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncVelocityGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceAbsEncAngleGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncAngleGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAbsEncReverseFlagSet( V5_DeviceT device, bool value ) {
+      slot<void (*)( V5_DeviceT device, bool value )>( offsets::vexDeviceAbsEncReverseFlagSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline bool vexDeviceAbsEncReverseFlagGet( V5_DeviceT device ) {
+      return slot<bool (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncReverseFlagGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceAbsEncStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceAbsEncStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceAbsEncDataRateSet( V5_DeviceT device, uint32_t rate ) {
+      slot<void (*)( V5_DeviceT device, uint32_t rate )>( offsets::vexDeviceAbsEncDataRateSet )( device, rate );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceRangeValueGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceRangeValueGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceDistanceDistanceGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceDistanceDistanceGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceDistanceConfidenceGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceDistanceConfidenceGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceDistanceStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceDistanceStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceDistanceObjectSizeGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceDistanceObjectSizeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceDistanceObjectVelocityGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceDistanceObjectVelocityGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceOpticalHueGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalHueGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceOpticalSatGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalSatGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceOpticalBrightnessGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalBrightnessGet )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceOpticalProximityGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalProximityGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalRgbGet( V5_DeviceT device, V5_DeviceOpticalRgb *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceOpticalRgb *data )>( offsets::vexDeviceOpticalRgbGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalLedPwmSet( V5_DeviceT device, int32_t value ) {
+      slot<void (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceOpticalLedPwmSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceOpticalLedPwmGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalLedPwmGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceOpticalStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalRawGet( V5_DeviceT device, V5_DeviceOpticalRaw *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceOpticalRaw *data )>( offsets::vexDeviceOpticalRawGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalModeSet( V5_DeviceT device, uint32_t mode ) {
+      slot<void (*)( V5_DeviceT device, uint32_t mode )>( offsets::vexDeviceOpticalModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceOpticalModeGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceOpticalGestureGet( V5_DeviceT a0, V5_DeviceOpticalGesture *pData ) {
+      return slot<uint32_t (*)( V5_DeviceT a0, V5_DeviceOpticalGesture *pData )>( offsets::vexDeviceOpticalGestureGet )( a0, pData );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalGestureEnable( V5_DeviceT a0 ) {
+      slot<void (*)( V5_DeviceT a0 )>( offsets::vexDeviceOpticalGestureEnable )( a0 );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalGestureDisable( V5_DeviceT a0 ) {
+      slot<void (*)( V5_DeviceT a0 )>( offsets::vexDeviceOpticalGestureDisable )( a0 );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceOpticalProximityThreshold( V5_DeviceT device, int32_t value ) {
+      return slot<int32_t (*)( V5_DeviceT device, int32_t value )>( offsets::vexDeviceOpticalProximityThreshold )( device, value );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMagnetPowerSet( V5_DeviceT device, int32_t value, int32_t time ) {
+      slot<void (*)( V5_DeviceT device, int32_t value, int32_t time )>( offsets::vexDeviceMagnetPowerSet )( device, value, time );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceMagnetPowerGet( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMagnetPowerGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMagnetPickup( V5_DeviceT device, V5_DeviceMagnetDuration duration ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceMagnetDuration duration )>( offsets::vexDeviceMagnetPickup )( device, duration );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceMagnetDrop( V5_DeviceT device, V5_DeviceMagnetDuration duration ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceMagnetDuration duration )>( offsets::vexDeviceMagnetDrop )( device, duration );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMagnetTemperatureGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMagnetTemperatureGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceMagnetCurrentGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceMagnetCurrentGet )( device );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceMagnetStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceMagnetStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsReset( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceGpsReset )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGpsHeadingGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGpsHeadingGet )( device );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGpsDegreesGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGpsDegreesGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsQuaternionGet( V5_DeviceT device, V5_DeviceGpsQuaternion *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceGpsQuaternion *data )>( offsets::vexDeviceGpsQuaternionGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsAttitudeGet( V5_DeviceT device, V5_DeviceGpsAttitude *data, bool bRaw ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceGpsAttitude *data, bool bRaw )>( offsets::vexDeviceGpsAttitudeGet )( device, data, bRaw );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsRawGyroGet( V5_DeviceT device, V5_DeviceGpsRaw *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceGpsRaw *data )>( offsets::vexDeviceGpsRawGyroGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsRawAccelGet( V5_DeviceT device, V5_DeviceGpsRaw *data ) {
+      slot<void (*)( V5_DeviceT device, V5_DeviceGpsRaw *data )>( offsets::vexDeviceGpsRawAccelGet )( device, data );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceGpsStatusGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGpsStatusGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsModeSet( V5_DeviceT device, uint32_t mode ) {
+      slot<void (*)( V5_DeviceT device, uint32_t mode )>( offsets::vexDeviceGpsModeSet )( device, mode );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDeviceGpsModeGet( V5_DeviceT device ) {
+      return slot<uint32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGpsModeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsDataRateSet( V5_DeviceT device, uint32_t rate ) {
+      slot<void (*)( V5_DeviceT device, uint32_t rate )>( offsets::vexDeviceGpsDataRateSet )( device, rate );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsOriginSet( V5_DeviceT device, double ox, double oy ) {
+      slot<void (*)( V5_DeviceT device, double ox, double oy )>( offsets::vexDeviceGpsOriginSet )( device, ox, oy );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsOriginGet( V5_DeviceT device, double *ox, double *oy ) {
+      slot<void (*)( V5_DeviceT device, double *ox, double *oy )>( offsets::vexDeviceGpsOriginGet )( device, ox, oy );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsRotationSet( V5_DeviceT device, double value ) {
+      slot<void (*)( V5_DeviceT device, double value )>( offsets::vexDeviceGpsRotationSet )( device, value );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGpsRotationGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGpsRotationGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGpsInitialPositionSet( V5_DeviceT device, double initial_x, double initial_y, double initial_rotation ) {
+      slot<void (*)( V5_DeviceT device, double initial_x, double initial_y, double initial_rotation )>( offsets::vexDeviceGpsInitialPositionSet )( device, initial_x, initial_y, initial_rotation );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceGpsErrorGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceGpsErrorGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayForegroundColor( uint32_t col ) {
+      slot<void (*)( uint32_t col )>( offsets::vexDisplayForegroundColor )( col );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayBackgroundColor( uint32_t col ) {
+      slot<void (*)( uint32_t col )>( offsets::vexDisplayBackgroundColor )( col );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayErase( void ) {
+      slot<void (*)( void )>( offsets::vexDisplayErase )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayScroll( int32_t nStartLine, int32_t nLines ) {
+      slot<void (*)( int32_t nStartLine, int32_t nLines )>( offsets::vexDisplayScroll )( nStartLine, nLines );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayScrollRect( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t nLines ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t nLines )>( offsets::vexDisplayScrollRect )( x1, y1, x2, y2, nLines );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayCopyRect( int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t *pSrc, int32_t srcStride ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t *pSrc, int32_t srcStride )>( offsets::vexDisplayCopyRect )( x1, y1, x2, y2, pSrc, srcStride );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayPixelSet( uint32_t x, uint32_t y ) {
+      slot<void (*)( uint32_t x, uint32_t y )>( offsets::vexDisplayPixelSet )( x, y );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayPixelClear( uint32_t x, uint32_t y ) {
+      slot<void (*)( uint32_t x, uint32_t y )>( offsets::vexDisplayPixelClear )( x, y );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayLineDraw( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayLineDraw )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayLineClear( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayLineClear )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayRectDraw( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayRectDraw )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayRectClear( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayRectClear )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayRectFill( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayRectFill )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayCircleDraw( int32_t xc, int32_t yc, int32_t radius ) {
+      slot<void (*)( int32_t xc, int32_t yc, int32_t radius )>( offsets::vexDisplayCircleDraw )( xc, yc, radius );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayCircleClear( int32_t xc, int32_t yc, int32_t radius ) {
+      slot<void (*)( int32_t xc, int32_t yc, int32_t radius )>( offsets::vexDisplayCircleClear )( xc, yc, radius );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayCircleFill( int32_t xc, int32_t yc, int32_t radius ) {
+      slot<void (*)( int32_t xc, int32_t yc, int32_t radius )>( offsets::vexDisplayCircleFill )( xc, yc, radius );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVPrintf( int32_t xpos, int32_t ypos, uint32_t bOpaque, const char *format, va_list args ) {
+      slot<void (*)( int32_t xpos, int32_t ypos, uint32_t bOpaque, const char *format, va_list args )>( offsets::vexDisplayVPrintf )( xpos, ypos, bOpaque, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVString( const int32_t nLineNumber, const char *format, va_list args ) {
+      slot<void (*)( const int32_t nLineNumber, const char *format, va_list args )>( offsets::vexDisplayVString )( nLineNumber, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVStringAt( int32_t xpos, int32_t ypos, const char *format, va_list args ) {
+      slot<void (*)( int32_t xpos, int32_t ypos, const char *format, va_list args )>( offsets::vexDisplayVStringAt )( xpos, ypos, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVBigString( const int32_t nLineNumber, const char *format, va_list args ) {
+      slot<void (*)( const int32_t nLineNumber, const char *format, va_list args )>( offsets::vexDisplayVBigString )( nLineNumber, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVBigStringAt( int32_t xpos, int32_t ypos, const char *format, va_list args ) {
+      slot<void (*)( int32_t xpos, int32_t ypos, const char *format, va_list args )>( offsets::vexDisplayVBigStringAt )( xpos, ypos, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVCenteredString( const int32_t nLineNumber, const char *format, va_list args ) {
+      slot<void (*)( const int32_t nLineNumber, const char *format, va_list args )>( offsets::vexDisplayVCenteredString )( nLineNumber, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVBigCenteredString( const int32_t nLineNumber, const char *format, va_list args ) {
+      slot<void (*)( const int32_t nLineNumber, const char *format, va_list args )>( offsets::vexDisplayVBigCenteredString )( nLineNumber, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayTextSize( uint32_t n, uint32_t d ) {
+      slot<void (*)( uint32_t n, uint32_t d )>( offsets::vexDisplayTextSize )( n, d );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayVSmallStringAt( int32_t xpos, int32_t ypos, const char *format, va_list args ) {
+      slot<void (*)( int32_t xpos, int32_t ypos, const char *format, va_list args )>( offsets::vexDisplayVSmallStringAt )( xpos, ypos, format, args );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayFontNamedSet( const char *pFontName ) {
+      slot<void (*)( const char *pFontName )>( offsets::vexDisplayFontNamedSet )( pFontName );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDisplayForegroundColorGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexDisplayForegroundColorGet )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexDisplayBackgroundColorGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexDisplayBackgroundColorGet )(  );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDisplayStringWidthGet( const char *pString ) {
+      return slot<int32_t (*)( const char *pString )>( offsets::vexDisplayStringWidthGet )( pString );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDisplayStringHeightGet( const char *pString ) {
+      return slot<int32_t (*)( const char *pString )>( offsets::vexDisplayStringHeightGet )( pString );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayClipRegionSet( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {
+      slot<void (*)( int32_t x1, int32_t y1, int32_t x2, int32_t y2 )>( offsets::vexDisplayClipRegionSet )( x1, y1, x2, y2 );
+    }
+
+    [[gnu::always_inline]] inline bool vexDisplayRender( bool bVsyncWait, bool bRunScheduler ) {
+      return slot<bool (*)( bool bVsyncWait, bool bRunScheduler )>( offsets::vexDisplayRender )( bVsyncWait, bRunScheduler );
+    }
+
+    [[gnu::always_inline]] inline void vexDisplayDoubleBufferDisable( void ) {
+      slot<void (*)( void )>( offsets::vexDisplayDoubleBufferDisable )(  );
+    }
+
+    [[gnu::always_inline]] inline FRESULT vexFileMountSD( void ) {
+      return slot<FRESULT (*)( void )>( offsets::vexFileMountSD )(  );
+    }
+
+    [[gnu::always_inline]] inline FRESULT vexFileDirectoryGet( const char *path, char *buffer, uint32_t len ) {
+      return slot<FRESULT (*)( const char *path, char *buffer, uint32_t len )>( offsets::vexFileDirectoryGet )( path, buffer, len );
+    }
+
+    [[gnu::always_inline]] inline FIL * vexFileOpen( const char *filename, const char *mode ) {
+      return slot<FIL * (*)( const char *filename, const char *mode )>( offsets::vexFileOpen )( filename, mode );
+    }
+
+    [[gnu::always_inline]] inline FIL * vexFileOpenWrite( const char *filename ) {
+      return slot<FIL * (*)( const char *filename )>( offsets::vexFileOpenWrite )( filename );
+    }
+
+    [[gnu::always_inline]] inline FIL * vexFileOpenCreate( const char *filename ) {
+      return slot<FIL * (*)( const char *filename )>( offsets::vexFileOpenCreate )( filename );
+    }
+
+    [[gnu::always_inline]] inline void vexFileClose( FIL *fdp ) {
+      slot<void (*)( FIL *fdp )>( offsets::vexFileClose )( fdp );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexFileWrite( char *buf, uint32_t size, uint32_t nItems, FIL *fdp ) {
+      return slot<int32_t (*)( char *buf, uint32_t size, uint32_t nItems, FIL *fdp )>( offsets::vexFileWrite )( buf, size, nItems, fdp );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexFileSize( FIL *fdp ) {
+      return slot<int32_t (*)( FIL *fdp )>( offsets::vexFileSize )( fdp );
+    }
+
+    [[gnu::always_inline]] inline FRESULT vexFileSeek( FIL *fdp, uint32_t offset, int32_t whence ) {
+      return slot<FRESULT (*)( FIL *fdp, uint32_t offset, int32_t whence )>( offsets::vexFileSeek )( fdp, offset, whence );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexFileRead( char *buf, uint32_t size, uint32_t nItems, FIL *fdp ) {
+      return slot<int32_t (*)( char *buf, uint32_t size, uint32_t nItems, FIL *fdp )>( offsets::vexFileRead )( buf, size, nItems, fdp );
+    }
+
+    [[gnu::always_inline]] inline bool vexFileDriveStatus( uint32_t drive ) {
+      return slot<bool (*)( uint32_t drive )>( offsets::vexFileDriveStatus )( drive );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexFileTell( FIL *fdp ) {
+      return slot<int32_t (*)( FIL *fdp )>( offsets::vexFileTell )( fdp );
+    }
+
+    [[gnu::always_inline]] inline void vexFileSync( FIL *fdp ) {
+      slot<void (*)( FIL *fdp )>( offsets::vexFileSync )( fdp );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexFileStatus( const char *filename ) {
+      return slot<uint32_t (*)( const char *filename )>( offsets::vexFileStatus )( filename );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSerialWriteChar( uint32_t channel, uint8_t c ) {
+      return slot<int32_t (*)( uint32_t channel, uint8_t c )>( offsets::vexSerialWriteChar )( channel, c );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSerialWriteBuffer( uint32_t channel, uint8_t *data, uint32_t data_len ) {
+      return slot<int32_t (*)( uint32_t channel, uint8_t *data, uint32_t data_len )>( offsets::vexSerialWriteBuffer )( channel, data, data_len );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSerialReadChar( uint32_t channel ) {
+      return slot<int32_t (*)( uint32_t channel )>( offsets::vexSerialReadChar )( channel );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSerialPeekChar( uint32_t channel ) {
+      return slot<int32_t (*)( uint32_t channel )>( offsets::vexSerialPeekChar )( channel );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSerialWriteFree( uint32_t channel ) {
+      return slot<int32_t (*)( uint32_t channel )>( offsets::vexSerialWriteFree )( channel );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemTimerStop( void ) {
+      slot<void (*)( void )>( offsets::vexSystemTimerStop )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemTimerClearInterrupt( void ) {
+      slot<void (*)( void )>( offsets::vexSystemTimerClearInterrupt )(  );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSystemTimerReinitForRtos( uint32_t priority, void (*handler)(void *data) ) {
+      return slot<int32_t (*)( uint32_t priority, void (*handler)(void *data) )>( offsets::vexSystemTimerReinitForRtos )( priority, handler );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemApplicationIRQHandler( uint32_t ulICCIAR ) {
+      slot<void (*)( uint32_t ulICCIAR )>( offsets::vexSystemApplicationIRQHandler )( ulICCIAR );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexSystemWatchdogReinitRtos( void ) {
+      return slot<int32_t (*)( void )>( offsets::vexSystemWatchdogReinitRtos )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexSystemWatchdogGet( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexSystemWatchdogGet )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemBoot( void ) {
+      slot<void (*)( void )>( offsets::vexSystemBoot )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemUndefinedException( void ) {
+      slot<void (*)( void )>( offsets::vexSystemUndefinedException )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemFIQInterrupt( void ) {
+      slot<void (*)( void )>( offsets::vexSystemFIQInterrupt )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemSWInterrupt( void ) {
+      slot<void (*)( void )>( offsets::vexSystemSWInterrupt )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemDataAbortInterrupt( void ) {
+      slot<void (*)( void )>( offsets::vexSystemDataAbortInterrupt )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexSystemPrefetchAbortInterrupt( void ) {
+      slot<void (*)( void )>( offsets::vexSystemPrefetchAbortInterrupt )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexTouchUserCallbackSet( void (* callback)(V5_TouchEvent, int32_t, int32_t) ) {
+      slot<void (*)( void (* callback)(V5_TouchEvent, int32_t, int32_t) )>( offsets::vexTouchUserCallbackSet )( callback );
+    }
+
+    [[gnu::always_inline]] inline bool vexTouchDataGet( V5_TouchStatus *status ) {
+      return slot<bool (*)( V5_TouchStatus *status )>( offsets::vexTouchDataGet )( status );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexImageBmpRead( const uint8_t *ibuf, v5_image *oBuf, uint32_t maxw, uint32_t maxh ) {
+      return slot<uint32_t (*)( const uint8_t *ibuf, v5_image *oBuf, uint32_t maxw, uint32_t maxh )>( offsets::vexImageBmpRead )( ibuf, oBuf, maxw, maxh );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexImagePngRead( const uint8_t *ibuf, v5_image *oBuf, uint32_t maxw, uint32_t maxh, uint32_t ibuflen ) {
+      return slot<uint32_t (*)( const uint8_t *ibuf, v5_image *oBuf, uint32_t maxw, uint32_t maxh, uint32_t ibuflen )>( offsets::vexImagePngRead )( ibuf, oBuf, maxw, maxh, ibuflen );
+    }
+
+    [[gnu::always_inline]] inline bool vexScratchMemoryLock( void ) {
+      return slot<bool (*)( void )>( offsets::vexScratchMemoryLock )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexScratchMemoryUnlock( void ) {
+      slot<void (*)( void )>( offsets::vexScratchMemoryUnlock )(  );
+    }
+
+    [[gnu::always_inline]] inline uint32_t vexCompetitionStatus( void ) {
+      return slot<uint32_t (*)( void )>( offsets::vexCompetitionStatus )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexCompetitionControl( uint32_t data ) {
+      slot<void (*)( uint32_t data )>( offsets::vexCompetitionControl )( data );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexBatteryVoltageGet( void ) {
+      return slot<int32_t (*)( void )>( offsets::vexBatteryVoltageGet )(  );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexBatteryCurrentGet( void ) {
+      return slot<int32_t (*)( void )>( offsets::vexBatteryCurrentGet )(  );
+    }
+
+    [[gnu::always_inline]] inline double vexBatteryTemperatureGet( void ) {
+      return slot<double (*)( void )>( offsets::vexBatteryTemperatureGet )(  );
+    }
+
+    [[gnu::always_inline]] inline double vexBatteryCapacityGet( void ) {
+      return slot<double (*)( void )>( offsets::vexBatteryCapacityGet )(  );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGenericSerialEnable( V5_DeviceT device, int32_t options ) {
+      slot<void (*)( V5_DeviceT device, int32_t options )>( offsets::vexDeviceGenericSerialEnable )( device, options );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGenericSerialBaudrate( V5_DeviceT device, int32_t baudrate ) {
+      slot<void (*)( V5_DeviceT device, int32_t baudrate )>( offsets::vexDeviceGenericSerialBaudrate )( device, baudrate );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialWriteChar( V5_DeviceT device, uint8_t c ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint8_t c )>( offsets::vexDeviceGenericSerialWriteChar )( device, c );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialWriteFree( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGenericSerialWriteFree )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialTransmit( V5_DeviceT device, uint8_t *buffer, int32_t length ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint8_t *buffer, int32_t length )>( offsets::vexDeviceGenericSerialTransmit )( device, buffer, length );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialReadChar( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGenericSerialReadChar )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialPeekChar( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGenericSerialPeekChar )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialReceiveAvail( V5_DeviceT device ) {
+      return slot<int32_t (*)( V5_DeviceT device )>( offsets::vexDeviceGenericSerialReceiveAvail )( device );
+    }
+
+    [[gnu::always_inline]] inline int32_t vexDeviceGenericSerialReceive( V5_DeviceT device, uint8_t *buffer, int32_t length ) {
+      return slot<int32_t (*)( V5_DeviceT device, uint8_t *buffer, int32_t length )>( offsets::vexDeviceGenericSerialReceive )( device, buffer, length );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceGenericSerialFlush( V5_DeviceT device ) {
+      slot<void (*)( V5_DeviceT device )>( offsets::vexDeviceGenericSerialFlush )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexDeviceOpticalIntegrationTimeSet( V5_DeviceT device, double timeMs ) {
+      slot<void (*)( V5_DeviceT device, double timeMs )>( offsets::vexDeviceOpticalIntegrationTimeSet )( device, timeMs );
+    }
+
+    [[gnu::always_inline]] inline double vexDeviceOpticalIntegrationTimeGet( V5_DeviceT device ) {
+      return slot<double (*)( V5_DeviceT device )>( offsets::vexDeviceOpticalIntegrationTimeGet )( device );
+    }
+
+    [[gnu::always_inline]] inline void vexBackgroundProcessing( void ) {
+      slot<void (*)( void )>( offsets::vexBackgroundProcessing )(  );
+    }
+  };
+};
+
+#endif // VEX_THUNKS_H
@@ -27,4 +27,19 @@
 #include "vex_smartdrive.h"
 #include "vex_vexlink.h"
 #include "vex_roboticarm.h"
+#include "vex_holonomic.h"
+#include "vex_sysid.h"
+#include "vex_pidtuner.h"
+#include "vex_estimator.h"
+#include "vex_flywheel.h"
+#include "vex_thermalmodel.h"
+#include "vex_powergovernor.h"
+#include "vex_healthmonitor.h"
+#include "vex_controllerpoll.h"
+#include "vex_axiscurve.h"
+#include "vex_devicediscovery.h"
+#include "vex_startuptrace.h"
+#include "vex_lazy.h"
+#include "vex_benchmark.h"
+#include "vex_script.h"
 #include "vex_global.h"
\ No newline at end of file
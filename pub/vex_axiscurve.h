@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_axiscurve.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_AXISCURVE_CLASS_H
+#define   VEX_AXISCURVE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_axiscurve.h
+  * @brief   Joystick response curve tables and slew limiting
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  enum class curveType {
+    /** @brief output follows the stick */
+    linear,
+    /** @brief blend of x and x squared, strength is the share of x squared */
+    square,
+    /** @brief blend of x and x cubed, strength is the share of x cubed */
+    cubic,
+    /** @brief x * e^( k * ( x - 1 ) ), strength 100 is k = 10 */
+    exponential
+  };
+
+  // everything below is evaluated by the compiler, nothing runs on the brain
+  template <curveType C, int32_t Deadband, int32_t Strength, int32_t Minimum>
+  class _curve_shape {
+    private:
+      // e^x from its series, for negative x from 1 / e^-x so terms do not cancel
+      static constexpr double _series( double x, double term, int32_t n ) {
+        return ( n > 40 ) ? term : term + _series( x, term * x / n, n + 1 );
+      }
+      static constexpr double _exp( double x ) {
+        return ( x < 0 ) ? 1.0 / _series( -x, 1.0, 1 ) : _series( x, 1.0, 1 );
+      }
+
+      // x is 0 to 1 past the deadband
+      static constexpr double _shape( double x ) {
+        return ( C == curveType::square      ) ? ( 1 - Strength / 100.0 ) * x + Strength / 100.0 * x * x :
+               ( C == curveType::cubic       ) ? ( 1 - Strength / 100.0 ) * x + Strength / 100.0 * x * x * x :
+               ( C == curveType::exponential ) ? x * _exp( Strength / 10.0 * ( x - 1 ) ) :
+                                                 x;
+      }
+
+      static constexpr int32_t _magnitude( int32_t v ) {
+        return ( v <= Deadband ) ? 0 :
+               (int32_t)( Minimum + ( 100 - Minimum ) * _shape( (double)( v - Deadband ) / ( 127 - Deadband ) ) + 0.5 );
+      }
+
+    public:
+      // index 0 is -128, which the controller never sends, and is read as -127
+      static constexpr int8_t entry( int32_t index ) {
+        return (int8_t)( ( index < 128 ) ? -_magnitude( ( index == 0 ) ? 127 : 128 - index ) : _magnitude( index - 128 ) );
+      }
+  };
+
+  typedef struct _curve_table {
+    int8_t    value[256];
+  } curve_table;
+
+  template <int32_t... I> struct _curve_indices {};
+  template <int32_t N, int32_t... I> struct _curve_build : _curve_build<N - 1, N - 1, I...> {};
+  template <int32_t... I> struct _curve_build<0, I...> { typedef _curve_indices<I...> type; };
+
+  template <class S, int32_t... I>
+  constexpr curve_table _curve_make( _curve_indices<I...> ) {
+    return curve_table{ { S::entry( I )... } };
+  }
+
+  /**
+    * @brief Use the axis_curve class to shape a joystick with a table built when the program is compiled.
+    * @details
+    *  Each curve is a type.  The deadband, strength and minimum output are
+    *  template parameters and the 256 entry table is generated by the
+    *  compiler, so apply() is a clamp and a byte load with no floating
+    *  point at all.  Every axis can have its own curve.
+    *
+    *     typedef vex::axis_curve<vex::curveType::cubic, 5, 70>        driveCurve;
+    *     typedef vex::axis_curve<vex::curveType::exponential, 5, 40>  turnCurve;
+    *     vex::slew_limiter driveSlew( 8, 20 );
+    *     ...
+    *     Drivetrain.arcade( driveSlew.update( driveCurve::apply( Controller.Axis3 ) ),
+    *                        turnCurve::apply( Controller.Axis1 ) );
+    *
+    *  Deadband is in raw stick counts, 0 to 126.  Past the deadband the
+    *  curve starts again from 0, or from Minimum percent when a mechanism
+    *  needs some power before it moves, so there is no jump at its edge.
+  */
+  template <curveType C, int32_t Deadband = 0, int32_t Strength = 50, int32_t Minimum = 0>
+  class axis_curve {
+    static_assert( Deadband >= 0 && Deadband < 127, "deadband must be 0 to 126" );
+    static_assert( Strength >= 0 && Strength <= 100, "strength must be 0 to 100" );
+    static_assert( Minimum >= 0 && Minimum < 100, "minimum must be 0 to 99" );
+
+    public:
+      /** @brief output percent for each raw value, indexed by value + 128 */
+      static constexpr curve_table table = _curve_make< _curve_shape<C, Deadband, Strength, Minimum> >( typename _curve_build<256>::type() );
+
+      /**
+       * @brief Shapes a raw joystick value.
+       * @return Returns the output on a scale from -100 to 100 percent.
+       * @param value The value on a scale from -127 to 127.
+       */
+      static inline int32_t apply( int32_t value ) {
+        if( value < -127 ) value = -127;
+        if( value >  127 ) value =  127;
+        return( table.value[ value + 128 ] );
+      }
+
+      /**
+       * @brief Shapes the value of a joystick axis.
+       * @return Returns the output on a scale from -100 to 100 percent.
+       * @param axis The controller axis.
+       */
+      static inline int32_t apply( const controller::axis &axis ) {
+        return( apply( axis.value() ) );
+      }
+  };
+
+  template <curveType C, int32_t Deadband, int32_t Strength, int32_t Minimum>
+  constexpr curve_table axis_curve<C, Deadband, Strength, Minimum>::table;
+
+  /**
+    * @brief Use the slew_limiter class to limit how fast an output may change each time it is updated.
+    * @details
+    *  The rates are in percent per update, so call update() once per tick
+    *  of the drive loop.  A separate, usually larger, rate can be given for
+    *  slowing down so the robot still stops quickly.  A rate of 0
+    *  does not limit.
+  */
+  class slew_limiter  {
+    private:
+      int32_t   _rise;
+      int32_t   _fall;
+      int32_t   _output;
+
+    public:
+      /**
+       * @brief Creates a new slew_limiter object.
+       * @param rise The largest change per update while speeding up.
+       * @param fall (Optional) The largest change per update while slowing down, by default the same as rise.
+       */
+      slew_limiter( int32_t rise, int32_t fall = -1 ) : _rise( rise ), _fall( ( fall < 0 ) ? rise : fall ), _output( 0 ) {};
+      ~slew_limiter() {};
+
+      /**
+       * @brief Moves the output toward a target.
+       * @return Returns the new output.
+       * @param target The wanted output.
+       */
+      int32_t update( int32_t target ) {
+        bool    slowing = ( _output > 0 && target < _output ) || ( _output < 0 && target > _output );
+        int32_t step    = slowing ? _fall : _rise;
+        int32_t delta   = target - _output;
+
+        if( step > 0 ) {
+          if( delta >  step ) delta =  step;
+          if( delta < -step ) delta = -step;
+        }
+        _output += delta;
+        return( _output );
+      }
+
+      /**
+       * @brief Sets the output without limiting.
+       * @param value (Optional) The new output, by default 0.
+       */
+      void    reset( int32_t value = 0 ) { _output = value; };
+
+      /** @brief Gets the current output. */
+      int32_t value() { return _output; };
+  };
+};
+
+#endif // VEX_AXISCURVE_CLASS_H
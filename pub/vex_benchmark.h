@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_benchmark.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_BENCHMARK_CLASS_H
+#define   VEX_BENCHMARK_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_benchmark.h
+  * @brief   Microbenchmark harness class header
+*//*---------------------------------------------------------------------------*/
+
+//
+// The device getters timed by addDevice(), one argument and no side effects.
+// The return type is also used by the host build to define the functions.
+//
+#define VEX_BENCHMARK_GETTERS( X ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorVelocityGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorActualVelocityGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorDirectionGet ) \
+  X( kDeviceTypeMotorSensor,    V5MotorControlMode,  vexDeviceMotorModeGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorPwmGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorCurrentLimitGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorVoltageLimitGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorCurrentGet ) \
+  X( kDeviceTypeMotorSensor,    int32_t,             vexDeviceMotorVoltageGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorPowerGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorTorqueGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorEfficiencyGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorTemperatureGet ) \
+  X( kDeviceTypeMotorSensor,    bool,                vexDeviceMotorOverTempFlagGet ) \
+  X( kDeviceTypeMotorSensor,    bool,                vexDeviceMotorCurrentLimitFlagGet ) \
+  X( kDeviceTypeMotorSensor,    uint32_t,            vexDeviceMotorFaultsGet ) \
+  X( kDeviceTypeMotorSensor,    bool,                vexDeviceMotorZeroVelocityFlagGet ) \
+  X( kDeviceTypeMotorSensor,    bool,                vexDeviceMotorZeroPositionFlagGet ) \
+  X( kDeviceTypeMotorSensor,    uint32_t,            vexDeviceMotorFlagsGet ) \
+  X( kDeviceTypeMotorSensor,    bool,                vexDeviceMotorReverseFlagGet ) \
+  X( kDeviceTypeMotorSensor,    V5MotorEncoderUnits, vexDeviceMotorEncoderUnitsGet ) \
+  X( kDeviceTypeMotorSensor,    V5MotorBrakeMode,    vexDeviceMotorBrakeModeGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorPositionGet ) \
+  X( kDeviceTypeMotorSensor,    double,              vexDeviceMotorTargetGet ) \
+  X( kDeviceTypeMotorSensor,    V5MotorGearset,      vexDeviceMotorGearingGet ) \
+  X( kDeviceTypeVisionSensor,   V5VisionMode,        vexDeviceVisionModeGet ) \
+  X( kDeviceTypeVisionSensor,   int32_t,             vexDeviceVisionObjectCountGet ) \
+  X( kDeviceTypeVisionSensor,   uint8_t,             vexDeviceVisionBrightnessGet ) \
+  X( kDeviceTypeVisionSensor,   V5VisionWBMode,      vexDeviceVisionWhiteBalanceModeGet ) \
+  X( kDeviceTypeVisionSensor,   V5_DeviceVisionRgb,  vexDeviceVisionWhiteBalanceGet ) \
+  X( kDeviceTypeVisionSensor,   V5VisionLedMode,     vexDeviceVisionLedModeGet ) \
+  X( kDeviceTypeVisionSensor,   uint8_t,             vexDeviceVisionLedBrigntnessGet ) \
+  X( kDeviceTypeVisionSensor,   V5_DeviceVisionRgb,  vexDeviceVisionLedColorGet ) \
+  X( kDeviceTypeVisionSensor,   V5VisionWifiMode,    vexDeviceVisionWifiModeGet ) \
+  X( kDeviceTypeImuSensor,      double,              vexDeviceImuHeadingGet ) \
+  X( kDeviceTypeImuSensor,      double,              vexDeviceImuDegreesGet ) \
+  X( kDeviceTypeImuSensor,      uint32_t,            vexDeviceImuStatusGet ) \
+  X( kDeviceTypeImuSensor,      uint32_t,            vexDeviceImuModeGet ) \
+  X( kDeviceTypeAbsEncSensor,   int32_t,             vexDeviceAbsEncPositionGet ) \
+  X( kDeviceTypeAbsEncSensor,   int32_t,             vexDeviceAbsEncVelocityGet ) \
+  X( kDeviceTypeAbsEncSensor,   int32_t,             vexDeviceAbsEncAngleGet ) \
+  X( kDeviceTypeAbsEncSensor,   bool,                vexDeviceAbsEncReverseFlagGet ) \
+  X( kDeviceTypeAbsEncSensor,   uint32_t,            vexDeviceAbsEncStatusGet ) \
+  X( kDeviceTypeOpticalSensor,  double,              vexDeviceOpticalHueGet ) \
+  X( kDeviceTypeOpticalSensor,  double,              vexDeviceOpticalSatGet ) \
+  X( kDeviceTypeOpticalSensor,  double,              vexDeviceOpticalBrightnessGet ) \
+  X( kDeviceTypeOpticalSensor,  int32_t,             vexDeviceOpticalProximityGet ) \
+  X( kDeviceTypeOpticalSensor,  int32_t,             vexDeviceOpticalLedPwmGet ) \
+  X( kDeviceTypeOpticalSensor,  uint32_t,            vexDeviceOpticalStatusGet ) \
+  X( kDeviceTypeOpticalSensor,  uint32_t,            vexDeviceOpticalModeGet ) \
+  X( kDeviceTypeOpticalSensor,  double,              vexDeviceOpticalIntegrationTimeGet ) \
+  X( kDeviceTypeMagnetSensor,   int32_t,             vexDeviceMagnetPowerGet ) \
+  X( kDeviceTypeMagnetSensor,   double,              vexDeviceMagnetTemperatureGet ) \
+  X( kDeviceTypeMagnetSensor,   double,              vexDeviceMagnetCurrentGet ) \
+  X( kDeviceTypeMagnetSensor,   uint32_t,            vexDeviceMagnetStatusGet ) \
+  X( kDeviceTypeDistanceSensor, uint32_t,            vexDeviceDistanceDistanceGet ) \
+  X( kDeviceTypeDistanceSensor, uint32_t,            vexDeviceDistanceConfidenceGet ) \
+  X( kDeviceTypeDistanceSensor, int32_t,             vexDeviceDistanceObjectSizeGet ) \
+  X( kDeviceTypeDistanceSensor, double,              vexDeviceDistanceObjectVelocityGet ) \
+  X( kDeviceTypeDistanceSensor, uint32_t,            vexDeviceDistanceStatusGet ) \
+  X( kDeviceTypeGpsSensor,      double,              vexDeviceGpsHeadingGet ) \
+  X( kDeviceTypeGpsSensor,      double,              vexDeviceGpsDegreesGet ) \
+  X( kDeviceTypeGpsSensor,      uint32_t,            vexDeviceGpsStatusGet ) \
+  X( kDeviceTypeGpsSensor,      uint32_t,            vexDeviceGpsModeGet ) \
+  X( kDeviceTypeGpsSensor,      double,              vexDeviceGpsRotationGet ) \
+  X( kDeviceTypeGpsSensor,      double,              vexDeviceGpsErrorGet )
+
+namespace vex {
+  /**
+    * @brief Use the benchmark class to measure how long API calls take.
+    * @details
+    *  Each case is a function that makes one call.  A sample times a batch
+    *  of calls with vexSystemHighResTimeGet, batching hides the 1uS clock
+    *  resolution.  After warmup batches that are not kept, every case is
+    *  sampled and the minimum, percentiles, maximum and mean are reported
+    *  per call in nS.  The cost of calling an empty case is measured at the
+    *  same batch size as each case and subtracted.
+    *
+    *  addDevice() adds a case for every getter of one device type listed
+    *  in VEX_BENCHMARK_GETTERS, the device must be on the port given.
+    *  addStandard() adds the motor and IMU getters that way, and one or two
+    *  cases for the time, device, motor setter, controller, display, file,
+    *  mutex and task calls.  It does not add every entry in v5_api.h.
+    *  Setters other than the motor voltage and velocity change the device,
+    *  and the remaining getters need a vision, encoder, optical, magnet,
+    *  distance or GPS sensor on a known port, add those with addDevice().
+    *
+    *  The same code runs on a PC with tools/bench_host.cpp, so host and
+    *  brain results can be compared.  The host clock also counts in uS
+    *  but its calls are much faster, it runs with a batch scale so a
+    *  sample is still many clock ticks long.
+    *
+    *  Run with other tasks idle, anything that runs during a sample is
+    *  counted against the case.
+  */
+  class benchmark  {
+    public:
+      typedef void (* function)( void *arg );
+
+      /** @brief scratch file used by the file cases, emptied when run() finishes */
+      static const char * const TEMP_FILE;
+
+      typedef struct _result {
+        const char *name;
+        uint32_t    samples;
+        uint32_t    batch;
+        float       min;                          // nS per call
+        float       p50;
+        float       p90;
+        float       p99;
+        float       max;
+        float       mean;
+      } result;
+
+    private:
+      static const int32_t  MAX_CASES   = 128;
+      static const int32_t  MAX_SAMPLES = 1000;
+
+      typedef struct _entry {
+        const char *name;
+        function    fn;
+        void       *arg;
+        int32_t     batch;
+      } entry;
+
+      entry         _cases[MAX_CASES];
+      result        _results[MAX_CASES];
+      uint32_t      _times[MAX_SAMPLES];
+      int32_t       _count;
+      int32_t       _samples;
+      int32_t       _warmup;
+      int32_t       _scale;
+
+      void          _measure( const entry *e, result *r, float overhead );
+
+    public:
+      /**
+       * @brief Creates an empty benchmark.
+       * @param samples The number of timed batches for each case, at most 1000.
+       * @param warmup The number of batches run before timing starts.
+       */
+      benchmark( int32_t samples = 500, int32_t warmup = 50 );
+      ~benchmark();
+
+      /**
+       * @brief Adds a case.
+       * @return Returns false if the case table is full.
+       * @param name The name used in reports, the string must remain valid.
+       * @param fn A function that makes the call being measured once.
+       * @param arg A value passed to the function.
+       * @param batch The number of calls in each timed sample, use 1 for calls that take milliseconds.
+       */
+      bool          add( const char *name, function fn, void *arg = NULL, int32_t batch = 16 );
+
+      /**
+       * @brief Adds a case for every getter of one device type in VEX_BENCHMARK_GETTERS.
+       * @return Returns the number of cases added.
+       * @param type The device type, such as kDeviceTypeOpticalSensor.
+       * @param index The port index of a device of that type.
+       */
+      int32_t       addDevice( V5_DeviceType type, int32_t index );
+
+      /**
+       * @brief Adds the motor and IMU getters, and cases for the time, device, motor setter, controller, display, file, mutex and task calls.
+       * @param motorIndex The port index of a motor.
+       * @param imuIndex The port index of an inertial sensor.
+       */
+      void          addStandard( int32_t motorIndex, int32_t imuIndex );
+
+      /**
+       * @brief Multiplies the batch of every case, for a clock that is coarse compared to the calls.
+       * @param scale The multiplier, 1 on the brain.
+       */
+      void          setBatchScale( int32_t scale );
+
+      /**
+       * @brief Runs every case, this blocks until all are done.  The SD card API cannot delete a file, TEMP_FILE is left empty.
+       */
+      void          run();
+
+      /**
+       * @brief Gets the number of cases.
+       * @return Returns the case count.
+       */
+      int32_t       count();
+
+      /**
+       * @brief Gets the result of one case.
+       * @return Returns a pointer to the result or NULL if index is out of range.
+       * @param index The case index.
+       */
+      const result *data( int32_t index );
+
+      /**
+       * @brief Prints the results to the serial console.
+       */
+      void          print();
+
+      /**
+       * @brief Saves the results as CSV.
+       * @return Returns true if the file was written.
+       * @param name The name of the file.
+       */
+      bool          save( const char *name );
+  };
+};
+
+#endif // VEX_BENCHMARK_CLASS_H
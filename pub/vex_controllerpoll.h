@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_controllerpoll.h                                        */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_CONTROLLERPOLL_CLASS_H
+#define   VEX_CONTROLLERPOLL_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_controllerpoll.h
+  * @brief   Polled controller snapshot with button edges class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the controller_poll class to read a controller once per tick and run handlers for button edges.
+    * @details
+    *  update() reads every button and joystick of one controller once and
+    *  packs the buttons into a 12 bit mask.  Press and release edges for
+    *  all buttons come from a couple of logic operations on the old and
+    *  new masks.  Only buttons that changed, or are down and waiting for
+    *  the hold time, get any per button work.
+    *
+    *  Handlers are called from update() in the calling task, usually the
+    *  drive loop, so they run in the same tick as the edge rather than
+    *  after an event broadcast.  An update where no edge matches a handler
+    *  calls nothing.
+    *
+    *     vex::controller_poll pad;
+    *     pad.on( controller_poll::buttonR1, controller_poll::edgeType::pressed, intakeOn );
+    *     pad.on( controller_poll::buttonA,  controller_poll::edgeType::doubleTap, toggleMode );
+    *     while( true ) {
+    *       pad.update();
+    *       Drivetrain.arcade( pad.axis( 3 ), pad.axis( 1 ) );
+    *       vex::task::sleep( 10 );
+    *     }
+  */
+  class controller_poll  {
+    public:
+      static const int32_t  BUTTONS      = 12;
+      static const int32_t  AXES         = 4;
+      static const int32_t  MAX_HANDLERS = 32;
+
+      /** @brief button bits, in the same order as the V5_ControllerIndex buttons */
+      static const uint32_t buttonL1     = 0x001;
+      static const uint32_t buttonL2     = 0x002;
+      static const uint32_t buttonR1     = 0x004;
+      static const uint32_t buttonR2     = 0x008;
+      static const uint32_t buttonUp     = 0x010;
+      static const uint32_t buttonDown   = 0x020;
+      static const uint32_t buttonLeft   = 0x040;
+      static const uint32_t buttonRight  = 0x080;
+      static const uint32_t buttonX      = 0x100;
+      static const uint32_t buttonB      = 0x200;
+      static const uint32_t buttonY      = 0x400;
+      static const uint32_t buttonA      = 0x800;
+      static const uint32_t buttonAll    = 0xFFF;
+
+      enum class edgeType {
+        /** @brief the button went down */
+        pressed   = 0,
+        /** @brief the button went up */
+        released  = 1,
+        /** @brief the button has been down for the hold time, once per press */
+        held      = 2,
+        /** @brief the button went down again within the double tap time of going up */
+        doubleTap = 3
+      };
+
+    private:
+      static const int32_t  EDGES = 4;
+
+      typedef struct _handler {
+        uint32_t      mask;
+        edgeType      edge;
+        void        (*callback)( void );
+      } handler;
+
+      V5_ControllerId _id;
+
+      uint32_t      _down;
+      uint32_t      _edges[EDGES];        // buttons with each edge in the last update
+      uint32_t      _holding;             // held already reported for this press
+      uint32_t      _armed;               // released, a press now may be a double tap
+      uint32_t      _tapped;              // pressed as a double tap, the release does not arm
+      uint32_t      _pressTime[BUTTONS];
+      uint32_t      _releaseTime[BUTTONS];
+      int32_t       _axes[AXES];
+
+      uint32_t      _holdTime;            // mS
+      uint32_t      _doubleTapTime;       // mS
+
+      handler       _handlers[MAX_HANDLERS];
+      int32_t       _handlerCount;
+      uint32_t      _watched[EDGES];      // buttons any handler wants, by edge
+
+      vex::task    *_task;
+      volatile bool _running;
+      uint32_t      _period;              // mS
+
+      static int    _run( void *arg );
+
+    public:
+      /**
+       * @brief Creates a new controller_poll object.
+       * @param id (Optional) The controller to read, primary or partner.
+       */
+      controller_poll( controllerType id = controllerType::primary );
+      ~controller_poll();
+
+      /**
+       * @brief Sets how long a button must stay down for a held edge.
+       * @param time The time in milliseconds.
+       */
+      void    setHoldTime( uint32_t time );
+
+      /**
+       * @brief Sets how soon after a release a press counts as a double tap.
+       * @param time The time in milliseconds.
+       */
+      void    setDoubleTapTime( uint32_t time );
+
+      /**
+       * @brief Adds a function called from update() when any of the buttons has an edge.
+       * @return Returns false if there is no room for another handler.
+       * @param mask The buttons, see buttonL1 and the other button constants.
+       * @param edge The edge.
+       * @param callback The function.
+       */
+      bool    on( uint32_t mask, edgeType edge, void (* callback)( void ) );
+
+      /**
+       * @brief Removes every handler for a function.
+       * @param callback The function.
+       */
+      void    remove( void (* callback)( void ) );
+
+      /**
+       * @brief Reads the controller once, finds the edges and calls the handlers for them.
+       * @return Returns the number of edges found.
+       */
+      int32_t update();
+
+      /**
+       * @brief Starts a task that runs update() periodically, handlers are then called from that task.
+       * @param period (Optional) The update period in milliseconds.
+       */
+      void    start( uint32_t period = 10 );
+
+      /**
+       * @brief Stops the update task.
+       */
+      void    stop();
+
+      /**
+       * @brief Gets the value of a joystick axis read by the last update().
+       * @return Returns the value on a scale from -127 to 127, or 0 for an axis that does not exist.
+       * @param number The axis number printed on the controller, 1 to 4.
+       */
+      int32_t axis( int32_t number );
+
+      /** @brief Gets the buttons that were down at the last update(). */
+      uint32_t down()         { return _down; };
+      /** @brief Gets the buttons that went down in the last update(). */
+      uint32_t pressed()      { return _edges[ (int)edgeType::pressed ]; };
+      /** @brief Gets the buttons that went up in the last update(). */
+      uint32_t released()     { return _edges[ (int)edgeType::released ]; };
+      /** @brief Gets the buttons that reached the hold time in the last update(). */
+      uint32_t held()         { return _edges[ (int)edgeType::held ]; };
+      /** @brief Gets the buttons that were double tapped in the last update(). */
+      uint32_t doubleTapped() { return _edges[ (int)edgeType::doubleTap ]; };
+
+      /**
+       * @brief Gets whether any of the buttons was down at the last update().
+       * @return Returns true if one of the buttons is down.
+       * @param mask The buttons.
+       */
+      bool    pressing( uint32_t mask ) { return ( _down & mask ) != 0; };
+  };
+};
+
+#endif // VEX_CONTROLLERPOLL_CLASS_H
@@ -0,0 +1,147 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_devicediscovery.h                                       */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_DEVICEDISCOVERY_CLASS_H
+#define   VEX_DEVICEDISCOVERY_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_devicediscovery.h
+  * @brief   Hot plug device discovery class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the device_discovery class to be told when devices are plugged in, unplugged or replaced.
+    * @details
+    *  One task reads vexDeviceGetStatus each tick and compares it with the
+    *  previous snapshot, in the common case where nothing changed that is a
+    *  single compare.  A change must be seen on consecutive ticks before it
+    *  is reported so a cable being reseated does not produce a burst of
+    *  events.
+    *
+    *  Other tasks read the cached snapshot with type(), installed() and
+    *  generation() instead of polling every port themselves.  Devices passed
+    *  to bind() are re-initialized with device::init() when a device of the
+    *  expected type comes back on their port, and an optional function can
+    *  re-apply settings such as gearset or brake mode that the device lost.
+  */
+  class device_discovery  {
+    public:
+      static const int32_t  PORTS = V5_MAX_DEVICE_PORTS;
+
+      enum class eventType {
+        connected    = 0,
+        disconnected = 1,
+        typeChanged  = 2
+      };
+
+    private:
+      static const int32_t  MAX_CALLBACKS = 8;
+      static const int32_t  MAX_BINDINGS  = 32;
+
+      typedef struct _binding {
+        device         *dev;
+        V5_DeviceType   type;
+        void          (*reinit)( device &d );
+      } binding;
+
+      V5_DeviceType   _types[PORTS];          // reported snapshot
+      V5_DeviceType   _pending[PORTS];        // candidate new type
+      uint8_t         _pendingCount[PORTS];   // ticks the candidate has been seen
+      V5_DeviceTypeBuffer _last;              // raw status from the previous tick
+      uint32_t        _present;               // bit per port
+      uint32_t        _pendingMask;           // bit per port with a candidate
+      volatile uint32_t _generation;
+      int32_t         _debounce;              // ticks
+
+      void          (*_callbacks[MAX_CALLBACKS])( eventType e, int32_t port, V5_DeviceType oldType, V5_DeviceType newType );
+      int32_t         _callbackCount;
+
+      binding         _bindings[MAX_BINDINGS];
+      int32_t         _bindingCount;
+
+      vex::task      *_task;
+      volatile bool   _running;
+      uint32_t        _period;                // mS
+
+      void            _init();
+      void            _notify( int32_t port, V5_DeviceType oldType, V5_DeviceType newType );
+
+      static int      _run( void *arg );
+
+    public:
+      device_discovery();
+      ~device_discovery();
+
+      /**
+       * @brief Sets the number of consecutive ticks a change must be seen for before it is reported.
+       * @param ticks The debounce count, 1 reports changes immediately.
+       */
+      void    setDebounce( int32_t ticks );
+
+      /**
+       * @brief Registers a function called from the discovery task for every event.
+       * @return Returns false if too many functions are registered.
+       * @param callback The function.
+       */
+      bool    changed( void (* callback)( eventType e, int32_t port, V5_DeviceType oldType, V5_DeviceType newType ) );
+
+      /**
+       * @brief Rebinds a device object whenever a device of the given type is connected to its port.
+       * @return Returns false if too many devices are bound.
+       * @param d The device object, for example a motor.
+       * @param type The expected device type.
+       * @param reinit (Optional) A function called after the device is rebound to re-apply its settings.
+       */
+      bool    bind( device &d, V5_DeviceType type, void (* reinit)( device &d ) = NULL );
+
+      /**
+       * @brief Starts the discovery task.
+       * @param period (Optional) The tick period in milliseconds.
+       */
+      void    start( uint32_t period = 20 );
+
+      /**
+       * @brief Stops the discovery task.
+       */
+      void    stop();
+
+      /**
+       * @brief Reads the device status once and reports any changes.
+       * @return Returns the number of ports that changed.
+       */
+      int32_t update();
+
+      /**
+       * @brief Gets the device type on a port from the last snapshot.
+       * @return Returns the device type, kDeviceTypeNoSensor if nothing is connected.
+       * @param port The port index, zero-based.
+       */
+      V5_DeviceType type( int32_t port );
+
+      /**
+       * @brief Checks for a device on a port in the last snapshot.
+       * @return Returns true if a device is connected.
+       * @param port The port index, zero-based.
+       */
+      bool    installed( int32_t port );
+
+      /**
+       * @brief Gets the ports with a device, one bit per port.
+       * @return Returns the bit mask.
+       */
+      uint32_t present() { return _present; };
+
+      /**
+       * @brief Gets a counter that changes whenever any port changes, compare with an earlier value to see if anything happened.
+       * @return Returns the generation counter.
+       */
+      uint32_t generation() { return _generation; };
+  };
+};
+
+#endif // VEX_DEVICEDISCOVERY_CLASS_H
@@ -0,0 +1,177 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_estimator.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_ESTIMATOR_CLASS_H
+#define   VEX_ESTIMATOR_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_estimator.h
+  * @brief   Low latency velocity and acceleration estimator class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the velocity_estimator class to get velocity and acceleration with less lag than vexDeviceMotorActualVelocityGet.
+    * @details
+    *  Raw encoder counts are read with vexDeviceMotorPositionRawGet for motors
+    *  and vexDeviceAbsEncPositionGet for rotation sensors.  Every new device
+    *  sample is filtered against the device timestamp, not the time the task
+    *  woke up, so scheduling jitter does not show up as velocity noise.
+    *
+    *  Two filters are available.  savitzkyGolay fits a quadratic by least
+    *  squares to the last N samples, handling uneven sample spacing, and
+    *  evaluates it at the newest sample.  kalman is a constant acceleration
+    *  Kalman filter; use setNoise() to trade lag against noise.
+    *
+    *  Call start() to update from a high priority task, or call update() from
+    *  your own control loop.
+  */
+  class velocity_estimator  {
+    public:
+      enum class filterType {
+        savitzkyGolay = 0,
+        kalman        = 1
+      };
+
+    private:
+      static const int32_t  MAX_CHANNELS = 8;
+      static const int32_t  MAX_WINDOW   = 32;
+
+      typedef struct _channel {
+        V5_DeviceT      device;
+        int32_t         port;
+        bool            isMotor;
+        double          scale;                // degrees per raw count
+        uint32_t        lastTimestamp;
+        bool            primed;
+
+        // history for the least squares fit, a ring of the last samples
+        uint32_t        time[MAX_WINDOW];     // mS
+        double          position[MAX_WINDOW]; // degrees
+        int32_t         head;
+        int32_t         length;
+
+        // kalman state, position, velocity and acceleration in degrees and seconds
+        double          x[3];
+        double          P[3][3];
+
+        // published by update(), single word stores so readers never see a torn value
+        volatile float    outPosition;        // degrees
+        volatile float    outVelocity;        // degrees per second
+        volatile float    outAcceleration;    // degrees per second squared
+        volatile uint32_t outTimestamp;       // mS
+      } channel;
+
+      channel       _channels[MAX_CHANNELS];
+      int32_t       _count;
+
+      filterType    _filter;
+      int32_t       _window;
+      double        _jerk;                    // kalman process noise
+      double        _noise;                   // kalman measurement noise, 0 for quantization
+
+      vex::task    *_task;
+      volatile bool _running;
+
+      void          _init();
+      channel      *_find( int32_t port );
+      bool          _add( int32_t port, bool isMotor );
+      void          _reset( channel *c, uint32_t time, double position );
+      void          _fit( channel *c );
+      void          _kalman( channel *c, double dt, double position );
+      double        _toRpm( channel *c, double dps, velocityUnits units );
+
+      static int    _run( void *arg );
+
+    public:
+      velocity_estimator();
+      ~velocity_estimator();
+
+      /**
+       * @brief Adds a motor, the encoder units of the motor are not changed.
+       * @return Returns false if the estimator is full or the port is already added.
+       * @param m The motor.
+       */
+      bool    add( vex::motor &m );
+
+      /**
+       * @brief Adds a rotation sensor, its data rate is set to 5mS.
+       * @return Returns false if the estimator is full or the port is already added.
+       * @param r The rotation sensor.
+       */
+      bool    add( vex::rotation &r );
+
+      /**
+       * @brief Sets the filter used for every port. All ports are reset.
+       * @param filter The filter type.
+       */
+      void    setFilter( filterType filter );
+
+      /**
+       * @brief Sets the number of samples used by the savitzkyGolay filter. More samples give less noise and more lag.
+       * @param samples The window length, 3 to 32 samples.
+       */
+      void    setWindow( int32_t samples );
+
+      /**
+       * @brief Sets the noise model of the kalman filter.
+       * @param jerk The process noise, the expected rms jerk in degrees per second cubed.
+       * @param measurement The rms measurement noise in degrees, zero uses the encoder quantization.
+       */
+      void    setNoise( double jerk, double measurement = 0 );
+
+      /**
+       * @brief Starts a task that updates all ports every millisecond.
+       * @param priority (Optional) The task priority.
+       */
+      void    start( int32_t priority = vex::task::taskPriorityHigh );
+
+      /**
+       * @brief Stops the update task.
+       */
+      void    stop();
+
+      /**
+       * @brief Reads all ports once and filters any that have new data.
+       * @return Returns the number of ports that were updated.
+       */
+      int32_t update();
+
+      /**
+       * @brief Gets the estimated velocity of a port.
+       * @return Returns the velocity, pct is relative to the motor cartridge and is 0 for rotation sensors.
+       * @param port The port index, zero-based.
+       * @param units (Optional) The measurement unit for the velocity.
+       */
+      double  velocity( int32_t port, velocityUnits units = velocityUnits::rpm );
+
+      /**
+       * @brief Gets the estimated acceleration of a port.
+       * @return Returns the acceleration in velocity units per second.
+       * @param port The port index, zero-based.
+       * @param units (Optional) The measurement unit for the velocity.
+       */
+      double  acceleration( int32_t port, velocityUnits units = velocityUnits::rpm );
+
+      /**
+       * @brief Gets the filtered position of a port.
+       * @return Returns the position.
+       * @param port The port index, zero-based.
+       * @param units (Optional) The measurement unit for the position.
+       */
+      double  position( int32_t port, rotationUnits units = rotationUnits::deg );
+
+      /**
+       * @brief Gets the device timestamp of the newest sample used for a port.
+       * @return Returns the timestamp in mS.
+       * @param port The port index, zero-based.
+       */
+      uint32_t timestamp( int32_t port );
+  };
+};
+
+#endif // VEX_ESTIMATOR_CLASS_H
@@ -0,0 +1,247 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_flywheel.h                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_FLYWHEEL_CLASS_H
+#define   VEX_FLYWHEEL_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_flywheel.h
+  * @brief   Flywheel velocity controller class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the flywheel class to hold a shooter at a target speed and measure shot recovery time.
+    * @details
+    *  Motors are added the same way as a motor_group.  A high priority task
+    *  runs the controller on every new motor sample, using a
+    *  velocity_estimator for speed, and drives the motors with
+    *  vexDeviceMotorVoltageSet.
+    *
+    *  A shot is detected when the summed motor current rises above its
+    *  running average by the shot threshold while the flywheel is at speed.
+    *  The velocity dip follows the spike a few samples later, so recovery
+    *  time runs from the spike until the speed has dropped out of the
+    *  tolerance band and come back into it.
+  */
+  class flywheel  {
+    public:
+      enum class modeType {
+        /** @brief full voltage below target, hold voltage above */
+        bangBang     = 0,
+        /** @brief integrating controller that halves back to the last crossing */
+        takeBackHalf = 1,
+        /** @brief kS + kV feedforward with PID correction */
+        feedforward  = 2
+      };
+
+      typedef struct _shot {
+        uint32_t  time;                   // device timestamp of the current spike, mS
+        uint32_t  recovery;               // mS until back within tolerance, 0 while recovering
+        float     drop;                   // largest drop below target, rpm
+        float     peakCurrent;            // A, summed over all motors
+      } shot;
+
+    private:
+      static const int32_t  MAX_MOTORS = 8;
+      static const int32_t  MAX_SHOTS  = 16;
+
+      V5_DeviceT          _devices[MAX_MOTORS];
+      int32_t             _ports[MAX_MOTORS];
+      int32_t             _count;
+      velocity_estimator  _estimator;
+
+      modeType      _mode;
+      double        _ratio;               // flywheel rpm per motor rpm
+      double        _target;              // motor rpm
+      double        _tolerance;           // motor rpm
+      double        _maxVoltage;          // V
+      double        _holdVoltage;         // V, bang-bang output above target
+      double        _gain;                // take-back-half, V per rpm per sample
+      double        _kS, _kV, _kA;        // V, V per rpm, V per rpm/s
+      double        _kP, _kI, _kD;
+
+      // controller state, touched only by the task
+      double        _output;              // V
+      double        _tbh;
+      double        _integral;
+      double        _lastError;
+      double        _velocity;            // motor rpm
+      double        _currentAverage;      // A
+      bool          _ready;
+
+      // shot log
+      shot          _shots[MAX_SHOTS];
+      volatile int32_t _shotCount;
+      bool          _recovering;
+      double        _shotThreshold;       // A
+
+      vex::task    *_task;
+      volatile bool _running;
+
+      void          _addMotor();
+      void          _addMotor( vex::motor &m );
+
+      template <typename... Args>
+      void _addMotor(  vex::motor &m1, Args &... m2 ) {
+         _addMotor( m1 );
+         _addMotor( m2... );
+      }
+
+      void          _init();
+      void          _setVoltage( double volts );
+      void          _step( uint32_t timestamp, double dt );
+      void          _detectShot( uint32_t timestamp );
+
+      static int    _run( void *arg );
+
+    public:
+      flywheel();
+      ~flywheel();
+
+      template <typename... Args>
+      flywheel( vex::motor &m1, Args &... m2 ) : flywheel() {
+        _addMotor( m1 );
+        _addMotor( m2... );
+      }
+
+      /**
+       * @brief Sets the control mode, controller state is reset.
+       * @param mode The control mode.
+       */
+      void    setMode( modeType mode );
+
+      /**
+       * @brief Sets the gear ratio between the motors and the flywheel.
+       * @param ratio Flywheel revolutions per motor revolution.
+       */
+      void    setRatio( double ratio );
+
+      /**
+       * @brief Sets the band around the target that counts as at speed.
+       * @param value The tolerance.
+       * @param units The measurement unit for the velocity, at the flywheel.
+       */
+      void    setTolerance( double value, velocityUnits units );
+
+      /**
+       * @brief Sets the maximum voltage sent to the motors.
+       * @param value The maximum voltage.
+       * @param units The measurement unit for the voltage.
+       */
+      void    setMaxVoltage( double value, voltageUnits units );
+
+      /**
+       * @brief Sets the voltage used by bang-bang mode when above target.
+       * @param value The hold voltage, use 0 for classic bang-bang.
+       * @param units The measurement unit for the voltage.
+       */
+      void    setHoldVoltage( double value, voltageUnits units );
+
+      /**
+       * @brief Sets the integrator gain used by take-back-half mode.
+       * @param gain Volts per rpm of motor error per motor sample.
+       */
+      void    setTakeBackHalfGain( double gain );
+
+      /**
+       * @brief Sets the feedforward constants, these are also used to seed take-back-half.
+       * @param kS Static voltage in volts.
+       * @param kV Volts per motor rpm.
+       * @param kA (Optional) Volts per motor rpm per second.
+       */
+      void    setFeedforward( double kS, double kV, double kA = 0 );
+
+      /**
+       * @brief Sets the feedforward constants from a sysid result.
+       * @param r The result of sysid::fit().
+       */
+      void    setFeedforward( const sysid::result &r );
+
+      /**
+       * @brief Sets the PID gains used by feedforward mode, in volts per motor rpm.
+       * @param kP The proportional gain.
+       * @param kI The integral gain, per second.
+       * @param kD The derivative gain, seconds.
+       */
+      void    setPid( double kP, double kI, double kD = 0 );
+
+      /**
+       * @brief Sets the rise in total motor current above its running average that marks a shot.
+       * @param value The current threshold.
+       * @param units The measurement unit for the current.
+       */
+      void    setShotThreshold( double value, currentUnits units );
+
+      /**
+       * @brief Spins the flywheel at a target velocity, the control task is started if needed.
+       * @param velocity The target velocity at the flywheel.
+       * @param units (Optional) The measurement unit for the velocity.
+       */
+      void    spin( double velocity, velocityUnits units = velocityUnits::rpm );
+
+      /**
+       * @brief Stops the control task and the motors.
+       * @param mode (Optional) The brake mode.
+       */
+      void    stop( brakeType mode = brakeType::coast );
+
+      /**
+       * @brief Gets the estimated flywheel velocity.
+       * @return Returns the velocity at the flywheel.
+       * @param units (Optional) The measurement unit for the velocity.
+       */
+      double  velocity( velocityUnits units = velocityUnits::rpm );
+
+      /**
+       * @brief Gets the voltage the controller is sending to the motors.
+       * @return Returns the voltage.
+       * @param units (Optional) The measurement unit for the voltage.
+       */
+      double  voltage( voltageUnits units = voltageUnits::volt );
+
+      /**
+       * @brief Gets the ready state of the flywheel.
+       * @return Returns true if the velocity is within tolerance and not recovering from a shot.
+       */
+      bool    ready();
+
+      /**
+       * @brief Gets the number of shots detected since the last clearShots().
+       * @return Returns the shot count.
+       */
+      int32_t shotCount();
+
+      /**
+       * @brief Gets a logged shot, only the most recent 16 are kept.
+       * @return Returns a pointer to the shot or NULL if index is out of range.
+       * @param index The shot number, 0 is the oldest kept.
+       */
+      const shot *shots( int32_t index );
+
+      /**
+       * @brief Gets the recovery time of the last completed shot.
+       * @return Returns the recovery time, or 0 if no shot has completed.
+       * @param units (Optional) The measurement unit for the time.
+       */
+      double  lastRecovery( timeUnits units = timeUnits::msec );
+
+      /**
+       * @brief Gets the mean recovery time of the completed shots that are kept.
+       * @return Returns the mean recovery time, or 0 if no shot has completed.
+       * @param units (Optional) The measurement unit for the time.
+       */
+      double  averageRecovery( timeUnits units = timeUnits::msec );
+
+      /**
+       * @brief Clears the shot log.
+       */
+      void    clearShots();
+  };
+};
+
+#endif // VEX_FLYWHEEL_CLASS_H
@@ -0,0 +1,194 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_healthmonitor.h                                         */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_HEALTHMONITOR_CLASS_H
+#define   VEX_HEALTHMONITOR_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_healthmonitor.h
+  * @brief   Device fault and health monitor class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the health_monitor class to watch every port for disconnects, stale data, stalls and motor faults.
+    * @details
+    *  Each tick reads vexDeviceGetStatus once and then, for motors only, the
+    *  faults, flags, current limit flag and device timestamp.  Motor current
+    *  is only read when the zero velocity flag says a stall is possible.
+    *  Every condition is kept as a 32 bit mask with one bit per port, so
+    *  edges for all ports are found with a couple of logic operations and
+    *  only the ports that changed cost anything more.
+    *
+    *  Edges are reported as events, to a callback, to a queue that can be
+    *  polled, and optionally to a compact binary log on the SD card that
+    *  tools/health_dump.cpp turns back into text.
+  */
+  class health_monitor  {
+    public:
+      static const int32_t  PORTS = 21;
+
+      /** @brief motor fault bits reported by vexDeviceMotorFaultsGet */
+      static const uint32_t faultOverTemp        = 0x01;
+      static const uint32_t faultDriver          = 0x02;
+      static const uint32_t faultOverCurrent     = 0x04;
+      static const uint32_t faultDriverCurrent   = 0x08;
+
+      /** @brief motor flag bits reported by vexDeviceMotorFlagsGet */
+      static const uint32_t flagBusy             = 0x01;
+      static const uint32_t flagZeroVelocity     = 0x02;
+      static const uint32_t flagZeroPosition     = 0x04;
+
+      enum class eventType {
+        connected       = 0,
+        disconnected    = 1,
+        stale           = 2,
+        fresh           = 3,
+        stallStart      = 4,
+        stallEnd        = 5,
+        limitStart      = 6,
+        limitEnd        = 7,
+        faultSet        = 8,
+        faultCleared    = 9
+      };
+
+      typedef struct __attribute__ ((__packed__)) _event {
+        uint32_t  time;                   // mS since program start
+        uint8_t   port;                   // zero-based
+        uint8_t   type;                   // eventType
+        uint16_t  value;                  // device type, or the fault bits that changed
+      } event;
+
+    private:
+      static const int32_t  QUEUE_SIZE = 64;
+      static const int32_t  LOG_SIZE   = 128;
+
+      V5_DeviceT    _devices[PORTS];
+      uint8_t       _types[PORTS];
+      uint32_t      _faults[PORTS];
+      uint32_t      _flags[PORTS];
+      uint32_t      _timestamps[PORTS];
+      uint32_t      _changed[PORTS];      // mS when the timestamp last moved
+      uint32_t      _stallSince[PORTS];   // mS when the stall condition started, 0 if none
+
+      // one bit per port
+      uint32_t      _present;
+      uint32_t      _motors;
+      uint32_t      _stale;
+      uint32_t      _stalled;
+      uint32_t      _limited;
+      uint32_t      _faulted;
+      uint32_t      _seen;                // has been present since start
+
+      uint32_t      _staleTime;           // mS
+      uint32_t      _stallTime;           // mS
+      int32_t       _stallCurrent;        // mA
+
+      void        (*_callback)( const event &e );
+
+      event         _queue[QUEUE_SIZE];
+      volatile int32_t _queueHead;
+      volatile int32_t _queueTail;
+
+      FIL          *_log;
+      event         _logBuffer[LOG_SIZE];
+      int32_t       _logCount;
+      uint32_t      _logDropped;
+
+      vex::task    *_task;
+      volatile bool _running;
+      uint32_t      _period;              // mS
+
+      void          _init();
+      void          _post( uint32_t time, int32_t port, eventType type, uint32_t value );
+      void          _edges( uint32_t time, uint32_t before, uint32_t after, eventType rise, eventType fall );
+
+      static int    _run( void *arg );
+
+    public:
+      health_monitor();
+      ~health_monitor();
+
+      /**
+       * @brief Sets how long a device timestamp may stay unchanged before the port is stale.
+       * @param time The time.
+       * @param units The measurement unit for the time.
+       */
+      void    setStaleTime( uint32_t time, timeUnits units );
+
+      /**
+       * @brief Sets when a motor counts as stalled, at zero velocity drawing at least this current, or current limited, for the stall time.
+       * @param current The current in amps.
+       * @param time The stall time in milliseconds.
+       */
+      void    setStallThreshold( double current, uint32_t time );
+
+      /**
+       * @brief Sets a function called from the monitor task for every event.
+       * @param callback The function, NULL to remove.
+       */
+      void    setCallback( void (* callback)( const event &e ) );
+
+      /**
+       * @brief Starts logging events to the SD card, any previous log is closed.
+       * @return Returns true if the file was opened.
+       * @param name The name of the file, it is replaced.
+       */
+      bool    log( const char *name );
+
+      /**
+       * @brief Writes buffered events to the SD card.
+       */
+      void    flush();
+
+      /**
+       * @brief Starts a task that runs update() periodically.
+       * @param period (Optional) The update period in milliseconds.
+       */
+      void    start( uint32_t period = 10 );
+
+      /**
+       * @brief Stops the update task and closes the log.
+       */
+      void    stop();
+
+      /**
+       * @brief Sweeps every port once.
+       * @return Returns the number of events raised.
+       */
+      int32_t update();
+
+      /**
+       * @brief Takes the oldest event from the queue.
+       * @return Returns true if an event was returned.
+       * @param e The event.
+       */
+      bool    poll( event &e );
+
+      /** @brief Gets the ports with a device, one bit per port. */
+      uint32_t present()   { return _present; };
+      /** @brief Gets the ports that were seen and are now missing. */
+      uint32_t missing()   { return _seen & ~_present; };
+      /** @brief Gets the ports whose data has stopped updating. */
+      uint32_t stale()     { return _stale; };
+      /** @brief Gets the motors that are stalled. */
+      uint32_t stalled()   { return _stalled; };
+      /** @brief Gets the motors that are at their current limit. */
+      uint32_t limited()   { return _limited; };
+      /** @brief Gets the motors reporting any fault. */
+      uint32_t faulted()   { return _faulted; };
+
+      /**
+       * @brief Gets the fault bits of a motor.
+       * @return Returns the faults, see faultOverTemp and the other fault constants.
+       * @param port The port index, zero-based.
+       */
+      uint32_t faults( int32_t port );
+  };
+};
+
+#endif // VEX_HEALTHMONITOR_CLASS_H
@@ -0,0 +1,142 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_holonomic.h                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_HOLONOMIC_CLASS_H
+#define   VEX_HOLONOMIC_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_holonomic.h
+  * @brief   Holonomic (X-drive / mecanum) drive class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the holonomic class to drive a four wheel X-drive or mecanum base.
+    * @details
+    *  Wheel speeds for all four motors are mixed together in one pass and
+    *  written back to back using motor voltage control.  When an inertial
+    *  sensor is supplied the drive can be switched to field centric control,
+    *  the heading is read once per call.
+  */
+  class holonomic  {
+    public:
+      enum class layoutType {
+        /** @brief Four omni wheels mounted at 45 degrees in the corners */
+        xdrive,
+        /** @brief Four mecanum wheels, rollers forming an X when viewed from above */
+        mecanum
+      };
+
+      // wheel order used by wheelVoltage()
+      enum class wheelType {
+        frontLeft  = 0,
+        frontRight = 1,
+        rearLeft   = 2,
+        rearRight  = 3
+      };
+
+    private:
+      static const int32_t  WHEEL_COUNT = 4;
+
+      V5_DeviceT    _devices[WHEEL_COUNT];
+      vex::guido   *_g;
+
+      layoutType    _layout;
+      bool          _fieldCentric;
+      double        _strafeScale;
+      double        _headingOffset;
+      int32_t       _maxVoltage;
+      int32_t       _output[WHEEL_COUNT];
+
+      void          _init( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, layoutType layout );
+      void          _mix( double forward, double strafe, double turn, double scale );
+
+    public:
+      /**
+       * @brief Creates a new holonomic drive from four motors.
+       * @param fl The front left motor.
+       * @param fr The front right motor.
+       * @param rl The rear left motor.
+       * @param rr The rear right motor.
+       * @param layout (Optional) The wheel layout, by default this is an X-drive.
+       */
+      holonomic( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, layoutType layout = layoutType::xdrive );
+
+      /**
+       * @brief Creates a new holonomic drive from four motors and an inertial sensor for field centric control.
+       * @param fl The front left motor.
+       * @param fr The front right motor.
+       * @param rl The rear left motor.
+       * @param rr The rear right motor.
+       * @param g The inertial sensor used for heading.
+       * @param layout (Optional) The wheel layout, by default this is an X-drive.
+       */
+      holonomic( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, vex::guido &g, layoutType layout = layoutType::xdrive );
+
+      ~holonomic();
+
+      /**
+       * @brief Enables or disables field centric control. Has no effect unless an inertial sensor was supplied.
+       * @param value If true, forward and strafe are interpreted relative to the field.
+       */
+      void    setFieldCentric( bool value );
+
+      /**
+       * @brief Sets the heading that is considered "forward" on the field.
+       * @param value The heading that is field forward.
+       * @param units The measurement unit for the heading.
+       */
+      void    setHeadingOffset( double value, rotationUnits units );
+
+      /**
+       * @brief Sets the multiplier applied to strafe commands. Mecanum drives default to 1.1 to compensate for roller slip.
+       * @param scale The strafe multiplier.
+       */
+      void    setStrafeScale( double scale );
+
+      /**
+       * @brief Sets the maximum voltage sent to any wheel.
+       * @param value The maximum voltage.
+       * @param units The measurement unit for the voltage value.
+       */
+      void    setMaxVoltage( double value, voltageUnits units );
+
+      /**
+       * @brief Drives the robot with the given forward, strafe and turn components. Wheel outputs are desaturated so that the largest does not exceed 100%.
+       * @param forward The forward component, positive is forwards.
+       * @param strafe The strafe component, positive is to the right.
+       * @param turn The turn component, positive is clockwise.
+       * @param units (Optional) The measurement unit for the components. By default, this parameter is a percentage.
+       */
+      void    drive( double forward, double strafe, double turn, percentUnits units = percentUnits::pct );
+
+      /**
+       * @brief Drives the robot with the given forward, strafe and turn components in volts.
+       * @param forward The forward component, positive is forwards.
+       * @param strafe The strafe component, positive is to the right.
+       * @param turn The turn component, positive is clockwise.
+       * @param units The measurement unit for the components.
+       */
+      void    drive( double forward, double strafe, double turn, voltageUnits units );
+
+      /**
+       * @brief Stops the drive using a specified brake mode.
+       * @param mode The brake mode can be set to coast, brake, or hold.
+       */
+      void    stop( brakeType mode = brakeType::coast );
+
+      /**
+       * @brief Gets the last voltage sent to a wheel.
+       * @return Returns the voltage in the units specified by the parameter.
+       * @param wheel The wheel to query.
+       * @param units (Optional) The measurement unit for the voltage.
+       */
+      double  wheelVoltage( wheelType wheel, voltageUnits units = voltageUnits::volt );
+  };
+};
+
+#endif // VEX_HOLONOMIC_CLASS_H
@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_lazy.h                                                  */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_LAZY_CLASS_H
+#define   VEX_LAZY_CLASS_H
+
+#include <new>
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_lazy.h
+  * @brief   Deferred construction of device objects
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the lazy class to construct a global device object the first time it is used instead of before main.
+    * @details
+    *  The object is built in storage inside the lazy object, nothing is
+    *  allocated.  Constructing a lazy global only stores the arguments, the
+    *  real constructor runs on the first use of -> or * and is recorded in the
+    *  startup_trace.
+    *
+    *  Devices that take a port index, optionally with one more argument, can
+    *  be declared directly
+    *
+    *     vex::lazy<vex::motor>    Arm( PORT1, "arm" );
+    *     vex::lazy<vex::rotation> Lift( PORT2, true, "lift" );
+    *
+    *  Any other constructor can be used through a function
+    *
+    *     void makeLeft( void *p ) { new (p) vex::motor( PORT3, ratio6_1, true ); }
+    *     vex::lazy<vex::motor>    Left( makeLeft, "left" );
+    *
+    *  If two tasks use the object for the first time together, the second
+    *  yields until the first has finished constructing it.
+  */
+  template <class T>
+  class lazy  {
+    private:
+      typedef void (* factory)( void *storage );
+      typedef void (* builder)( void *storage, int32_t index, int32_t arg );
+
+      union {
+        double        _align;
+        char          _storage[ sizeof(T) ];
+      };
+
+      factory         _factory;
+      builder         _builder;
+      int32_t         _index;
+      int32_t         _arg;
+      const char     *_label;
+      volatile uint8_t _state;            // 0 not built, 1 building, 2 built
+
+      static void _fromIndex( void *p, int32_t index, int32_t arg ) {
+        new (p) T( index );
+      }
+      template <typename A>
+      static void _fromIndexArg( void *p, int32_t index, int32_t arg ) {
+        new (p) T( index, (A)arg );
+      }
+
+      T *_object() {
+        return( reinterpret_cast<T *>( _storage ) );
+      }
+
+      T *_get() {
+        if( _state == 2 )
+          return( _object() );
+
+        while( _state == 1 )
+          vex::task::yield();
+
+        if( _state == 0 ) {
+          _state = 1;
+          uint64_t start = vexSystemHighResTimeGet();
+          if( _factory != NULL )
+            _factory( _storage );
+          else
+            _builder( _storage, _index, _arg );
+          startup_trace::span( _label, start );
+          _state = 2;
+        }
+        return( _object() );
+      }
+
+    public:
+      /**
+       * @brief Stores a port index, the object is constructed with T( index ) on first use.
+       * @param index The port index.
+       * @param label (Optional) The name used in the startup trace.
+       */
+      lazy( int32_t index, const char *label = "lazy" )
+        : _factory( NULL ), _builder( _fromIndex ), _index( index ), _arg( 0 ), _label( label ), _state( 0 ) {}
+
+      /**
+       * @brief Stores a port index and one more argument, the object is constructed with T( index, arg ) on first use.
+       * @param index The port index.
+       * @param arg The second constructor argument, for example reverse or a gear setting.
+       * @param label (Optional) The name used in the startup trace.
+       */
+      template <typename A>
+      lazy( int32_t index, A arg, const char *label = "lazy" )
+        : _factory( NULL ), _builder( _fromIndexArg<A> ), _index( index ), _arg( (int32_t)arg ), _label( label ), _state( 0 ) {}
+
+      /**
+       * @brief Stores a function that constructs the object with placement new on first use.
+       * @param f The function, it is passed storage for one T.
+       * @param label (Optional) The name used in the startup trace.
+       */
+      lazy( factory f, const char *label = "lazy" )
+        : _factory( f ), _builder( NULL ), _index( 0 ), _arg( 0 ), _label( label ), _state( 0 ) {}
+
+      ~lazy() {
+        if( _state == 2 )
+          _object()->~T();
+      }
+
+      T *operator->() { return( _get() ); }
+      T &operator*()  { return( *_get() ); }
+
+      /**
+       * @brief Gets the object, constructing it if needed, for passing to functions that take a T reference.
+       * @return Returns the object.
+       */
+      T &get()        { return( *_get() ); }
+
+      /**
+       * @brief Constructs the object now, use this to move the cost to a time of your choosing.
+       */
+      void bind()     { _get(); }
+
+      /**
+       * @brief Checks if the object has been constructed.
+       * @return Returns true once the object exists.
+       */
+      bool constructed() { return( _state == 2 ); }
+  };
+};
+
+#endif // VEX_LAZY_CLASS_H
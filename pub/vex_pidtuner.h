@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_pidtuner.h                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_PIDTUNER_CLASS_H
+#define   VEX_PIDTUNER_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_pidtuner.h
+  * @brief   Relay feedback autotuner for the motor internal PID loops
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the pidtuner class to choose gains for vexDeviceMotorPositionPidSet and vexDeviceMotorVelocityPidSet.
+    * @details
+    *  The mechanism is put into a limit cycle with a relay (bang-bang voltage
+    *  with hysteresis) around a target.  The ultimate gain Ku and period Tu
+    *  are measured from the oscillation and converted to PID gains with the
+    *  selected tuning rule.  Results are for the attached load and gear
+    *  cartridge and can be saved to the SD card and re-applied at startup.
+    *
+    *  Firmware gains are 4.4 fixed point, the scale between the measured gain
+    *  (mV per encoder count) and firmware units is inferred and can be
+    *  adjusted with setFirmwareScale().
+  */
+  class pidtuner  {
+    public:
+      enum class loopType {
+        position = 0,
+        velocity = 1
+      };
+
+      enum class ruleType {
+        /** @brief Classic Ziegler-Nichols, fast with overshoot */
+        zieglerNichols = 0,
+        /** @brief Tyreus-Luyben, slower and more robust */
+        tyreusLuyben,
+        /** @brief Ziegler-Nichols "no overshoot" variant */
+        noOvershoot
+      };
+
+      typedef struct _result {
+        bool              valid;
+        loopType          loop;
+        V5MotorGearset    gearset;
+        double            ku;             // mV per degree or mV per rpm
+        double            tu;             // seconds
+        double            amplitude;      // degrees or rpm
+        double            kp;             // mV per count
+        double            ki;             // mV per count second
+        double            kd;             // mV second per count
+        double            kf;             // mV per rpm, velocity loop only
+        V5_DeviceMotorPid pid;            // firmware gains
+      } result;
+
+    private:
+      static const int32_t  MAX_MOTORS = 8;
+
+      V5_DeviceT          _devices[MAX_MOTORS];
+      int32_t             _ports[MAX_MOTORS];
+      int32_t             _count;
+
+      int32_t             _relay;         // mV
+      double              _hysteresis;
+      int32_t             _cycles;
+      uint32_t            _timeout;       // mS
+      ruleType            _rule;
+      double              _firmwareScale;
+      V5_DeviceMotorPid   _template;
+
+      void          _addMotor();
+      void          _addMotor( vex::motor &m );
+
+      template <typename... Args>
+      void _addMotor(  vex::motor &m1, Args &... m2 ) {
+         _addMotor( m1 );
+         _addMotor( m2... );
+      }
+
+      void          _init();
+      void          _setVoltage( int32_t mv );
+      double        _measure( loopType loop );
+      double        _countsPerDegree( V5MotorGearset gearset );
+      uint8_t       _toFixed( double gain );
+      void          _convert( result &r );
+      result        _runRelay( loopType loop, double target, int32_t base, int32_t relay );
+
+    public:
+      pidtuner();
+      ~pidtuner();
+
+      template <typename... Args>
+      pidtuner( vex::motor &m1, Args &... m2 ) : pidtuner() {
+        _addMotor( m1 );
+        _addMotor( m2... );
+      }
+
+      /**
+       * @brief Sets the relay output used during tuning.
+       * @param value The relay amplitude.
+       * @param units The measurement unit for the voltage.
+       */
+      void    setRelayAmplitude( double value, voltageUnits units );
+
+      /**
+       * @brief Sets the relay hysteresis, this rejects sensor noise around the target.
+       * @param value The hysteresis in degrees for position tuning or rpm for velocity tuning.
+       */
+      void    setHysteresis( double value );
+
+      /**
+       * @brief Sets the number of oscillation cycles that are averaged.
+       * @param cycles The number of cycles.
+       */
+      void    setCycles( int32_t cycles );
+
+      /**
+       * @brief Sets the time after which tuning is abandoned.
+       * @param time The timeout.
+       * @param units The measurement unit for the time value.
+       */
+      void    setTimeout( int32_t time, timeUnits units );
+
+      /**
+       * @brief Sets the rule used to convert Ku and Tu to gains.
+       * @param rule The tuning rule.
+       */
+      void    setRule( ruleType rule );
+
+      /**
+       * @brief Sets the filter, limit, threshold and loopspeed fields copied into every result.
+       * @param pid The template, gain fields are ignored.
+       */
+      void    setTemplate( const V5_DeviceMotorPid &pid );
+
+      /**
+       * @brief Sets the scale from mV per encoder count to firmware gain units.
+       * @param scale The scale factor.
+       */
+      void    setFirmwareScale( double scale );
+
+      /**
+       * @brief Runs a relay test about the current position.
+       * @return Returns the result, valid is false if no stable oscillation was found.
+       */
+      result  tunePosition();
+
+      /**
+       * @brief Runs a relay test about a target velocity.
+       * @return Returns the result, valid is false if no stable oscillation was found.
+       * @param velocity The target velocity.
+       * @param units The measurement unit for the velocity.
+       */
+      result  tuneVelocity( double velocity, velocityUnits units );
+
+      /**
+       * @brief Sends the gains in a result to all motors.
+       * @param r The result to apply.
+       */
+      void    apply( const result &r );
+
+      /**
+       * @brief Saves a result to the SD card for every motor, existing entries for the same port, loop and gearset are replaced.
+       * @return Returns true if the file was written.
+       * @param name The name of the file.
+       * @param r The result to save.
+       */
+      bool    save( const char *name, const result &r );
+
+      /**
+       * @brief Loads saved gains from the SD card and applies those that match each motor's port and current gearset.
+       * @return Returns the number of entries applied.
+       * @param name The name of the file.
+       */
+      int32_t load( const char *name );
+  };
+};
+
+#endif // VEX_PIDTUNER_CLASS_H
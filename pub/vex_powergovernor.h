@@ -0,0 +1,206 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_powergovernor.h                                         */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_POWERGOVERNOR_CLASS_H
+#define   VEX_POWERGOVERNOR_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_powergovernor.h
+  * @brief   Battery aware motor current governor class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the power_governor class to share a battery current budget between groups of motors by priority.
+    * @details
+    *  Every tick the governor reads the battery voltage and current and
+    *  tracks the battery as an open circuit voltage behind an internal
+    *  resistance.  The current budget is the smaller of the configured
+    *  budget and the current that would pull the battery down to the
+    *  brownout voltage.
+    *
+    *  Each group is guaranteed its minimum current.  The rest of the budget
+    *  is handed out in priority order, each group asking for what its motors
+    *  draw now plus some headroom, and any current left over is shared out.
+    *  A group's allocation is split evenly between its motors with
+    *  vexDeviceMotorCurrentLimitSet.  With a thermal_model attached each
+    *  motor is also held to the limit the model recommends.
+  */
+  class power_governor  {
+    public:
+      /** @brief suggested priorities, any integer may be used and higher wins */
+      static const int32_t  priorityDrive  = 30;
+      static const int32_t  priorityIntake = 20;
+      static const int32_t  priorityLift   = 10;
+
+    private:
+      static const int32_t  MAX_GROUPS = 8;
+      static const int32_t  MAX_MOTORS = 8;
+
+      typedef struct _group {
+        V5_DeviceT      devices[MAX_MOTORS];
+        int32_t         ports[MAX_MOTORS];
+        int32_t         limits[MAX_MOTORS];   // mA, last value sent
+        int32_t         count;
+        int32_t         priority;
+        double          minimum;              // A
+        double          maximum;              // A
+        double          ceiling;              // A, maximum after thermal limits
+        double          demand;               // A, measured this tick
+        double          allocation;           // A
+      } group;
+
+      group         _groups[MAX_GROUPS];
+      int32_t       _count;
+
+      double        _budget;                  // A, configured
+      double        _available;               // A, after the battery model
+      double        _brownoutVoltage;         // V
+      double        _headroom;                // A per motor
+      thermal_model *_thermal;
+
+      // exponentially weighted battery statistics
+      double        _meanV, _meanI, _varI, _covVI;
+      double        _resistance;              // ohms
+      double        _openCircuit;             // V
+      double        _voltage;                 // V, last reading
+      double        _current;                 // A, last reading
+      double        _sagScale;                // 0..1, cut after a measured sag
+      bool          _primed;
+
+      vex::task    *_task;
+      volatile bool _running;
+      uint32_t      _period;                  // mS
+
+      void          _init();
+      void          _addMotor( int32_t g );
+      void          _addMotor( int32_t g, vex::motor &m );
+
+      template <typename... Args>
+      void _addMotor( int32_t g, vex::motor &m1, Args &... m2 ) {
+         _addMotor( g, m1 );
+         _addMotor( g, m2... );
+      }
+
+      int32_t       _newGroup( int32_t priority );
+      void          _battery();
+      void          _allocate();
+      void          _apply();
+
+      static int    _run( void *arg );
+
+    public:
+      power_governor();
+      ~power_governor();
+
+      /**
+       * @brief Adds a group of motors.
+       * @return Returns the group index, or -1 if there are too many groups.
+       * @param priority The group priority, higher priorities are served first.
+       * @param m1 The motors in the group.
+       */
+      template <typename... Args>
+      int32_t addGroup( int32_t priority, vex::motor &m1, Args &... m2 ) {
+        int32_t g = _newGroup( priority );
+        if( g >= 0 ) {
+          _addMotor( g, m1 );
+          _addMotor( g, m2... );
+        }
+        return g;
+      }
+
+      /**
+       * @brief Sets the guaranteed and maximum current of a group.
+       * @param g The group index.
+       * @param minimum The current the group always receives, in amps.
+       * @param maximum The largest current the group will be given, in amps.
+       */
+      void    setGroupLimits( int32_t g, double minimum, double maximum );
+
+      /**
+       * @brief Sets the total current budget for all groups.
+       * @param value The budget.
+       * @param units The measurement unit for the current.
+       */
+      void    setBudget( double value, currentUnits units );
+
+      /**
+       * @brief Sets the battery voltage the governor will try to stay above.
+       * @param value The brownout voltage.
+       * @param units The measurement unit for the voltage.
+       */
+      void    setBrownoutVoltage( double value, voltageUnits units );
+
+      /**
+       * @brief Sets the extra current a group may ask for above what it draws now.
+       * @param value The headroom per motor in amps.
+       */
+      void    setHeadroom( double value );
+
+      /**
+       * @brief Attaches a thermal model, motor limits are capped at the limit it recommends. The model stops writing limits itself.
+       * @param model The thermal model, it must be updated separately.
+       */
+      void    setThermalModel( thermal_model &model );
+
+      /**
+       * @brief Starts a task that runs update() periodically.
+       * @param period (Optional) The update period in milliseconds.
+       */
+      void    start( uint32_t period = 20 );
+
+      /**
+       * @brief Stops the update task, current limits are left as they are.
+       */
+      void    stop();
+
+      /**
+       * @brief Reads the battery and motors and reallocates current limits.
+       */
+      void    update();
+
+      /**
+       * @brief Gets the current allocated to a group.
+       * @return Returns the allocation in amps.
+       * @param g The group index.
+       */
+      double  allocation( int32_t g );
+
+      /**
+       * @brief Gets the budget after the battery model has been applied.
+       * @return Returns the available current in amps.
+       */
+      double  available();
+
+      /**
+       * @brief Gets the estimated battery internal resistance, including wiring.
+       * @return Returns the resistance in ohms.
+       */
+      double  resistance();
+
+      /**
+       * @brief Gets the estimated battery open circuit voltage.
+       * @return Returns the voltage in volts.
+       */
+      double  openCircuitVoltage();
+
+      /**
+       * @brief Predicts the battery voltage at a given total current.
+       * @return Returns the predicted voltage in volts.
+       * @param current The total current in amps.
+       */
+      double  predictedVoltage( double current );
+
+      /**
+       * @brief Checks if every group running at its maximum would brown out the battery.
+       * @return Returns true if a brownout is predicted.
+       */
+      bool    brownoutPredicted();
+  };
+};
+
+#endif // VEX_POWERGOVERNOR_CLASS_H
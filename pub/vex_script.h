@@ -0,0 +1,221 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_script.h                                                */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_SCRIPT_CLASS_H
+#define   VEX_SCRIPT_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_script.h
+  * @brief   Bytecode interpreter for autonomous routines
+*//*---------------------------------------------------------------------------*/
+
+//
+// Every instruction is an opcode byte followed by its operands, in the
+// order given by the format string.
+//   d  drivetrain or motor group index, one byte
+//   u  unit, brake mode, flag or signal number, one byte
+//   f  float, four bytes
+//   c  repeat count, two bytes
+//   o  signed offset from the end of the instruction, two bytes
+// Values are little endian and not aligned.  The opcode is written to
+// the file and must never change, add new ones at the end.
+//
+#define VEX_SCRIPT_OPCODES( X ) \
+  X(  0, end,             ""      )   /* stop the script                                  */ \
+  X(  1, wait,            "f"     )   /* mS                                               */ \
+  X(  2, driveVelocity,   "dfu"   )   /* setDriveVelocity, velocityUnits                  */ \
+  X(  3, turnVelocity,    "dfu"   )   /* setTurnVelocity, velocityUnits                   */ \
+  X(  4, driveFor,        "dfuu"  )   /* distance, distanceUnits, wait                    */ \
+  X(  5, turnFor,         "dfuu"  )   /* angle to the right, rotationUnits, wait          */ \
+  X(  6, turnToHeading,   "dfuu"  )   /* heading, rotationUnits, wait, smartdrive only    */ \
+  X(  7, driveStop,       "du"    )   /* brakeType                                        */ \
+  X(  8, driveWait,       "d"     )   /* until the drivetrain is done                     */ \
+  X(  9, groupVelocity,   "dfu"   )   /* setVelocity, velocityUnits                       */ \
+  X( 10, spinFor,         "dfuu"  )   /* rotation, rotationUnits, wait                    */ \
+  X( 11, spinForTime,     "dfu"   )   /* time, timeUnits                                  */ \
+  X( 12, spinToPosition,  "dfuu"  )   /* rotation, rotationUnits, wait                    */ \
+  X( 13, groupStop,       "du"    )   /* brakeType                                        */ \
+  X( 14, groupWait,       "d"     )   /* until the group is done                          */ \
+  X( 15, signal,          "u"     )   /* broadcast the event attached to a signal         */ \
+  X( 16, await,           "uf"    )   /* signal, timeout mS or 0 to wait forever          */ \
+  X( 17, repeat,          "c"     )   /* run to the matching next count times             */ \
+  X( 18, next,            "o"     )   /* back to after the repeat                         */
+
+namespace vex {
+  class drivetrain;
+  class smartdrive;
+  class motor_group;
+  class event;
+
+  /**
+    * @brief Use the script class to run autonomous routines compiled to bytecode and loaded from the SD card.
+    * @details
+    *  tools/scriptc.cpp compiles a text routine to a small binary.  The
+    *  program attaches its drivetrains and motor groups by index, loads
+    *  the binary at startup and runs it from the autonomous callback.  A
+    *  routine can change between matches by replacing the file, without
+    *  rebuilding the program.
+    *
+    *     vex::script auton;
+    *     auton.attach( 0, Drivetrain );
+    *     auton.attach( 1, Intake );
+    *     auton.load( "auton.bin" );
+    *     ...
+    *     void autonomous() { auton.run(); }
+    *
+    *  The code is checked once when it is loaded.  run() can then dispatch
+    *  with computed gotos and no bounds checks.  Nothing is allocated, the
+    *  code lives in the object.
+    *
+    *  Signals let a routine wait for the program and wake it up.  signal()
+    *  sets a signal that an await instruction is waiting for.  The signal
+    *  instruction broadcasts the vex::event attached to that number.
+  */
+  class script  {
+    public:
+      static const uint32_t MAGIC       = 0x52435341;   // 'ASCR'
+      static const uint16_t VERSION     = 1;
+      static const int32_t  MAX_CODE    = 4096;
+      static const int32_t  MAX_DRIVES  = 4;
+      static const int32_t  MAX_GROUPS  = 8;
+      static const int32_t  MAX_SIGNALS = 32;
+      static const int32_t  MAX_DEPTH   = 4;            // nested repeats
+
+      typedef struct _header {
+        uint32_t    magic;
+        uint16_t    version;
+        uint16_t    size;                               // bytes of code that follow
+      } header;
+
+      #define VEX_SCRIPT_ENUM( id, name, format )   name = id,
+      enum class opcode : uint8_t {
+        VEX_SCRIPT_OPCODES( VEX_SCRIPT_ENUM )
+        count
+      };
+      #undef  VEX_SCRIPT_ENUM
+
+      enum class statusType {
+        /** @brief nothing loaded */
+        empty,
+        /** @brief loaded and checked */
+        ready,
+        running,
+        /** @brief reached an end instruction */
+        done,
+        /** @brief stop() was called */
+        stopped,
+        /** @brief the file could not be read or is not a script */
+        badFile,
+        /** @brief the code failed the load check, see position() */
+        badCode,
+        /** @brief an instruction uses an index with nothing attached, see position() */
+        noDevice
+      };
+
+    private:
+      uint8_t           _code[MAX_CODE];
+      int32_t           _size;
+      drivetrain       *_drives[MAX_DRIVES];
+      smartdrive       *_smart[MAX_DRIVES];
+      motor_group      *_groups[MAX_GROUPS];
+      event            *_events[MAX_SIGNALS];
+
+      volatile uint32_t _signals;
+      volatile bool     _abort;
+      statusType        _status;
+      int32_t           _position;                      // offset of the last instruction run
+      uint32_t          _steps;
+
+      bool              _check();
+      bool              _sleep( uint32_t ms );
+      bool              _until( bool (* done)( void * ), void *arg );
+
+    public:
+      script();
+      ~script();
+
+      /**
+       * @brief Attaches a drivetrain to an index.
+       * @param index The index used by the script.
+       * @param d The drivetrain.
+       */
+      void        attach( int32_t index, drivetrain &d );
+
+      /**
+       * @brief Attaches a smartdrive to an index, it can also turn to a heading.
+       * @param index The index used by the script.
+       * @param d The smartdrive.
+       */
+      void        attach( int32_t index, smartdrive &d );
+
+      /**
+       * @brief Attaches a motor group to an index.
+       * @param index The index used by the script.
+       * @param g The motor group.
+       */
+      void        attach( int32_t index, motor_group &g );
+
+      /**
+       * @brief Attaches an event to a signal number, the signal instruction broadcasts it.
+       * @param signal The signal number, 0 to 31.
+       * @param e The event.
+       */
+      void        attach( int32_t signal, event &e );
+
+      /**
+       * @brief Loads and checks a compiled script from the SD card.
+       * @return Returns true if the script can be run.
+       * @param name The name of the file.
+       */
+      bool        load( const char *name );
+
+      /**
+       * @brief Loads and checks a compiled script from memory, the data is copied.
+       * @return Returns true if the script can be run.
+       * @param data The header followed by the code.
+       * @param size The size of data in bytes.
+       */
+      bool        load( const uint8_t *data, int32_t size );
+
+      /**
+       * @brief Runs the script in the calling task until it ends or stop() is called.
+       * @return Returns done, stopped or noDevice, or the load status if the script is not ready.
+       */
+      statusType  run();
+
+      /**
+       * @brief Stops a running script at the next instruction or wait, motors that are moving are not stopped.
+       */
+      void        stop();
+
+      /**
+       * @brief Sets a signal for an await instruction.
+       * @param signal The signal number, 0 to 31.
+       */
+      void        signal( int32_t signal );
+
+      /**
+       * @brief Gets the script status.
+       * @return Returns the status.
+       */
+      statusType  status();
+
+      /**
+       * @brief Gets the offset of the last instruction run, or of the first bad one after a failed load.
+       * @return Returns the byte offset in the code.
+       */
+      int32_t     position();
+
+      /**
+       * @brief Gets the number of instructions run by the last run().
+       * @return Returns the count.
+       */
+      uint32_t    steps();
+  };
+};
+
+#endif // VEX_SCRIPT_CLASS_H
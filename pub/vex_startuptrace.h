@@ -0,0 +1,113 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_startuptrace.h                                          */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_STARTUPTRACE_CLASS_H
+#define   VEX_STARTUPTRACE_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_startuptrace.h
+  * @brief   Startup time profiler class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the startup_trace class to measure how long the program takes from start to its first control tick.
+    * @details
+    *  The trace starts when static initialization starts, the library
+    *  constructs its own marker with the highest init priority.  Global
+    *  objects in one file are constructed in the order they are defined, so
+    *  a startup_trace::point placed between them timestamps each constructor
+    *  with vexSystemHighResTimeGet.  lazy objects add an entry with the time
+    *  they took when they are first used.  Call mark() at interesting points
+    *  in main and firstTick() at the top of the first control loop iteration.
+    *
+    *  All entries are kept in a fixed table, nothing is allocated.
+  */
+  class startup_trace  {
+    public:
+      typedef struct _entry {
+        const char *label;
+        uint32_t    time;                 // uS since the trace started
+        uint32_t    duration;             // uS, 0 for a plain mark
+      } entry;
+
+      /**
+       * @brief A global object that marks the trace when it is constructed.
+       */
+      class point {
+        public:
+          point( const char *label ) { startup_trace::mark( label ); };
+          ~point() {};
+      };
+
+    private:
+      static const int32_t  MAX_ENTRIES = 64;
+
+      static entry      _entries[MAX_ENTRIES];
+      static int32_t    _count;
+      static uint32_t   _dropped;
+      static uint64_t   _start;
+      static uint32_t   _firstTick;
+
+    public:
+      /**
+       * @brief Restarts the trace, entries are cleared. Called automatically before any global constructor.
+       */
+      static void     begin();
+
+      /**
+       * @brief Adds a timestamped entry.
+       * @param label The entry label, the string must remain valid.
+       */
+      static void     mark( const char *label );
+
+      /**
+       * @brief Adds an entry with a duration.
+       * @param label The entry label, the string must remain valid.
+       * @param start The vexSystemHighResTimeGet value when the measured work started.
+       */
+      static void     span( const char *label, uint64_t start );
+
+      /**
+       * @brief Marks the first control tick, only the first call has any effect.
+       */
+      static void     firstTick();
+
+      /**
+       * @brief Gets the time from the start of the trace to the first control tick.
+       * @return Returns the time in uS, or 0 if firstTick() has not been called.
+       */
+      static uint32_t startupTime();
+
+      /**
+       * @brief Gets the number of entries.
+       * @return Returns the entry count.
+       */
+      static int32_t  count();
+
+      /**
+       * @brief Gets an entry.
+       * @return Returns a pointer to the entry or NULL if index is out of range.
+       * @param index The entry index.
+       */
+      static const entry *data( int32_t index );
+
+      /**
+       * @brief Prints the trace to the serial console.
+       */
+      static void     print();
+
+      /**
+       * @brief Saves the trace to the SD card as CSV.
+       * @return Returns true if the file was written.
+       * @param name The name of the file.
+       */
+      static bool     save( const char *name );
+  };
+};
+
+#endif // VEX_STARTUPTRACE_CLASS_H
@@ -0,0 +1,168 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_sysid.h                                                 */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_SYSID_CLASS_H
+#define   VEX_SYSID_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_sysid.h
+  * @brief   Feedforward characterization (system identification) class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the sysid class to measure the feedforward constants of a mechanism.
+    * @details
+    *  The motors are driven open loop with vexDeviceMotorVoltageSet through a
+    *  slow quasistatic ramp and a voltage step.  Every new device sample is
+    *  logged with its timestamp and the model
+    *
+    *     V = kS * sgn(v) + kV * v + kA * a
+    *
+    *  is fitted by least squares.  The log can be saved to the SD card as CSV
+    *  and refitted on a PC with tools/sysid_fit.cpp.
+    *
+    *  Pass all motors of a motor_group, or both sides of a drivetrain, to the
+    *  constructor.  Drivetrains should be characterized driving straight.
+  */
+  class sysid  {
+    public:
+      enum class testType {
+        quasistatic = 0,
+        dynamic     = 1
+      };
+
+      /**
+       * @brief one logged sample, position, velocity and voltage are averaged over all motors and current is summed
+       */
+      typedef struct __attribute__ ((__packed__)) _sample {
+        uint32_t  time;                   // uS since the start of the test
+        uint32_t  timestamp;              // device timestamp of the first motor
+        int16_t   voltage;                // commanded voltage in mV
+        uint8_t   test;                   // testType
+        uint8_t   run;                    // test number since the log was cleared
+        float     position;               // degrees
+        float     velocity;               // rpm
+        int32_t   current;                // mA
+      } sample;
+
+      /**
+       * @brief result of the least squares fit
+       */
+      typedef struct _result {
+        double    kS;                     // V
+        double    kV;                     // V per rpm
+        double    kA;                     // V per rpm/s
+        double    r2;                     // coefficient of determination
+        double    freeSpeed;              // rpm at 12V, kS removed
+        double    timeConstant;           // seconds, kA / kV
+        int32_t   samples;                // samples used by the fit
+        V5MotorGearset gearset;
+      } result;
+
+    private:
+      static const int32_t  MAX_MOTORS = 8;
+
+      V5_DeviceT    _devices[MAX_MOTORS];
+      int32_t       _count;
+
+      sample       *_log;
+      int32_t       _capacity;
+      int32_t       _length;
+      uint8_t       _runs;
+      double        _positionLimit;
+
+      void          _addMotor();
+      void          _addMotor( vex::motor &m );
+
+      template <typename... Args>
+      void _addMotor(  vex::motor &m1, Args &... m2 ) {
+         _addMotor( m1 );
+         _addMotor( m2... );
+      }
+
+      void          _init();
+      void          _setVoltage( int32_t mv );
+      bool          _record( testType test, uint64_t start, int32_t mv, uint32_t *lastTimestamp );
+      bool          _run( testType test, double rate, double voltage, uint32_t timeout, directionType dir );
+
+    public:
+      sysid();
+      ~sysid();
+
+      template <typename... Args>
+      sysid( vex::motor &m1, Args &... m2 ) : sysid() {
+        _addMotor( m1 );
+        _addMotor( m2... );
+      }
+
+      /**
+       * @brief Sets the maximum number of samples that will be logged. The log is cleared.
+       * @param samples The capacity of the log.
+       */
+      void    setCapacity( int32_t samples );
+
+      /**
+       * @brief Sets a travel limit, a test will stop early if the first motor moves further than this from where the test started.
+       * @param value The travel limit, zero disables the limit.
+       * @param units The measurement unit for the travel limit.
+       */
+      void    setPositionLimit( double value, rotationUnits units );
+
+      /**
+       * @brief Runs a quasistatic test, the voltage is ramped slowly so that acceleration is negligible.
+       * @return Returns false if the test was stopped early by the travel limit or because the log is full.
+       * @param rate The ramp rate in volts per second.
+       * @param maxVoltage The voltage at which the test ends.
+       * @param dir (Optional) The direction to drive.
+       */
+      bool    quasistatic( double rate, double maxVoltage, directionType dir = directionType::fwd );
+
+      /**
+       * @brief Runs a dynamic test, a voltage step is applied and held.
+       * @return Returns false if the test was stopped early by the travel limit or because the log is full.
+       * @param voltage The step voltage.
+       * @param time The length of the test.
+       * @param units The measurement unit for the time value.
+       * @param dir (Optional) The direction to drive.
+       */
+      bool    dynamic( double voltage, double time, timeUnits units, directionType dir = directionType::fwd );
+
+      /**
+       * @brief Fits kS, kV and kA to all logged samples.
+       * @return Returns the result of the fit, samples is zero if there was not enough data.
+       */
+      result  fit();
+
+      /**
+       * @brief Saves the log to the SD card as CSV.
+       * @return Returns the number of samples written, or -1 if the file could not be opened.
+       * @param name The name of the file.
+       */
+      int32_t save( const char *name );
+
+      /**
+       * @brief Clears the log.
+       */
+      void    clear();
+
+      /**
+       * @brief Gets the number of logged samples.
+       * @return Returns the number of samples in the log.
+       */
+      int32_t count() { return _length; };
+
+      /**
+       * @brief Gets a logged sample.
+       * @return Returns a pointer to the sample or NULL if index is out of range.
+       * @param index The sample index.
+       */
+      const sample *data( int32_t index );
+  };
+};
+
+#endif // VEX_SYSID_CLASS_H
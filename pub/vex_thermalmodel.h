@@ -0,0 +1,172 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_thermalmodel.h                                          */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#ifndef   VEX_THERMALMODEL_CLASS_H
+#define   VEX_THERMALMODEL_CLASS_H
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_thermalmodel.h
+  * @brief   Motor thermal model and predictive derating class header
+*//*---------------------------------------------------------------------------*/
+
+namespace vex {
+  /**
+    * @brief Use the thermal_model class to predict motor temperature and reduce current before the firmware throttles a motor.
+    * @details
+    *  Each motor is modelled as a single thermal mass
+    *
+    *     dT/dt = gain * I^2 - loss * ( T - ambient )
+    *
+    *  with gain and loss fitted online, per motor, from the current and the
+    *  reported temperature.  The temperature at the prediction horizon is
+    *  found assuming the recent average I^2 continues, and the current limit
+    *  is ramped down smoothly as the prediction moves from the start
+    *  threshold to the limit threshold.
+    *
+    *  All 21 smart ports are held as structure of arrays and updated in one
+    *  branch free pass, ports without a motor are masked out.  When used with
+    *  a power_governor, pass the model to power_governor::setThermalModel()
+    *  and the governor will apply the limits instead.
+  */
+  class thermal_model  {
+    public:
+      static const int32_t  PORTS = 21;
+
+    private:
+      V5_DeviceT    _devices[PORTS];
+      float         _present[PORTS];          // 1 for a motor, 0 otherwise
+      float         _measured[PORTS];         // C
+      float         _current2[PORTS];         // A^2, this tick
+      float         _model[PORTS];            // C, model state
+      float         _heat[PORTS];             // A^2, running average used for prediction
+      float         _gain[PORTS];             // C/s per A^2
+      float         _loss[PORTS];             // 1/s
+      float         _predicted[PORTS];        // C at the horizon
+      float         _limit[PORTS];            // A
+      int32_t       _sent[PORTS];             // mA, last limit sent
+
+      // fit, integrals over the current window and forgetting sums
+      float         _windowQ[PORTS];          // integral of I^2 dt
+      float         _windowE[PORTS];          // integral of ( T - ambient ) dt
+      float         _windowT[PORTS];          // measured temperature at window start
+      float         _sQQ[PORTS], _sQE[PORTS], _sEE[PORTS], _sQY[PORTS], _sEY[PORTS];
+
+      float         _ambient;                 // C
+      bool          _ambientSet;
+      float         _horizon;                 // s
+      float         _startTemp;               // C
+      float         _limitTemp;               // C
+      float         _minCurrent;              // A
+      float         _maxCurrent;              // A
+      bool          _derate;
+      uint32_t      _window;                  // mS
+      uint64_t      _windowStart;             // uS
+      uint64_t      _last;                    // uS
+
+      vex::task    *_task;
+      volatile bool _running;
+      uint32_t      _period;                  // mS
+
+      void          _init();
+      void          _read();
+      void          _step( float dt );
+      void          _fit();
+      void          _apply();
+
+      static int    _run( void *arg );
+
+    public:
+      thermal_model();
+      ~thermal_model();
+
+      /**
+       * @brief Sets how far ahead temperature is predicted.
+       * @param time The horizon, 30 to 60 seconds works well.
+       * @param units The measurement unit for the time.
+       */
+      void    setHorizon( double time, timeUnits units );
+
+      /**
+       * @brief Sets the predicted temperatures between which current is reduced.
+       * @param start Derating starts when the prediction reaches this temperature in celsius.
+       * @param limit The current is at its minimum when the prediction reaches this temperature in celsius.
+       */
+      void    setThresholds( double start, double limit );
+
+      /**
+       * @brief Sets the range of the current limit applied to each motor.
+       * @param minimum The current limit at the limit threshold in amps.
+       * @param maximum The current limit below the start threshold in amps.
+       */
+      void    setCurrentRange( double minimum, double maximum );
+
+      /**
+       * @brief Sets the ambient temperature, by default the coldest motor at the first update is used.
+       * @param value The ambient temperature in celsius.
+       */
+      void    setAmbient( double value );
+
+      /**
+       * @brief Enables or disables writing current limits to the motors.
+       * @param enable Set to false when another class applies the limits.
+       */
+      void    setDerate( bool enable );
+
+      /**
+       * @brief Starts a task that runs update() periodically.
+       * @param period (Optional) The update period in milliseconds.
+       */
+      void    start( uint32_t period = 100 );
+
+      /**
+       * @brief Stops the update task.
+       */
+      void    stop();
+
+      /**
+       * @brief Reads every motor, advances the model and updates the current limits.
+       */
+      void    update();
+
+      /**
+       * @brief Gets the temperature reported by a motor.
+       * @return Returns the temperature in celsius, or 0 if there is no motor on the port.
+       * @param port The port index, zero-based.
+       */
+      double  temperature( int32_t port );
+
+      /**
+       * @brief Gets the predicted temperature of a motor at the horizon.
+       * @return Returns the temperature in celsius, or 0 if there is no motor on the port.
+       * @param port The port index, zero-based.
+       */
+      double  predicted( int32_t port );
+
+      /**
+       * @brief Gets the current limit the model recommends for a motor.
+       * @return Returns the limit in amps.
+       * @param port The port index, zero-based.
+       */
+      double  limit( int32_t port );
+
+      /**
+       * @brief Gets the fitted thermal time constant of a motor.
+       * @return Returns the time constant in seconds.
+       * @param port The port index, zero-based.
+       */
+      double  timeConstant( int32_t port );
+
+      /**
+       * @brief Gets the fitted steady state temperature rise of a motor per amp squared.
+       * @return Returns the rise in celsius per A^2.
+       * @param port The port index, zero-based.
+       */
+      double  steadyRise( int32_t port );
+  };
+};
+
+#endif // VEX_THERMALMODEL_CLASS_H
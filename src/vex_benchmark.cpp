@@ -0,0 +1,305 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_benchmark.cpp                                           */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+
+// not v5_cpp.h, this file is also built on a host by tools/bench_host.cpp
+#include "v5_api.h"
+#include "vex_task.h"
+#include "vex_thread.h"
+#include "vex_benchmark.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_benchmark.cpp
+  * @brief   Microbenchmark harness class
+*//*---------------------------------------------------------------------------*/
+
+#define FILE_BLOCK        512
+
+using namespace vex;
+
+const char * const benchmark::TEMP_FILE = "bench.tmp";
+
+benchmark::benchmark( int32_t samples, int32_t warmup ) {
+    _count   = 0;
+    _samples = ( samples < 1 ) ? 1 : ( samples > MAX_SAMPLES ) ? MAX_SAMPLES : samples;
+    _warmup  = ( warmup < 0 ) ? 0 : warmup;
+    _scale   = 1;
+}
+
+benchmark::~benchmark() {
+}
+
+void
+benchmark::setBatchScale( int32_t scale ) {
+    _scale = ( scale < 1 ) ? 1 : scale;
+}
+
+bool
+benchmark::add( const char *name, function fn, void *arg, int32_t batch ) {
+    if( _count >= MAX_CASES || fn == NULL )
+      return( false );
+
+    entry *e = &_cases[ _count ];
+    e->name  = name;
+    e->fn    = fn;
+    e->arg   = arg;
+    e->batch = ( batch < 1 ) ? 1 : batch;
+
+    memset( &_results[ _count ], 0, sizeof(result) );
+    _results[ _count ].name = name;
+    _count++;
+    return( true );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Measurement                                                      */
+/*---------------------------------------------------------------------------*/
+
+static int
+_compare( const void *a, const void *b ) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return( (x > y) - (x < y) );
+}
+
+static void
+_empty( void *arg ) {
+}
+
+// uS per batch to nS per call, less the cost of the loop and clock
+static inline float
+_perCall( float us, float scale, float overhead ) {
+    float ns = us * scale - overhead;
+    return( ( ns > 0 ) ? ns : 0 );
+}
+
+void
+benchmark::_measure( const entry *e, result *r, float overhead ) {
+    int32_t batch = e->batch * _scale;
+
+    for( int i=0;i<_warmup;i++ ) {
+      for( int j=0;j<batch;j++ )
+        e->fn( e->arg );
+    }
+
+    uint64_t total = 0;
+    for( int i=0;i<_samples;i++ ) {
+      uint64_t start = vexSystemHighResTimeGet();
+      for( int j=0;j<batch;j++ )
+        e->fn( e->arg );
+      _times[i] = (uint32_t)( vexSystemHighResTimeGet() - start );
+      total += _times[i];
+    }
+
+    qsort( _times, _samples, sizeof(uint32_t), _compare );
+
+    float scale = 1000.0f / batch;
+
+    r->samples = _samples;
+    r->batch   = batch;
+    r->min     = _perCall( _times[0], scale, overhead );
+    r->p50     = _perCall( _times[ _samples / 2 ], scale, overhead );
+    r->p90     = _perCall( _times[ ( _samples * 90 ) / 100 ], scale, overhead );
+    r->p99     = _perCall( _times[ ( _samples * 99 ) / 100 ], scale, overhead );
+    r->max     = _perCall( _times[ _samples - 1 ], scale, overhead );
+    r->mean    = _perCall( (float)total / _samples, scale, overhead );
+}
+
+//
+// The loop and clock cost per call depends on the batch size, so the empty
+// case is measured once for every batch size in use.
+//
+void
+benchmark::run() {
+    int32_t batches[MAX_CASES];
+    float   overhead[MAX_CASES];
+    int32_t n = 0;
+
+    for( int i=0;i<_count;i++ ) {
+      int b = 0;
+      while( b < n && batches[b] != _cases[i].batch )
+        b++;
+
+      if( b == n ) {
+        entry  empty = { "empty", _empty, NULL, _cases[i].batch };
+        result base;
+
+        _measure( &empty, &base, 0 );
+        batches[n]  = _cases[i].batch;
+        overhead[n] = base.p50;
+        n++;
+      }
+
+      _measure( &_cases[i], &_results[i], overhead[b] );
+      vex::task::yield();
+    }
+
+    // there is no delete in the SD card API, leave the scratch file empty
+    FIL *fp = vexFileOpen( TEMP_FILE, "r" );
+    if( fp != NULL ) {
+      vexFileClose( fp );
+      fp = vexFileOpenWrite( TEMP_FILE );
+      if( fp != NULL )
+        vexFileClose( fp );
+    }
+}
+
+int32_t
+benchmark::count() {
+    return( _count );
+}
+
+const benchmark::result *
+benchmark::data( int32_t index ) {
+    if( index < 0 || index >= _count )
+      return( NULL );
+    return( &_results[index] );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Standard cases                                                   */
+/*---------------------------------------------------------------------------*/
+
+static volatile uint32_t  _sink;
+static vex::mutex         _mutex;
+static char               _block[FILE_BLOCK];
+
+static void _systemTime( void *arg )      { _sink = vexSystemTimeGet(); }
+static void _highResTime( void *arg )     { _sink = (uint32_t)vexSystemHighResTimeGet(); }
+static void _deviceByIndex( void *arg )   { _sink = (uint32_t)(uintptr_t)vexDeviceGetByIndex( (uint32_t)(uintptr_t)arg ); }
+static void _deviceStatus( void *arg )    { V5_DeviceTypeBuffer b; _sink = vexDeviceGetStatus( b ); }
+static void _deviceTimestamp( void *arg ) { _sink = vexDeviceGetTimestamp( (V5_DeviceT)arg ); }
+
+// one case for each entry in VEX_BENCHMARK_GETTERS, some return structures
+template <typename R, R (* F)( V5_DeviceT )>
+static void _getter( void *arg ) {
+    R value = F( (V5_DeviceT)arg );
+    _sink = *(const volatile uint8_t *)&value;
+}
+
+static void _motorPositionRaw( void *arg ){ uint32_t t; _sink = vexDeviceMotorPositionRawGet( (V5_DeviceT)arg, &t ); }
+static void _motorVoltageSet( void *arg ) { vexDeviceMotorVoltageSet( (V5_DeviceT)arg, 0 ); }
+static void _motorVelocitySet( void *arg ){ vexDeviceMotorVelocitySet( (V5_DeviceT)arg, 0 ); }
+
+static void _imuQuaternion( void *arg )   { V5_DeviceImuQuaternion q; vexDeviceImuQuaternionGet( (V5_DeviceT)arg, &q ); _sink = (uint32_t)q.a; }
+
+static void _controller( void *arg )      { _sink = vexControllerGet( kControllerMaster, AnaLeftY ); }
+
+static void _displayPixel( void *arg )    { vexDisplayPixelSet( 10, 10 ); }
+static void _displayLine( void *arg )     { vexDisplayLineDraw( 0, 0, 100, 50 ); }
+static void _displayRect( void *arg )     { vexDisplayRectFill( 0, 0, 40, 40 ); }
+static void _displayString( void *arg )   { vexDisplayStringAt( 10, 20, "benchmark" ); }
+
+static void _fileWrite( void *arg ) {
+    FIL *fp = vexFileOpenWrite( benchmark::TEMP_FILE );
+    if( fp != NULL ) {
+      vexFileWrite( _block, 1, FILE_BLOCK, fp );
+      vexFileClose( fp );
+    }
+}
+static void _fileRead( void *arg ) {
+    FIL *fp = vexFileOpen( benchmark::TEMP_FILE, "r" );
+    if( fp != NULL ) {
+      _sink = vexFileRead( _block, 1, FILE_BLOCK, fp );
+      vexFileClose( fp );
+    }
+}
+
+static void _mutexLockUnlock( void *arg ) { _mutex.lock(); _mutex.unlock(); }
+static void _taskYield( void *arg )       { vex::task::yield(); }
+
+int32_t
+benchmark::addDevice( V5_DeviceType type, int32_t index ) {
+    V5_DeviceT device = vexDeviceGetByIndex( index );
+    int32_t    added  = 0;
+
+#define X( kind, R, fn )    if( kind == type && add( #fn, _getter<R, fn>, device ) ) added++;
+    VEX_BENCHMARK_GETTERS( X )
+#undef  X
+    return( added );
+}
+
+void
+benchmark::addStandard( int32_t motorIndex, int32_t imuIndex ) {
+    V5_DeviceT motor = vexDeviceGetByIndex( motorIndex );
+    V5_DeviceT imu   = vexDeviceGetByIndex( imuIndex );
+
+    add( "vexSystemTimeGet",                _systemTime );
+    add( "vexSystemHighResTimeGet",         _highResTime );
+    add( "vexDeviceGetByIndex",             _deviceByIndex, (void *)(uintptr_t)motorIndex );
+    add( "vexDeviceGetStatus",              _deviceStatus );
+    add( "vexDeviceGetTimestamp",           _deviceTimestamp, motor );
+
+    addDevice( kDeviceTypeMotorSensor, motorIndex );
+    add( "vexDeviceMotorPositionRawGet",    _motorPositionRaw, motor );
+    add( "vexDeviceMotorVoltageSet",        _motorVoltageSet, motor );
+    add( "vexDeviceMotorVelocitySet",       _motorVelocitySet, motor );
+
+    addDevice( kDeviceTypeImuSensor, imuIndex );
+    add( "vexDeviceImuQuaternionGet",       _imuQuaternion, imu );
+
+    add( "vexControllerGet",                _controller );
+
+    add( "vexDisplayPixelSet",              _displayPixel );
+    add( "vexDisplayLineDraw",              _displayLine );
+    add( "vexDisplayRectFill",              _displayRect, NULL, 4 );
+    add( "vexDisplayStringAt",              _displayString, NULL, 4 );
+
+    add( "file open write 512 close",       _fileWrite, NULL, 1 );
+    add( "file open read 512 close",        _fileRead, NULL, 1 );
+
+    add( "mutex lock unlock",               _mutexLockUnlock );
+    add( "task yield",                      _taskYield, NULL, 4 );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Reports                                                          */
+/*---------------------------------------------------------------------------*/
+
+void
+benchmark::print() {
+    vex_printf( "%-34s %6s %10s %10s %10s %10s %10s %10s\n", "nS per call", "batch", "min", "p50", "p90", "p99", "max", "mean" );
+    for( int i=0;i<_count;i++ ) {
+      const result *r = &_results[i];
+      vex_printf( "%-34s %6lu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", r->name, (unsigned long)r->batch,
+                  r->min, r->p50, r->p90, r->p99, r->max, r->mean );
+    }
+}
+
+bool
+benchmark::save( const char *name ) {
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    char line[160];
+    int  len;
+
+    len = vex_snprintf( line, sizeof(line), "name,samples,batch,min_ns,p50_ns,p90_ns,p99_ns,max_ns,mean_ns\n" );
+    vexFileWrite( line, 1, len, fp );
+
+    for( int i=0;i<_count;i++ ) {
+      const result *r = &_results[i];
+      len = vex_snprintf( line, sizeof(line), "%s,%lu,%lu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n", r->name,
+                          (unsigned long)r->samples, (unsigned long)r->batch,
+                          r->min, r->p50, r->p90, r->p99, r->max, r->mean );
+
+      // snprintf returns the length it wanted, a long name is cut short
+      if( len < 0 )
+        continue;
+      if( len > (int)sizeof(line) - 1 ) {
+        len = sizeof(line) - 1;
+        line[len - 1] = '\n';
+      }
+      vexFileWrite( line, 1, len, fp );
+    }
+
+    vexFileClose( fp );
+    return( true );
+}
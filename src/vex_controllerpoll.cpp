@@ -0,0 +1,210 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_controllerpoll.cpp                                      */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_controllerpoll.cpp
+  * @brief   Polled controller snapshot with button edges
+*//*---------------------------------------------------------------------------*/
+
+#define DEFAULT_HOLD_TIME         500
+#define DEFAULT_DOUBLE_TAP_TIME   300
+
+using namespace vex;
+
+// Axis1 to Axis4
+static const V5_ControllerIndex axisIndex[ controller_poll::AXES ] = {
+    Axis1, Axis2, Axis3, Axis4
+};
+
+controller_poll::controller_poll( controllerType id ) {
+    _id            = (V5_ControllerId)id;
+    _down          = 0;
+    _holding       = 0;
+    _armed         = 0;
+    _tapped        = 0;
+    memset( _edges,       0, sizeof(_edges) );
+    memset( _pressTime,   0, sizeof(_pressTime) );
+    memset( _releaseTime, 0, sizeof(_releaseTime) );
+    memset( _axes,        0, sizeof(_axes) );
+
+    _holdTime      = DEFAULT_HOLD_TIME;
+    _doubleTapTime = DEFAULT_DOUBLE_TAP_TIME;
+
+    _handlerCount  = 0;
+    memset( _watched, 0, sizeof(_watched) );
+
+    _task          = NULL;
+    _running       = false;
+    _period        = 10;
+}
+
+controller_poll::~controller_poll() {
+    stop();
+}
+
+void
+controller_poll::setHoldTime( uint32_t time ) {
+    _holdTime = time;
+}
+
+void
+controller_poll::setDoubleTapTime( uint32_t time ) {
+    _doubleTapTime = time;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Handlers                                                         */
+/*---------------------------------------------------------------------------*/
+
+bool
+controller_poll::on( uint32_t mask, edgeType edge, void (* callback)( void ) ) {
+    if( callback == NULL || _handlerCount >= MAX_HANDLERS )
+      return( false );
+
+    handler &h = _handlers[_handlerCount];
+    h.mask     = mask & buttonAll;
+    h.edge     = edge;
+    h.callback = callback;
+    _watched[ (int)edge ] |= h.mask;
+    _handlerCount++;
+    return( true );
+}
+
+void
+controller_poll::remove( void (* callback)( void ) ) {
+    int32_t n = 0;
+
+    memset( _watched, 0, sizeof(_watched) );
+    for( int32_t i=0;i<_handlerCount;i++ ) {
+      if( _handlers[i].callback == callback )
+        continue;
+      _handlers[n] = _handlers[i];
+      _watched[ (int)_handlers[n].edge ] |= _handlers[n].mask;
+      n++;
+    }
+    _handlerCount = n;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Update                                                           */
+/*---------------------------------------------------------------------------*/
+
+int32_t
+controller_poll::update() {
+    uint32_t now  = vexSystemTimeGet();
+    uint32_t down = 0;
+
+    for( int32_t i=0;i<BUTTONS;i++ ) {
+      if( vexControllerGet( _id, (V5_ControllerIndex)( ButtonL1 + i ) ) )
+        down |= 1 << i;
+    }
+    for( int32_t i=0;i<AXES;i++ )
+      _axes[i] = vexControllerGet( _id, axisIndex[i] );
+
+    uint32_t pressed  = down & ~_down;
+    uint32_t released = _down & ~down;
+    uint32_t tapped   = 0;
+    uint32_t held     = 0;
+    uint32_t bits;
+
+    bits = pressed;
+    while( bits ) {
+      int32_t b = __builtin_ctz( bits );
+      bits &= bits - 1;
+      _pressTime[b] = now;
+      if( ( _armed & ( 1 << b ) ) && now - _releaseTime[b] <= _doubleTapTime )
+        tapped |= 1 << b;
+    }
+
+    bits = released;
+    while( bits ) {
+      int32_t b = __builtin_ctz( bits );
+      bits &= bits - 1;
+      _releaseTime[b] = now;
+    }
+
+    // a third tap starts over rather than making a second double tap
+    _armed   = ( _armed & ~pressed ) | ( released & ~_tapped );
+    _tapped  = ( _tapped & ~released ) | tapped;
+    _holding &= down;
+
+    bits = down & ~_holding;
+    while( bits ) {
+      int32_t b = __builtin_ctz( bits );
+      bits &= bits - 1;
+      if( now - _pressTime[b] >= _holdTime )
+        held |= 1 << b;
+    }
+    _holding |= held;
+    _down     = down;
+
+    _edges[ (int)edgeType::pressed ]   = pressed;
+    _edges[ (int)edgeType::released ]  = released;
+    _edges[ (int)edgeType::held ]      = held;
+    _edges[ (int)edgeType::doubleTap ] = tapped;
+
+    int32_t found = __builtin_popcount( pressed ) + __builtin_popcount( released ) +
+                    __builtin_popcount( held )    + __builtin_popcount( tapped );
+
+    uint32_t wanted = 0;
+    for( int e=0;e<EDGES;e++ )
+      wanted |= _edges[e] & _watched[e];
+    if( wanted == 0 )
+      return( found );
+
+    for( int32_t i=0;i<_handlerCount;i++ ) {
+      handler &h = _handlers[i];
+      if( _edges[ (int)h.edge ] & h.mask )
+        h.callback();
+    }
+    return( found );
+}
+
+int32_t
+controller_poll::axis( int32_t number ) {
+    if( number < 1 || number > AXES )
+      return( 0 );
+    return( _axes[ number - 1 ] );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Task                                                             */
+/*---------------------------------------------------------------------------*/
+
+int
+controller_poll::_run( void *arg ) {
+    controller_poll *p = (controller_poll *)arg;
+
+    while( p->_running ) {
+      p->update();
+      vex::task::sleep( p->_period );
+    }
+    return( 0 );
+}
+
+void
+controller_poll::start( uint32_t period ) {
+    _period = (period < 1) ? 1 : period;
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this );
+}
+
+void
+controller_poll::stop() {
+    if( _task != NULL ) {
+      _running = false;
+      _task->stop();
+      delete _task;
+      _task = NULL;
+    }
+}
@@ -0,0 +1,194 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_devicediscovery.cpp                                     */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_devicediscovery.cpp
+  * @brief   Hot plug device discovery class
+*//*---------------------------------------------------------------------------*/
+
+#define DEFAULT_DEBOUNCE      2         // ticks
+
+using namespace vex;
+
+device_discovery::device_discovery() {
+    _init();
+}
+
+device_discovery::~device_discovery() {
+    stop();
+}
+
+void
+device_discovery::_init() {
+    for( int i=0;i<PORTS;i++ ) {
+      _types[i]        = kDeviceTypeNoSensor;
+      _pending[i]      = kDeviceTypeNoSensor;
+      _pendingCount[i] = 0;
+      _last[i]         = kDeviceTypeNoSensor;
+    }
+
+    _present       = 0;
+    _pendingMask   = 0;
+    _generation    = 0;
+    _debounce      = DEFAULT_DEBOUNCE;
+    _callbackCount = 0;
+    _bindingCount  = 0;
+    _task          = NULL;
+    _running       = false;
+    _period        = 20;
+}
+
+void
+device_discovery::setDebounce( int32_t ticks ) {
+    _debounce = (ticks < 1) ? 1 : (ticks > 255) ? 255 : ticks;
+}
+
+bool
+device_discovery::changed( void (* callback)( eventType e, int32_t port, V5_DeviceType oldType, V5_DeviceType newType ) ) {
+    if( callback == NULL || _callbackCount >= MAX_CALLBACKS )
+      return( false );
+
+    _callbacks[ _callbackCount++ ] = callback;
+    return( true );
+}
+
+bool
+device_discovery::bind( device &d, V5_DeviceType type, void (* reinit)( device &d ) ) {
+    if( _bindingCount >= MAX_BINDINGS )
+      return( false );
+
+    binding *b = &_bindings[ _bindingCount++ ];
+    b->dev    = &d;
+    b->type   = type;
+    b->reinit = reinit;
+    return( true );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Report one port change                                          */
+/*---------------------------------------------------------------------------*/
+void
+device_discovery::_notify( int32_t port, V5_DeviceType oldType, V5_DeviceType newType ) {
+    eventType e;
+
+    if( newType == kDeviceTypeNoSensor ) {
+      e = eventType::disconnected;
+      _present &= ~( 1u << port );
+    }
+    else {
+      e = (oldType == kDeviceTypeNoSensor) ? eventType::connected : eventType::typeChanged;
+      _present |= 1u << port;
+    }
+    _generation = _generation + 1;
+
+    // rebind before telling anyone so callbacks see a working device
+    for( int i=0;i<_bindingCount;i++ ) {
+      binding *b = &_bindings[i];
+      if( b->dev->index() != port || b->type != newType )
+        continue;
+
+      b->dev->init( port );
+      if( b->reinit != NULL )
+        b->reinit( *b->dev );
+    }
+
+    for( int i=0;i<_callbackCount;i++ )
+      _callbacks[i]( e, port, oldType, newType );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Diff the device status against the last snapshot                */
+/*---------------------------------------------------------------------------*/
+int32_t
+device_discovery::update() {
+    V5_DeviceTypeBuffer status;
+    vexDeviceGetStatus( status );
+
+    // nothing plugged or unplugged and nothing waiting on the debounce
+    if( _pendingMask == 0 && memcmp( status, _last, sizeof(status) ) == 0 )
+      return( 0 );
+    memcpy( _last, status, sizeof(status) );
+
+    int32_t changes = 0;
+
+    for( int i=0;i<PORTS;i++ ) {
+      uint32_t bit = 1u << i;
+
+      if( status[i] == _types[i] ) {
+        _pendingCount[i] = 0;
+        _pendingMask    &= ~bit;
+        continue;
+      }
+
+      if( status[i] != _pending[i] || !( _pendingMask & bit ) ) {
+        _pending[i]      = status[i];
+        _pendingCount[i] = 0;
+      }
+      _pendingCount[i]++;
+      _pendingMask |= bit;
+
+      if( _pendingCount[i] >= _debounce ) {
+        V5_DeviceType old = _types[i];
+        _types[i]        = status[i];
+        _pendingCount[i] = 0;
+        _pendingMask    &= ~bit;
+        _notify( i, old, status[i] );
+        changes++;
+      }
+    }
+
+    return( changes );
+}
+
+int
+device_discovery::_run( void *arg ) {
+    device_discovery *d = (device_discovery *)arg;
+
+    while( d->_running ) {
+      d->update();
+      vex::task::sleep( d->_period );
+    }
+    return( 0 );
+}
+
+void
+device_discovery::start( uint32_t period ) {
+    _period = (period < 5) ? 5 : period;
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this );
+}
+
+void
+device_discovery::stop() {
+    if( _task == NULL )
+      return;
+
+    _running = false;
+    _task->stop();
+    delete _task;
+    _task = NULL;
+}
+
+V5_DeviceType
+device_discovery::type( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( kDeviceTypeNoSensor );
+    return( _types[port] );
+}
+
+bool
+device_discovery::installed( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( false );
+    return( ( _present >> port ) & 1 );
+}
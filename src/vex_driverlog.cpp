@@ -0,0 +1,412 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_driverlog.cpp                                           */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_thunks.h"
+#include "vex_interpose.h"
+#include "vex_driverlog.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_driverlog.cpp
+  * @brief   Recording and playback of driver controller input
+*//*---------------------------------------------------------------------------*/
+
+#define FLUSH_PERIOD      20
+
+//
+// The stream after the header is a sequence of
+//   0x00 - 0x7F   the next 1 to 128 frames are the same as the previous one
+//   0x80 | k      a frame in which k values changed, followed by k entries
+// An entry is one byte, channel << 2 | code, for a change of -2, -1, +1
+// or +2.  Any other change is ESCAPE << 2, the channel and a zigzag varint.
+// The channel is controller * CHANNELS + index, the connection status is
+// the last index.  Every value starts at 0.
+//
+static const int32_t  smallDelta[4] = { -2, -1, 1, 2 };
+
+using namespace vex;
+
+volatile driverlog::modeType driverlog::_mode = driverlog::modeType::idle;
+int32_t               driverlog::_values[ driverlog::VALUES ];
+uint8_t               driverlog::_buffer[2][ driverlog::BUFFER_SIZE ];
+int32_t               driverlog::_current      = 0;
+int32_t               driverlog::_length       = 0;
+int32_t               driverlog::_position     = 0;
+volatile int32_t      driverlog::_pending[2]   = { 0, 0 };
+int32_t               driverlog::_run          = 0;
+uint32_t              driverlog::_frames       = 0;
+uint32_t              driverlog::_dropped      = 0;
+volatile bool         driverlog::_stopping     = false;
+volatile bool         driverlog::_sampling     = false;
+volatile bool         driverlog::_writing      = false;
+void                 *driverlog::_savedGet     = NULL;
+void                 *driverlog::_savedStatus  = NULL;
+vex::task            *driverlog::_task         = NULL;
+vex::task            *driverlog::_writer       = NULL;
+FIL                  *driverlog::_file         = NULL;
+
+void
+driverlog::_reset() {
+    memset( _values, 0, sizeof(_values) );
+    _current    = 0;
+    _length     = 0;
+    _position   = 0;
+    _pending[0] = 0;
+    _pending[1] = 0;
+    _run        = 0;
+    _frames     = 0;
+    _dropped    = 0;
+    _stopping   = false;
+}
+
+// the tasks have returned by now, a playback that ended by itself leaves its task
+void
+driverlog::_release() {
+    if( _task != NULL ) {
+      _task->stop();
+      delete _task;
+      _task = NULL;
+    }
+    if( _writer != NULL ) {
+      _writer->stop();
+      delete _writer;
+      _writer = NULL;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Record                                                           */
+/*---------------------------------------------------------------------------*/
+
+//
+// Hands the current buffer to the write task when it cannot hold bytes
+// more.  This never waits, if the other buffer has not been written yet
+// the SD card has fallen behind and the caller drops what it had.
+//
+bool
+driverlog::_room( int32_t bytes ) {
+    if( _length + bytes <= BUFFER_SIZE )
+      return( true );
+
+    int32_t next = _current ^ 1;
+    if( _pending[next] > 0 )
+      return( false );
+
+    _pending[_current] = _length;
+    _current = next;
+    _length  = 0;
+    return( true );
+}
+
+// one run byte at most per frame, a backlog left by dropped frames drains quickly
+void
+driverlog::_putRun() {
+    if( _run >= MAX_RUN && _room( 1 ) ) {
+      _put( MAX_RUN - 1 );
+      _run -= MAX_RUN;
+    }
+}
+
+void
+driverlog::_encode( int32_t channel, int32_t delta ) {
+    if( delta >= -2 && delta <= 2 ) {
+      _put( (uint8_t)( ( channel << 2 ) | ( ( delta < 0 ) ? delta + 2 : delta + 1 ) ) );
+      return;
+    }
+
+    uint32_t z = ( (uint32_t)delta << 1 ) ^ (uint32_t)( delta >> 31 );
+    _put( ESCAPE << 2 );
+    _put( (uint8_t)channel );
+    while( z >= 0x80 ) {
+      _put( (uint8_t)( z | 0x80 ) );
+      z >>= 7;
+    }
+    _put( (uint8_t)z );
+}
+
+void
+driverlog::_record() {
+    int32_t now[VALUES];
+    int32_t changed = 0;
+
+    for( int32_t c=0;c<CONTROLLERS;c++ ) {
+      V5_ControllerId id = (V5_ControllerId)c;
+      int32_t *v = &now[ c * CHANNELS ];
+      for( int32_t i=0;i<CHANNELS-1;i++ )
+        v[i] = vexControllerGet( id, (V5_ControllerIndex)i );
+      v[CHANNELS-1] = (int32_t)vexControllerConnectionStatusGet( id );
+    }
+    for( int32_t i=0;i<VALUES;i++ ) {
+      if( now[i] != _values[i] )
+        changed++;
+    }
+    _frames++;
+
+    // a frame the card has no room for is kept as a repeat of the previous one
+    if( changed > 0 && _run < MAX_RUN && _room( 1 + MAX_FRAME ) ) {
+      if( _run > 0 )
+        _put( (uint8_t)( _run - 1 ) );
+      _run = 0;
+
+      _put( (uint8_t)( 0x80 | changed ) );
+      for( int32_t i=0;i<VALUES;i++ ) {
+        if( now[i] != _values[i] ) {
+          _encode( i, (int32_t)( (uint32_t)now[i] - (uint32_t)_values[i] ) );
+          _values[i] = now[i];
+        }
+      }
+      return;
+    }
+
+    if( changed > 0 )
+      _dropped++;
+    _run++;
+    _putRun();
+}
+
+void
+driverlog::_flush( int32_t index ) {
+    vexFileWrite( (char *)_buffer[index], 1, _pending[index], _file );
+    vexFileSync( _file );
+    _pending[index] = 0;
+}
+
+//
+// Frames are taken on a fixed 10mS grid, a late wake up takes the missed
+// frames at once so the recording keeps the driver's timing.
+//
+int
+driverlog::_sampleTask( void *arg ) {
+    uint32_t next = vexSystemTimeGet();
+
+    while( !_stopping ) {
+      _record();
+      next += PERIOD;
+      int32_t wait = (int32_t)( next - vexSystemTimeGet() );
+      if( wait > 0 )
+        vex::task::sleep( wait );
+    }
+
+    // the current buffer goes last, after the one the writer may still have
+    while( _pending[_current ^ 1] > 0 )
+      vex::task::sleep( 1 );
+    while( _run > 0 && _length < BUFFER_SIZE ) {
+      int32_t n = ( _run > MAX_RUN ) ? MAX_RUN : _run;
+      _put( (uint8_t)( n - 1 ) );
+      _run -= n;
+    }
+    _pending[_current] = _length;
+    _sampling = false;
+    return( 0 );
+}
+
+int
+driverlog::_writeTask( void *arg ) {
+    while( _sampling || _pending[0] > 0 || _pending[1] > 0 ) {
+      for( int b=0;b<2;b++ ) {
+        if( _pending[b] > 0 )
+          _flush( b );
+      }
+      vex::task::sleep( FLUSH_PERIOD );
+    }
+    _writing = false;
+    return( 0 );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Play                                                             */
+/*---------------------------------------------------------------------------*/
+
+bool
+driverlog::_refill() {
+    int32_t n = ( _file != NULL ) ? vexFileRead( (char *)_buffer[0], 1, BUFFER_SIZE, _file ) : 0;
+
+    _position = 0;
+    _length   = ( n > 0 ) ? n : 0;
+    return( _length > 0 );
+}
+
+int32_t
+driverlog::_next() {
+    if( _position >= _length && !_refill() )
+      return( -1 );
+    return( _buffer[0][_position++] );
+}
+
+// false at the end of the recording or on a damaged stream
+bool
+driverlog::_play() {
+    if( _run > 0 ) {
+      _run--;
+      return( true );
+    }
+
+    int32_t h = _next();
+    if( h < 0 )
+      return( false );
+    if( h < 0x80 ) {
+      _run = h;
+      return( true );
+    }
+
+    for( int32_t k = h & 0x7F;k > 0;k-- ) {
+      int32_t b = _next();
+      if( b < 0 )
+        return( false );
+
+      int32_t  channel = b >> 2;
+      uint32_t delta   = (uint32_t)smallDelta[ b & 3 ];
+      if( channel == ESCAPE ) {
+        channel = _next();
+        uint32_t z = 0;
+        int32_t  c;
+        for( int32_t shift=0;;shift+=7 ) {
+          if( ( c = _next() ) < 0 || shift > 28 )
+            return( false );
+          z |= (uint32_t)( c & 0x7F ) << shift;
+          if( ( c & 0x80 ) == 0 )
+            break;
+        }
+        delta = ( z >> 1 ) ^ ( 0 - ( z & 1 ) );
+      }
+      if( channel < 0 || channel >= VALUES )
+        return( false );
+      _values[channel] = (int32_t)( (uint32_t)_values[channel] + delta );
+    }
+    return( true );
+}
+
+int
+driverlog::_playTask( void *arg ) {
+    uint32_t next = vexSystemTimeGet();
+
+    while( !_stopping && _play() ) {
+      _frames++;
+      next += PERIOD;
+      int32_t wait = (int32_t)( next - vexSystemTimeGet() );
+      if( wait > 0 )
+        vex::task::sleep( wait );
+    }
+
+    interpose::exchange( offsets::vexControllerGet, _savedGet );
+    interpose::exchange( offsets::vexControllerConnectionStatusGet, _savedStatus );
+    vexFileClose( _file );
+    _file = NULL;
+    _mode = modeType::idle;
+    return( 0 );
+}
+
+int32_t
+driverlog::_playGet( V5_ControllerId id, V5_ControllerIndex index ) {
+    if( (uint32_t)id >= (uint32_t)CONTROLLERS || (uint32_t)index >= (uint32_t)( CHANNELS - 1 ) )
+      return( 0 );
+    return( _values[ id * CHANNELS + index ] );
+}
+
+V5_ControllerStatus
+driverlog::_playStatus( V5_ControllerId id ) {
+    if( (uint32_t)id >= (uint32_t)CONTROLLERS )
+      return( kV5ControllerOffline );
+    return( (V5_ControllerStatus)_values[ id * CHANNELS + CHANNELS - 1 ] );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Control                                                          */
+/*---------------------------------------------------------------------------*/
+
+bool
+driverlog::record( const char *name ) {
+    if( _mode != modeType::idle )
+      return( false );
+    _release();
+
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    h.magic   = MAGIC;
+    h.version = VERSION;
+    h.values  = VALUES;
+    h.period  = PERIOD;
+    h.time    = vexSystemTimeGet();
+    vexFileWrite( (char *)&h, sizeof(header), 1, fp );
+
+    _reset();
+    _file     = fp;
+    _sampling = true;
+    _writing  = true;
+    _mode     = modeType::recording;
+    _task     = new vex::task( _sampleTask, NULL, vex::task::taskPriorityHigh );
+    _writer   = new vex::task( _writeTask, NULL, vex::task::taskPrioritylow );
+    return( true );
+}
+
+bool
+driverlog::play( const char *name ) {
+    if( _mode != modeType::idle )
+      return( false );
+    _release();
+
+    FIL *fp = vexFileOpen( name, "r" );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    if( vexFileRead( (char *)&h, sizeof(header), 1, fp ) != 1 ||
+        h.magic != MAGIC || h.version != VERSION || h.values != (uint32_t)VALUES || h.period != PERIOD ) {
+      vexFileClose( fp );
+      return( false );
+    }
+
+    _reset();
+    _file        = fp;
+    _savedGet    = interpose::exchange( offsets::vexControllerGet, (void *)&_playGet );
+    _savedStatus = interpose::exchange( offsets::vexControllerConnectionStatusGet, (void *)&_playStatus );
+    _mode        = modeType::playing;
+    _task        = new vex::task( _playTask, NULL, vex::task::taskPriorityHigh );
+    return( true );
+}
+
+void
+driverlog::stop() {
+    if( _mode == modeType::idle ) {
+      _release();
+      return;
+    }
+
+    _stopping = true;
+    if( _mode == modeType::recording ) {
+      while( _sampling || _writing )
+        vex::task::sleep( 1 );
+      vexFileClose( _file );
+      _file = NULL;
+      _mode = modeType::idle;
+    }
+    else {
+      // the play task puts the slots back and closes the file
+      while( _mode != modeType::idle )
+        vex::task::sleep( 1 );
+    }
+    _release();
+}
+
+driverlog::modeType
+driverlog::mode() {
+    return( _mode );
+}
+
+uint32_t
+driverlog::frames() {
+    return( _frames );
+}
+
+uint32_t
+driverlog::dropped() {
+    return( _dropped );
+}
@@ -0,0 +1,398 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_estimator.cpp                                           */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_estimator.cpp
+  * @brief   Low latency velocity and acceleration estimator class
+*//*---------------------------------------------------------------------------*/
+
+#define DEFAULT_WINDOW        8         // samples
+#define DEFAULT_JERK          50000.0   // deg/s^3
+#define MAX_SAMPLE_GAP        250       // mS, longer gaps restart the filter
+#define ROTATION_DATA_RATE    5         // mS
+#define ROTATION_SCALE        0.01      // rotation sensor reports centidegrees
+
+using namespace vex;
+
+velocity_estimator::velocity_estimator() {
+    _init();
+}
+
+velocity_estimator::~velocity_estimator() {
+    stop();
+}
+
+void
+velocity_estimator::_init() {
+    _count   = 0;
+    _filter  = filterType::savitzkyGolay;
+    _window  = DEFAULT_WINDOW;
+    _jerk    = DEFAULT_JERK;
+    _noise   = 0;
+    _task    = NULL;
+    _running = false;
+    memset( _channels, 0, sizeof(_channels) );
+}
+
+velocity_estimator::channel *
+velocity_estimator::_find( int32_t port ) {
+    for( int i=0;i<_count;i++ ) {
+      if( _channels[i].port == port )
+        return( &_channels[i] );
+    }
+    return( NULL );
+}
+
+bool
+velocity_estimator::_add( int32_t port, bool isMotor ) {
+    if( _count >= MAX_CHANNELS || _find( port ) != NULL )
+      return( false );
+
+    channel *c = &_channels[ _count ];
+    memset( c, 0, sizeof(channel) );
+    c->device  = vexDeviceGetByIndex( port );
+    c->port    = port;
+    c->isMotor = isMotor;
+    c->scale   = ROTATION_SCALE;
+
+    if( !isMotor )
+      vexDeviceAbsEncDataRateSet( c->device, ROTATION_DATA_RATE );
+
+    _count++;
+    return( true );
+}
+
+bool
+velocity_estimator::add( vex::motor &m ) {
+    return( _add( m.index(), true ) );
+}
+
+bool
+velocity_estimator::add( vex::rotation &r ) {
+    return( _add( r.index(), false ) );
+}
+
+void
+velocity_estimator::setFilter( filterType filter ) {
+    _filter = filter;
+    for( int i=0;i<_count;i++ )
+      _channels[i].primed = false;
+}
+
+void
+velocity_estimator::setWindow( int32_t samples ) {
+    _window = (samples < 3) ? 3 : (samples > MAX_WINDOW) ? MAX_WINDOW : samples;
+}
+
+void
+velocity_estimator::setNoise( double jerk, double measurement ) {
+    _jerk  = fabs( jerk );
+    _noise = fabs( measurement );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Update task                                                      */
+/*---------------------------------------------------------------------------*/
+
+int
+velocity_estimator::_run( void *arg ) {
+    velocity_estimator *e = (velocity_estimator *)arg;
+
+    while( e->_running ) {
+      e->update();
+      // motors report every 10mS, polling at 1mS keeps the added latency small
+      vex::task::sleep( 1 );
+    }
+    return( 0 );
+}
+
+void
+velocity_estimator::start( int32_t priority ) {
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this, priority );
+}
+
+void
+velocity_estimator::stop() {
+    if( _task == NULL )
+      return;
+
+    _running = false;
+    _task->stop();
+    delete _task;
+    _task = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Filters                                                          */
+/*---------------------------------------------------------------------------*/
+
+void
+velocity_estimator::_reset( channel *c, uint32_t time, double position ) {
+    c->head      = 0;
+    c->length    = 1;
+    c->time[0]     = time;
+    c->position[0] = position;
+
+    double r = (_noise > 0) ? _noise * _noise : c->scale * c->scale / 12.0;
+
+    memset( c->P, 0, sizeof(c->P) );
+    c->x[0]    = position;
+    c->x[1]    = 0;
+    c->x[2]    = 0;
+    c->P[0][0] = r;
+    c->P[1][1] = 1e6;     // (1000 deg/s)^2, we know nothing about velocity yet
+    c->P[2][2] = 1e10;
+
+    c->outPosition     = (float)position;
+    c->outVelocity     = 0;
+    c->outAcceleration = 0;
+    c->outTimestamp    = time;
+    c->primed          = true;
+}
+
+//
+// Least squares quadratic p(t) = a + b*t + c*t^2 over the last _window samples
+// with t measured back from the newest sample.  Motor timestamps are not
+// evenly spaced so the usual Savitzky-Golay convolution weights do not apply,
+// the 3x3 normal equations are solved directly instead.  Evaluating at t = 0
+// rather than the window centre gives up some noise rejection for zero delay.
+//
+void
+velocity_estimator::_fit( channel *c ) {
+    int32_t n = (c->length < _window) ? c->length : _window;
+    if( n < 2 )
+      return;
+
+    uint32_t t0 = c->time[ c->head ];
+    double   y0 = c->position[ c->head ];
+    double   s[5] = { 0 };
+    double   sy = 0, sty = 0, stty = 0;
+
+    for( int i=0;i<n;i++ ) {
+      int32_t k = ( c->head - i + MAX_WINDOW ) % MAX_WINDOW;
+      double  t = -(double)(uint32_t)( t0 - c->time[k] ) / 1000.0;
+      double  y = c->position[k] - y0;
+      double  tt = t * t;
+
+      s[0] += 1;
+      s[1] += t;
+      s[2] += tt;
+      s[3] += tt * t;
+      s[4] += tt * tt;
+      sy   += y;
+      sty  += t * y;
+      stty += tt * y;
+    }
+
+    double a = 0, b = 0, q = 0;
+
+    double det = s[0] * ( s[2] * s[4] - s[3] * s[3] )
+               - s[1] * ( s[1] * s[4] - s[3] * s[2] )
+               + s[2] * ( s[1] * s[3] - s[2] * s[2] );
+
+    if( n >= 3 && fabs( det ) > 1e-9 * s[0] * s[2] * s[4] ) {
+      // Cramer's rule
+      a = ( sy   * ( s[2] * s[4] - s[3] * s[3] )
+          - s[1] * ( sty  * s[4] - s[3] * stty )
+          + s[2] * ( sty  * s[3] - s[2] * stty ) ) / det;
+      b = ( s[0] * ( sty  * s[4] - stty * s[3] )
+          - sy   * ( s[1] * s[4] - s[3] * s[2] )
+          + s[2] * ( s[1] * stty - sty  * s[2] ) ) / det;
+      q = ( s[0] * ( s[2] * stty - s[3] * sty  )
+          - s[1] * ( s[1] * stty - s[3] * sy   )
+          + s[2] * ( s[1] * sty  - s[2] * sy   ) ) / det;
+    }
+    else {
+      // not enough distinct samples yet, straight line
+      double d = s[0] * s[2] - s[1] * s[1];
+      if( d <= 0 )
+        return;
+      b = ( s[0] * sty - s[1] * sy ) / d;
+      a = ( sy - b * s[1] ) / s[0];
+    }
+
+    c->outPosition     = (float)( y0 + a );
+    c->outVelocity     = (float)b;
+    c->outAcceleration = (float)( 2.0 * q );
+}
+
+//
+// Constant acceleration model, state x = [ position velocity acceleration ]
+// driven by white jerk.  Only position is measured.
+//
+void
+velocity_estimator::_kalman( channel *c, double dt, double position ) {
+    double  F[3][3] = { { 1, dt, dt * dt / 2 }, { 0, 1, dt }, { 0, 0, 1 } };
+    double  dt2 = dt * dt, dt3 = dt2 * dt;
+    double  q = _jerk * _jerk;
+    double  Q[3][3] = {
+      { q * dt3 * dt2 / 20, q * dt3 * dt / 8, q * dt3 / 6 },
+      { q * dt3 * dt / 8,   q * dt3 / 3,      q * dt2 / 2 },
+      { q * dt3 / 6,        q * dt2 / 2,      q * dt      }
+    };
+    double  r = (_noise > 0) ? _noise * _noise : c->scale * c->scale / 12.0;
+
+    // predict, x = F x, P = F P F' + Q
+    double  x[3], FP[3][3], P[3][3];
+    for( int i=0;i<3;i++ ) {
+      x[i] = 0;
+      for( int k=0;k<3;k++ )
+        x[i] += F[i][k] * c->x[k];
+    }
+    for( int i=0;i<3;i++ )
+      for( int j=0;j<3;j++ ) {
+        FP[i][j] = 0;
+        for( int k=0;k<3;k++ )
+          FP[i][j] += F[i][k] * c->P[k][j];
+      }
+    for( int i=0;i<3;i++ )
+      for( int j=0;j<3;j++ ) {
+        P[i][j] = Q[i][j];
+        for( int k=0;k<3;k++ )
+          P[i][j] += FP[i][k] * F[j][k];
+      }
+
+    // update with H = [ 1 0 0 ]
+    double  s = P[0][0] + r;
+    double  K[3] = { P[0][0] / s, P[1][0] / s, P[2][0] / s };
+    double  y = position - x[0];
+
+    for( int i=0;i<3;i++ )
+      c->x[i] = x[i] + K[i] * y;
+    for( int i=0;i<3;i++ )
+      for( int j=0;j<3;j++ )
+        c->P[i][j] = P[i][j] - K[i] * P[0][j];
+
+    c->outPosition     = (float)c->x[0];
+    c->outVelocity     = (float)c->x[1];
+    c->outAcceleration = (float)c->x[2];
+}
+
+int32_t
+velocity_estimator::update() {
+    int32_t updated = 0;
+
+    for( int i=0;i<_count;i++ ) {
+      channel *c = &_channels[i];
+      uint32_t timestamp;
+      double   position;
+
+      if( c->isMotor ) {
+        int32_t raw = vexDeviceMotorPositionRawGet( c->device, &timestamp );
+        if( c->primed && timestamp == c->lastTimestamp )
+          continue;
+
+        // raw counts are 1800 per output rev on the 36:1 cartridge
+        V5MotorGearset gearset = vexDeviceMotorGearingGet( c->device );
+        double counts = (gearset == kMotorGearSet_36) ? V5_MOTOR_COUNTS_PER_ROT :
+                        (gearset == kMotorGearSet_18) ? V5_MOTOR_COUNTS_PER_ROT / 2 :
+                                                        V5_MOTOR_COUNTS_PER_ROT / 6;
+        double scale = 360.0 / counts;
+        if( scale != c->scale ) {
+          c->scale  = scale;
+          c->primed = false;
+        }
+        position = raw * scale;
+      }
+      else {
+        timestamp = (uint32_t)vexDeviceGetTimestamp( c->device );
+        if( c->primed && timestamp == c->lastTimestamp )
+          continue;
+        position = vexDeviceAbsEncPositionGet( c->device ) * c->scale;
+      }
+
+      uint32_t gap = timestamp - c->lastTimestamp;
+      c->lastTimestamp = timestamp;
+      updated++;
+
+      if( !c->primed || gap > MAX_SAMPLE_GAP ) {
+        _reset( c, timestamp, position );
+        continue;
+      }
+
+      c->head = ( c->head + 1 ) % MAX_WINDOW;
+      c->time[ c->head ]     = timestamp;
+      c->position[ c->head ] = position;
+      if( c->length < MAX_WINDOW )
+        c->length++;
+
+      if( _filter == filterType::kalman )
+        _kalman( c, gap / 1000.0, position );
+      else
+        _fit( c );
+
+      c->outTimestamp = timestamp;
+    }
+
+    return( updated );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Accessors                                                        */
+/*---------------------------------------------------------------------------*/
+
+double
+velocity_estimator::_toRpm( channel *c, double dps, velocityUnits units ) {
+    if( units == velocityUnits::dps )
+      return( dps );
+
+    double rpm = dps / 6.0;
+    if( units == velocityUnits::pct ) {
+      if( !c->isMotor )
+        return( 0 );
+      V5MotorGearset gearset = vexDeviceMotorGearingGet( c->device );
+      double free = (gearset == kMotorGearSet_36) ? 100 : (gearset == kMotorGearSet_18) ? 200 : 600;
+      return( rpm * 100.0 / free );
+    }
+    return( rpm );
+}
+
+double
+velocity_estimator::velocity( int32_t port, velocityUnits units ) {
+    channel *c = _find( port );
+    if( c == NULL )
+      return( 0 );
+    return( _toRpm( c, c->outVelocity, units ) );
+}
+
+double
+velocity_estimator::acceleration( int32_t port, velocityUnits units ) {
+    channel *c = _find( port );
+    if( c == NULL )
+      return( 0 );
+    return( _toRpm( c, c->outAcceleration, units ) );
+}
+
+double
+velocity_estimator::position( int32_t port, rotationUnits units ) {
+    channel *c = _find( port );
+    if( c == NULL )
+      return( 0 );
+
+    double deg = c->outPosition;
+    if( units == rotationUnits::rev )
+      return( deg / 360.0 );
+    if( units == rotationUnits::raw )
+      return( deg / c->scale );
+    return( deg );
+}
+
+uint32_t
+velocity_estimator::timestamp( int32_t port ) {
+    channel *c = _find( port );
+    if( c == NULL )
+      return( 0 );
+    return( c->outTimestamp );
+}
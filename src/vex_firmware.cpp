@@ -0,0 +1,100 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_firmware.cpp                                            */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_thunks.h"
+#include "vex_firmware.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_firmware.cpp
+  * @brief   Version aware dispatch of private firmware functions
+*//*---------------------------------------------------------------------------*/
+
+// the beta byte does not move the jumptable
+#define VERSION_MASK      0xFFFFFF00
+
+using namespace vex;
+
+#define ENTRY( fn, off )    { (uint16_t)firmware::function::fn, off },
+
+static const firmware::offset _v1_1_2_0[] = {
+    VEX_FIRMWARE_V1_1_2_0( ENTRY )
+};
+
+#undef  ENTRY
+
+// every known build, add new versions here
+static const firmware::build _database[] = {
+    { 0x01010200, _v1_1_2_0, sizeof(_v1_1_2_0) / sizeof(firmware::offset) },
+};
+
+static const int32_t  _builds = sizeof(_database) / sizeof(firmware::build);
+
+void                 *firmware::_functions[ firmware::COUNT ];
+uint32_t              firmware::_version = 0;
+const firmware::build *firmware::_build  = NULL;
+
+// resolved before any user global, after the startup trace begins
+namespace {
+  class firmware_select {
+    public:
+      firmware_select() { firmware::select(); };
+  };
+  firmware_select       _select __attribute__ ((init_priority (102)));
+};
+
+bool
+firmware::select( uint32_t version ) {
+    if( version == 0 )
+      version = vexSystemVersion();
+
+    _version = version;
+    _build   = NULL;
+    memset( _functions, 0, sizeof(_functions) );
+
+    for( int i=0;i<_builds && _build == NULL;i++ ) {
+      if( _database[i].version == version )
+        _build = &_database[i];
+    }
+    for( int i=0;i<_builds && _build == NULL;i++ ) {
+      if( ( _database[i].version & VERSION_MASK ) == ( version & VERSION_MASK ) )
+        _build = &_database[i];
+    }
+    if( _build == NULL )
+      return( false );
+
+    for( uint32_t i=0;i<_build->count;i++ ) {
+      const offset *o = &_build->offsets[i];
+      if( o->function >= COUNT || o->offset >= TABLE_SIZE )
+        continue;
+      _functions[ o->function ] = *(void * volatile *)( offsets::TABLE_BASE + o->offset );
+    }
+    return( true );
+}
+
+bool
+firmware::supported() {
+    return( _build != NULL );
+}
+
+uint32_t
+firmware::version() {
+    return( _version );
+}
+
+bool
+firmware::available( function f ) {
+    int32_t i = (int32_t)f;
+    return( i >= 0 && i < COUNT && _functions[i] != NULL );
+}
+
+const firmware::build *
+firmware::builds( int32_t &count ) {
+    count = _builds;
+    return( _database );
+}
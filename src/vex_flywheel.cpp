@@ -0,0 +1,422 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_flywheel.cpp                                            */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_flywheel.cpp
+  * @brief   Flywheel velocity controller class
+*//*---------------------------------------------------------------------------*/
+
+#define MAX_MOTOR_VOLTAGE     12.0      // V
+#define DEFAULT_TOLERANCE     20.0      // motor rpm
+#define DEFAULT_TBH_GAIN      0.0005    // V per rpm per sample
+#define DEFAULT_SHOT_CURRENT  1.5       // A above the running average
+#define CURRENT_AVERAGE_GAIN  0.05      // running average of current at speed
+#define SHOT_MIN_TIME         20        // mS, shortest recovery that is believed
+#define SHOT_TIMEOUT          2000      // mS, give up on a recovery
+
+//
+// The current spike comes first and the velocity dip follows once the
+// ball has taken energy out of the wheel, a few samples of the 10mS motor
+// data later.  A recovery therefore only ends after the velocity has left
+// the tolerance band and come back into it.  SHOT_MIN_TIME is two motor
+// samples, a dip and return inside it is taken as estimator noise.  A shot
+// that never pulls the velocity out of the band ends at SHOT_TIMEOUT.
+//
+
+using namespace vex;
+
+flywheel::flywheel() {
+    _init();
+}
+
+flywheel::~flywheel() {
+    stop();
+}
+
+void
+flywheel::_init() {
+    _count          = 0;
+    _mode           = modeType::takeBackHalf;
+    _ratio          = 1.0;
+    _target         = 0;
+    _tolerance      = DEFAULT_TOLERANCE;
+    _maxVoltage     = MAX_MOTOR_VOLTAGE;
+    _holdVoltage    = 0;
+    _gain           = DEFAULT_TBH_GAIN;
+    _kS = _kV = _kA = 0;
+    _kP = _kI = _kD = 0;
+
+    _output         = 0;
+    _tbh            = 0;
+    _integral       = 0;
+    _lastError      = 0;
+    _velocity       = 0;
+    _currentAverage = 0;
+    _ready          = false;
+
+    _shotCount      = 0;
+    _recovering     = false;
+    _shotThreshold  = DEFAULT_SHOT_CURRENT;
+
+    _task           = NULL;
+    _running        = false;
+}
+
+void
+flywheel::_addMotor() {
+}
+
+void
+flywheel::_addMotor( vex::motor &m ) {
+    if( _count >= MAX_MOTORS )
+      return;
+
+    _estimator.add( m );
+    _ports[ _count ]   = m.index();
+    _devices[ _count ] = vexDeviceGetByIndex( m.index() );
+    _count++;
+}
+
+void
+flywheel::setMode( modeType mode ) {
+    _mode      = mode;
+    _integral  = 0;
+    _lastError = 0;
+    _tbh       = _kS + _kV * fabs( _target );
+}
+
+void
+flywheel::setRatio( double ratio ) {
+    if( ratio > 0 )
+      _ratio = ratio;
+}
+
+void
+flywheel::setTolerance( double value, velocityUnits units ) {
+    double rpm = (units == velocityUnits::dps) ? value / 6.0 : value;
+    _tolerance = fabs( rpm / _ratio );
+}
+
+void
+flywheel::setMaxVoltage( double value, voltageUnits units ) {
+    double v = fabs( (units == voltageUnits::mV) ? value / 1000.0 : value );
+    _maxVoltage = (v > MAX_MOTOR_VOLTAGE) ? MAX_MOTOR_VOLTAGE : v;
+}
+
+void
+flywheel::setHoldVoltage( double value, voltageUnits units ) {
+    _holdVoltage = fabs( (units == voltageUnits::mV) ? value / 1000.0 : value );
+}
+
+void
+flywheel::setTakeBackHalfGain( double gain ) {
+    _gain = fabs( gain );
+}
+
+void
+flywheel::setFeedforward( double kS, double kV, double kA ) {
+    _kS = kS;
+    _kV = kV;
+    _kA = kA;
+}
+
+void
+flywheel::setFeedforward( const sysid::result &r ) {
+    if( r.samples > 0 )
+      setFeedforward( r.kS, r.kV, r.kA );
+}
+
+void
+flywheel::setPid( double kP, double kI, double kD ) {
+    _kP = kP;
+    _kI = kI;
+    _kD = kD;
+}
+
+void
+flywheel::setShotThreshold( double value, currentUnits units ) {
+    _shotThreshold = fabs( value );
+}
+
+void
+flywheel::_setVoltage( double volts ) {
+    int32_t mv = (int32_t)( volts * 1000.0 );
+    for( int i=0;i<_count;i++ )
+      vexDeviceMotorVoltageSet( _devices[i], mv );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Shot detection and recovery timing                             */
+/*---------------------------------------------------------------------------*/
+//
+// Loading a ball into the flywheel shows up in the motor current well before
+// the velocity estimate moves, so the spike is used to timestamp the shot.
+// The running average only follows the current while idle at speed so the
+// spin-up and the shot itself do not drag it upwards.
+//
+void
+flywheel::_detectShot( uint32_t timestamp ) {
+    double current = 0;
+    for( int i=0;i<_count;i++ )
+      current += vexDeviceMotorCurrentGet( _devices[i] ) / 1000.0;
+
+    double error = fabs( _target ) - fabs( _velocity );
+
+    if( !_recovering ) {
+      if( _ready && current - _currentAverage > _shotThreshold ) {
+        shot *s = &_shots[ _shotCount % MAX_SHOTS ];
+        s->time        = timestamp;
+        s->recovery    = 0;
+        s->drop        = 0;
+        s->peakCurrent = (float)current;
+        _recovering = true;
+        _shotCount  = _shotCount + 1;
+      }
+      else
+      if( _ready )
+        _currentAverage += CURRENT_AVERAGE_GAIN * ( current - _currentAverage );
+      else
+        _currentAverage = current;
+      return;
+    }
+
+    if( _shotCount <= 0 ) {
+      _recovering = false;
+      return;
+    }
+
+    shot    *s       = &_shots[ (_shotCount - 1) % MAX_SHOTS ];
+    uint32_t elapsed = timestamp - s->time;
+
+    if( current > s->peakCurrent )
+      s->peakCurrent = (float)current;
+    if( error * _ratio > s->drop )
+      s->drop = (float)( error * _ratio );
+
+    // while the speed has stayed inside the band the dip has not arrived yet
+    bool left = s->drop > _tolerance * _ratio;
+
+    if( ( left && elapsed > SHOT_MIN_TIME && fabs( error ) <= _tolerance ) || elapsed > SHOT_TIMEOUT ) {
+      s->recovery = (elapsed > 0) ? elapsed : 1;
+      _recovering = false;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  One controller update, run for every new motor sample          */
+/*---------------------------------------------------------------------------*/
+//
+// All modes work on speed magnitude so a reversed flywheel behaves the same.
+//
+void
+flywheel::_step( uint32_t timestamp, double dt ) {
+    double v = 0;
+    for( int i=0;i<_count;i++ )
+      v += _estimator.velocity( _ports[i], velocityUnits::rpm );
+    _velocity = v / _count;
+
+    double sign   = (_target < 0) ? -1.0 : 1.0;
+    double target = fabs( _target );
+    double error  = target - _velocity * sign;
+    double out, ff, d, trial;
+
+    switch( _mode ) {
+      case modeType::bangBang:
+        out = (error > 0) ? _maxVoltage : _holdVoltage;
+        break;
+
+      case modeType::takeBackHalf:
+        // integrate, and on every zero crossing of the error jump half way
+        // back to the output at the previous crossing
+        _output += _gain * error;
+        if( _output > _maxVoltage ) _output = _maxVoltage;
+        if( _output < 0 )           _output = 0;
+        if( ( error > 0 ) != ( _lastError > 0 ) ) {
+          _output = 0.5 * ( _output + _tbh );
+          _tbh    = _output;
+        }
+        out = _output;
+        break;
+
+      default:
+        ff = (target > 0) ? _kS + _kV * target : 0;
+        d  = (dt > 0) ? ( error - _lastError ) / dt : 0;
+
+        // conditional integration, do not wind up while saturated
+        trial = ff + _kP * error + _kI * ( _integral + error * dt ) + _kD * d;
+        if( fabs( trial ) < _maxVoltage )
+          _integral += error * dt;
+
+        out = ff + _kP * error + _kI * _integral + _kD * d;
+        break;
+    }
+
+    if( out >  _maxVoltage ) out =  _maxVoltage;
+    if( out < -_maxVoltage ) out = -_maxVoltage;
+    if( target == 0 )        out = 0;
+
+    _lastError = error;
+
+    _detectShot( timestamp );
+    _ready = ( fabs( error ) <= _tolerance ) && !_recovering && target > 0;
+
+    _output = out;
+    _setVoltage( out * sign );
+}
+
+int
+flywheel::_run( void *arg ) {
+    flywheel *f    = (flywheel *)arg;
+    uint32_t  last = 0;
+
+    while( f->_running ) {
+      f->_estimator.update();
+
+      // one controller update per sample of the first motor
+      uint32_t timestamp = f->_estimator.timestamp( f->_ports[0] );
+      if( timestamp != last ) {
+        double dt = (last != 0) ? (uint32_t)( timestamp - last ) / 1000.0 : 0;
+        last = timestamp;
+        f->_step( timestamp, dt );
+      }
+
+      vex::task::sleep( 1 );
+    }
+    return( 0 );
+}
+
+void
+flywheel::spin( double velocity, velocityUnits units ) {
+    if( _count == 0 )
+      return;
+
+    double rpm = velocity;
+    if( units == velocityUnits::dps )
+      rpm = velocity / 6.0;
+    else
+    if( units == velocityUnits::pct ) {
+      V5MotorGearset gearset = vexDeviceMotorGearingGet( _devices[0] );
+      double free = (gearset == kMotorGearSet_36) ? 100 : (gearset == kMotorGearSet_18) ? 200 : 600;
+      rpm = velocity * free * _ratio / 100.0;
+    }
+
+    double target = rpm / _ratio;
+    if( target != _target ) {
+      // take-back-half starts at full output, seeded with the feedforward
+      // estimate so the first crossing lands close to the hold voltage
+      _target     = target;
+      _output     = _maxVoltage;
+      _tbh        = _kS + _kV * fabs( target );
+      _integral   = 0;
+      _lastError  = fabs( target );
+      _ready      = false;
+      _recovering = false;
+    }
+
+    if( _task == NULL ) {
+      _running = true;
+      _task = new vex::task( _run, (void *)this, vex::task::taskPriorityHigh );
+    }
+}
+
+void
+flywheel::stop( brakeType mode ) {
+    if( _task != NULL ) {
+      _running = false;
+      _task->stop();
+      delete _task;
+      _task = NULL;
+    }
+
+    _target     = 0;
+    _output     = 0;
+    _ready      = false;
+    _recovering = false;
+
+    for( int i=0;i<_count;i++ ) {
+      vexDeviceMotorBrakeModeSet( _devices[i], (V5MotorBrakeMode)mode );
+      vexDeviceMotorVelocitySet( _devices[i], 0 );
+    }
+}
+
+double
+flywheel::velocity( velocityUnits units ) {
+    double rpm = _velocity * _ratio;
+
+    if( units == velocityUnits::dps )
+      return( rpm * 6.0 );
+    if( units == velocityUnits::pct && _count > 0 ) {
+      V5MotorGearset gearset = vexDeviceMotorGearingGet( _devices[0] );
+      double free = (gearset == kMotorGearSet_36) ? 100 : (gearset == kMotorGearSet_18) ? 200 : 600;
+      return( _velocity * 100.0 / free );
+    }
+    return( rpm );
+}
+
+double
+flywheel::voltage( voltageUnits units ) {
+    double v = (_target < 0) ? -_output : _output;
+    return( (units == voltageUnits::mV) ? v * 1000.0 : v );
+}
+
+bool
+flywheel::ready() {
+    return( _ready );
+}
+
+int32_t
+flywheel::shotCount() {
+    return( _shotCount );
+}
+
+const flywheel::shot *
+flywheel::shots( int32_t index ) {
+    int32_t kept  = (_shotCount < MAX_SHOTS) ? _shotCount : MAX_SHOTS;
+    int32_t first = _shotCount - kept;
+
+    if( index < 0 || index >= kept )
+      return( NULL );
+    return( &_shots[ (first + index) % MAX_SHOTS ] );
+}
+
+double
+flywheel::lastRecovery( timeUnits units ) {
+    for( int i=_shotCount-1;i>=0 && i>=_shotCount-MAX_SHOTS;i-- ) {
+      const shot *s = &_shots[ i % MAX_SHOTS ];
+      if( s->recovery != 0 )
+        return( (units == timeUnits::sec) ? s->recovery / 1000.0 : s->recovery );
+    }
+    return( 0 );
+}
+
+double
+flywheel::averageRecovery( timeUnits units ) {
+    double  sum = 0;
+    int32_t n   = 0;
+
+    for( int i=0;i<MAX_SHOTS && i<_shotCount;i++ ) {
+      if( _shots[i].recovery != 0 ) {
+        sum += _shots[i].recovery;
+        n++;
+      }
+    }
+    if( n == 0 )
+      return( 0 );
+
+    sum /= n;
+    return( (units == timeUnits::sec) ? sum / 1000.0 : sum );
+}
+
+void
+flywheel::clearShots() {
+    _recovering = false;
+    _shotCount  = 0;
+}
@@ -0,0 +1,343 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_healthmonitor.cpp                                       */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_healthmonitor.cpp
+  * @brief   Device fault and health monitor class
+*//*---------------------------------------------------------------------------*/
+
+#define DEFAULT_STALE_TIME    100       // mS, motors report every 10mS
+#define DEFAULT_STALL_TIME    250       // mS
+#define DEFAULT_STALL_CURRENT 1500      // mA
+#define HEALTH_LOG_MAGIC      0x48544c48  // 'HLTH'
+#define HEALTH_LOG_VERSION    1
+
+using namespace vex;
+
+// SD card file layout, a header followed by packed events
+typedef struct __attribute__ ((__packed__)) _health_log_header {
+    uint32_t          magic;
+    uint16_t          version;
+    uint16_t          recordSize;
+} health_log_header;
+
+health_monitor::health_monitor() {
+    _init();
+}
+
+health_monitor::~health_monitor() {
+    stop();
+}
+
+void
+health_monitor::_init() {
+    for( int i=0;i<PORTS;i++ )
+      _devices[i] = vexDeviceGetByIndex( i );
+
+    memset( _types,      0, sizeof(_types) );
+    memset( _faults,     0, sizeof(_faults) );
+    memset( _flags,      0, sizeof(_flags) );
+    memset( _timestamps, 0, sizeof(_timestamps) );
+    memset( _changed,    0, sizeof(_changed) );
+    memset( _stallSince, 0, sizeof(_stallSince) );
+
+    _present      = 0;
+    _motors       = 0;
+    _stale        = 0;
+    _stalled      = 0;
+    _limited      = 0;
+    _faulted      = 0;
+    _seen         = 0;
+
+    _staleTime    = DEFAULT_STALE_TIME;
+    _stallTime    = DEFAULT_STALL_TIME;
+    _stallCurrent = DEFAULT_STALL_CURRENT;
+
+    _callback     = NULL;
+    _queueHead    = 0;
+    _queueTail    = 0;
+
+    _log          = NULL;
+    _logCount     = 0;
+    _logDropped   = 0;
+
+    _task         = NULL;
+    _running      = false;
+    _period       = 10;
+}
+
+void
+health_monitor::setStaleTime( uint32_t time, timeUnits units ) {
+    _staleTime = (units == timeUnits::sec) ? time * 1000 : time;
+}
+
+void
+health_monitor::setStallThreshold( double current, uint32_t time ) {
+    _stallCurrent = (int32_t)( current * 1000.0 );
+    _stallTime    = time;
+}
+
+void
+health_monitor::setCallback( void (* callback)( const event &e ) ) {
+    _callback = callback;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Events                                                           */
+/*---------------------------------------------------------------------------*/
+
+void
+health_monitor::_post( uint32_t time, int32_t port, eventType type, uint32_t value ) {
+    event e;
+    e.time  = time;
+    e.port  = (uint8_t)port;
+    e.type  = (uint8_t)type;
+    e.value = (uint16_t)value;
+
+    if( _callback != NULL )
+      _callback( e );
+
+    // the queue keeps the newest events, the oldest is dropped when full
+    int32_t next = ( _queueHead + 1 ) % QUEUE_SIZE;
+    if( next == _queueTail )
+      _queueTail = ( _queueTail + 1 ) % QUEUE_SIZE;
+    _queue[ _queueHead ] = e;
+    _queueHead = next;
+
+    if( _log != NULL ) {
+      if( _logCount == LOG_SIZE )
+        flush();
+      if( _logCount < LOG_SIZE )
+        _logBuffer[ _logCount++ ] = e;
+      else
+        _logDropped++;
+    }
+}
+
+// one event per port whose bit changed, ctz walks only the set bits
+void
+health_monitor::_edges( uint32_t time, uint32_t before, uint32_t after, eventType rise, eventType fall ) {
+    uint32_t up   = after & ~before;
+    uint32_t down = before & ~after;
+
+    while( up ) {
+      int32_t port = __builtin_ctz( up );
+      up &= up - 1;
+      _post( time, port, rise, _types[port] );
+    }
+    while( down ) {
+      int32_t port = __builtin_ctz( down );
+      down &= down - 1;
+      _post( time, port, fall, _types[port] );
+    }
+}
+
+bool
+health_monitor::poll( event &e ) {
+    if( _queueTail == _queueHead )
+      return( false );
+
+    e = _queue[ _queueTail ];
+    _queueTail = ( _queueTail + 1 ) % QUEUE_SIZE;
+    return( true );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Sweep every port                                                 */
+/*---------------------------------------------------------------------------*/
+//
+// The device status buffer gives presence and type for every port in one
+// call, only motors cost further calls.  Conditions are collected into masks
+// and compared with the previous tick at the end.
+//
+int32_t
+health_monitor::update() {
+    uint32_t now = vexSystemTimeGet();
+    V5_DeviceTypeBuffer types;
+    vexDeviceGetStatus( types );
+
+    int32_t  posted  = 0;
+    uint32_t present = 0, motors = 0, stale = 0, stalled = 0, limited = 0, faulted = 0;
+
+    for( int i=0;i<PORTS;i++ ) {
+      uint32_t bit = 1u << i;
+
+      // the last known type is kept so the disconnect event can report it
+      if( types[i] == kDeviceTypeNoSensor ) {
+        _stallSince[i] = 0;
+        if( _faults[i] != 0 ) {
+          _post( now, i, eventType::faultCleared, _faults[i] );
+          _faults[i] = 0;
+          posted++;
+        }
+        continue;
+      }
+      present |= bit;
+
+      uint32_t timestamp = (uint32_t)vexDeviceGetTimestamp( _devices[i] );
+      if( !( _present & bit ) || types[i] != _types[i] || timestamp != _timestamps[i] ) {
+        _timestamps[i] = timestamp;
+        _changed[i]    = now;
+      }
+      else
+      if( now - _changed[i] > _staleTime )
+        stale |= bit;
+      _types[i] = (uint8_t)types[i];
+
+      if( types[i] != kDeviceTypeMotorSensor )
+        continue;
+      motors |= bit;
+
+      uint32_t faults = vexDeviceMotorFaultsGet( _devices[i] );
+      uint32_t flags  = vexDeviceMotorFlagsGet( _devices[i] );
+      bool     limit  = vexDeviceMotorCurrentLimitFlagGet( _devices[i] );
+
+      if( faults != _faults[i] ) {
+        if( faults & ~_faults[i] ) {
+          _post( now, i, eventType::faultSet, faults & ~_faults[i] );
+          posted++;
+        }
+        if( _faults[i] & ~faults ) {
+          _post( now, i, eventType::faultCleared, _faults[i] & ~faults );
+          posted++;
+        }
+        _faults[i] = faults;
+      }
+      _flags[i] = flags;
+
+      if( faults )
+        faulted |= bit;
+      if( limit )
+        limited |= bit;
+
+      // current is only worth reading when the motor is not moving
+      bool stall = limit;
+      if( !stall && ( flags & flagZeroVelocity ) )
+        stall = vexDeviceMotorCurrentGet( _devices[i] ) >= _stallCurrent;
+
+      if( !stall )
+        _stallSince[i] = 0;
+      else
+      if( _stallSince[i] == 0 )
+        _stallSince[i] = (now != 0) ? now : 1;
+      else
+      if( now - _stallSince[i] >= _stallTime )
+        stalled |= bit;
+    }
+
+    // stale and stall ending because the device went away is a disconnect
+    uint32_t gone = _present & ~present;
+    _edges( now, _present, present, eventType::connected, eventType::disconnected );
+    _edges( now, _stale & ~gone, stale, eventType::stale, eventType::fresh );
+    _edges( now, _stalled & ~gone, stalled, eventType::stallStart, eventType::stallEnd );
+    _edges( now, _limited & ~gone, limited, eventType::limitStart, eventType::limitEnd );
+
+    posted += __builtin_popcount( _present ^ present );
+    posted += __builtin_popcount( ( _stale   & ~gone ) ^ stale );
+    posted += __builtin_popcount( ( _stalled & ~gone ) ^ stalled );
+    posted += __builtin_popcount( ( _limited & ~gone ) ^ limited );
+
+    _present = present;
+    _motors  = motors;
+    _stale   = stale;
+    _stalled = stalled;
+    _limited = limited;
+    _faulted = faulted;
+    _seen   |= present;
+
+    return( posted );
+}
+
+uint32_t
+health_monitor::faults( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( 0 );
+    return( _faults[port] );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  SD card log                                                      */
+/*---------------------------------------------------------------------------*/
+
+bool
+health_monitor::log( const char *name ) {
+    if( _log != NULL ) {
+      flush();
+      vexFileClose( _log );
+    }
+
+    _log        = vexFileOpenWrite( name );
+    _logCount   = 0;
+    _logDropped = 0;
+    if( _log == NULL )
+      return( false );
+
+    health_log_header header = { HEALTH_LOG_MAGIC, HEALTH_LOG_VERSION, (uint16_t)sizeof(event) };
+    vexFileWrite( (char *)&header, sizeof(header), 1, _log );
+    return( true );
+}
+
+void
+health_monitor::flush() {
+    if( _log == NULL || _logCount == 0 )
+      return;
+
+    vexFileWrite( (char *)_logBuffer, sizeof(event), _logCount, _log );
+    vexFileSync( _log );
+    _logCount = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Task                                                             */
+/*---------------------------------------------------------------------------*/
+
+int
+health_monitor::_run( void *arg ) {
+    health_monitor *h = (health_monitor *)arg;
+    uint32_t last = vexSystemTimeGet();
+
+    while( h->_running ) {
+      h->update();
+
+      // SD writes are slow, batch them up to once a second
+      if( h->_logCount > 0 && vexSystemTimeGet() - last > 1000 ) {
+        h->flush();
+        last = vexSystemTimeGet();
+      }
+      vex::task::sleep( h->_period );
+    }
+    return( 0 );
+}
+
+void
+health_monitor::start( uint32_t period ) {
+    _period = (period < 1) ? 1 : period;
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this );
+}
+
+void
+health_monitor::stop() {
+    if( _task != NULL ) {
+      _running = false;
+      _task->stop();
+      delete _task;
+      _task = NULL;
+    }
+
+    if( _log != NULL ) {
+      flush();
+      vexFileClose( _log );
+      _log = NULL;
+    }
+}
@@ -0,0 +1,157 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_holonomic.cpp                                           */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_holonomic.cpp
+  * @brief   Holonomic (X-drive / mecanum) drive class
+*//*---------------------------------------------------------------------------*/
+
+#define MAX_MOTOR_VOLTAGE     12000     // mV
+#define DEG_TO_RAD            (3.14159265358979323846 / 180.0)
+
+using namespace vex;
+
+holonomic::holonomic( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, layoutType layout ) {
+    _g = NULL;
+    _init( fl, fr, rl, rr, layout );
+}
+
+holonomic::holonomic( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, vex::guido &g, layoutType layout ) {
+    _g = &g;
+    _init( fl, fr, rl, rr, layout );
+}
+
+holonomic::~holonomic() {
+}
+
+void
+holonomic::_init( vex::motor &fl, vex::motor &fr, vex::motor &rl, vex::motor &rr, layoutType layout ) {
+    // resolve device pointers once, every drive() call then goes
+    // straight to the jumptable without a port lookup
+    _devices[ (int)wheelType::frontLeft  ] = vexDeviceGetByIndex( fl.index() );
+    _devices[ (int)wheelType::frontRight ] = vexDeviceGetByIndex( fr.index() );
+    _devices[ (int)wheelType::rearLeft   ] = vexDeviceGetByIndex( rl.index() );
+    _devices[ (int)wheelType::rearRight  ] = vexDeviceGetByIndex( rr.index() );
+
+    _layout        = layout;
+    _fieldCentric  = false;
+    _headingOffset = 0;
+    _maxVoltage    = MAX_MOTOR_VOLTAGE;
+    // mecanum rollers slip when strafing, boost strafe a little so that
+    // diagonal commands track closer to the requested direction
+    _strafeScale   = (layout == layoutType::mecanum) ? 1.1 : 1.0;
+
+    for( int i=0;i<WHEEL_COUNT;i++ )
+      _output[i] = 0;
+}
+
+void
+holonomic::setFieldCentric( bool value ) {
+    _fieldCentric = value;
+}
+
+void
+holonomic::setHeadingOffset( double value, rotationUnits units ) {
+    _headingOffset = (units == rotationUnits::rev) ? value * 360.0 : value;
+}
+
+void
+holonomic::setStrafeScale( double scale ) {
+    _strafeScale = scale;
+}
+
+void
+holonomic::setMaxVoltage( double value, voltageUnits units ) {
+    int32_t mv = (units == voltageUnits::mV) ? (int32_t)value : (int32_t)(value * 1000.0);
+
+    if( mv < 0 )
+      mv = 0;
+    if( mv > MAX_MOTOR_VOLTAGE )
+      mv = MAX_MOTOR_VOLTAGE;
+
+    _maxVoltage = mv;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Mix the three drive components into four wheel voltages         */
+/*---------------------------------------------------------------------------*/
+//
+// forward, strafe and turn are normalized so that 1.0 is full output on a
+// single wheel.  Wheels are computed into a small array and desaturated
+// together so that the direction of travel is preserved when the sum of
+// components exceeds the available output.
+//
+void
+holonomic::_mix( double forward, double strafe, double turn, double scale ) {
+    strafe *= _strafeScale;
+
+    // rotate the command from field to robot frame, heading is clockwise
+    // positive so the command is rotated by -heading
+    if( _fieldCentric && _g != NULL ) {
+      double h = (_g->heading( rotationUnits::deg ) - _headingOffset) * DEG_TO_RAD;
+      double s = sin( h );
+      double c = cos( h );
+      double f = strafe * s + forward * c;
+
+      strafe  = strafe * c - forward * s;
+      forward = f;
+    }
+
+    // both layouts share the same inverse kinematics, wheel rollers are at
+    // 45 deg to the chassis in either case
+    double w[WHEEL_COUNT];
+    w[ (int)wheelType::frontLeft  ] = forward + strafe + turn;
+    w[ (int)wheelType::frontRight ] = forward - strafe - turn;
+    w[ (int)wheelType::rearLeft   ] = forward - strafe + turn;
+    w[ (int)wheelType::rearRight  ] = forward + strafe - turn;
+
+    double peak = 1.0;
+    for( int i=0;i<WHEEL_COUNT;i++ ) {
+      double a = fabs( w[i] );
+      if( a > peak )
+        peak = a;
+    }
+
+    double k = scale / peak;
+    for( int i=0;i<WHEEL_COUNT;i++ )
+      _output[i] = (int32_t)( w[i] * k );
+
+    for( int i=0;i<WHEEL_COUNT;i++ )
+      vexDeviceMotorVoltageSet( _devices[i], _output[i] );
+}
+
+void
+holonomic::drive( double forward, double strafe, double turn, percentUnits units ) {
+    (void)units;
+    _mix( forward / 100.0, strafe / 100.0, turn / 100.0, _maxVoltage );
+}
+
+void
+holonomic::drive( double forward, double strafe, double turn, voltageUnits units ) {
+    double full = (units == voltageUnits::mV) ? MAX_MOTOR_VOLTAGE : MAX_MOTOR_VOLTAGE / 1000.0;
+
+    _mix( forward / full, strafe / full, turn / full, _maxVoltage );
+}
+
+void
+holonomic::stop( brakeType mode ) {
+    for( int i=0;i<WHEEL_COUNT;i++ ) {
+      _output[i] = 0;
+      vexDeviceMotorBrakeModeSet( _devices[i], (V5MotorBrakeMode)mode );
+      vexDeviceMotorVelocitySet( _devices[i], 0 );
+    }
+}
+
+double
+holonomic::wheelVoltage( wheelType wheel, voltageUnits units ) {
+    int32_t mv = _output[ (int)wheel ];
+
+    return( (units == voltageUnits::mV) ? mv : mv / 1000.0 );
+}
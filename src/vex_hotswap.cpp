@@ -0,0 +1,231 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_hotswap.cpp                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_hotswap.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_hotswap.cpp
+  * @brief   Code modules that can be reloaded while the program runs
+*//*---------------------------------------------------------------------------*/
+
+#define SAVE_FUNCTION       "vex_module_save"
+#define RESTORE_FUNCTION    "vex_module_restore"
+
+using namespace vex;
+
+typedef uint32_t (* save_t)( void *state, uint32_t size );
+typedef void     (* restore_t)( const void *state, uint32_t size );
+
+hotswap::slot         hotswap::_slots[ hotswap::MAX_SLOTS ];
+int32_t               hotswap::_slotCount = 0;
+uint8_t               hotswap::_state[ hotswap::STATE_SIZE ];
+
+#define TRAMPOLINES4( n )   &hotswap::_trampoline<n>,   &hotswap::_trampoline<n+1>, \
+                            &hotswap::_trampoline<n+2>, &hotswap::_trampoline<n+3>
+
+void               (* const hotswap::_trampolines[ hotswap::MAX_SLOTS ])( void ) = {
+    TRAMPOLINES4(  0 ), TRAMPOLINES4(  4 ), TRAMPOLINES4(  8 ), TRAMPOLINES4( 12 ),
+    TRAMPOLINES4( 16 ), TRAMPOLINES4( 20 ), TRAMPOLINES4( 24 ), TRAMPOLINES4( 28 )
+};
+
+#undef  TRAMPOLINES4
+
+hotswap::hotswap( const char *name, const module::symbol *exports, int32_t count ) {
+    _current  = -1;
+    _last     = 0;
+    _name     = name;
+    _exports  = exports;
+    _count    = count;
+    _reloads  = 0;
+    _swapping = false;
+    _active   = 0;
+}
+
+hotswap::~hotswap() {
+    // the trampolines may still be registered with events, leave them as no-ops
+    for( int32_t i=0;i<_slotCount;i++ ) {
+      if( _slots[i].owner == this ) {
+        _stop( _slots[i] );
+        _slots[i].target = NULL;
+        _slots[i].owner  = NULL;
+      }
+    }
+    for( int i=0;i<2;i++ )
+      _modules[i].unload();
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Trampolines                                                      */
+/*---------------------------------------------------------------------------*/
+
+void
+hotswap::_call( int32_t index ) {
+    slot &s = _slots[index];
+
+    while( s.owner != NULL && s.owner->_swapping )
+      vex::task::yield();
+
+    hotswap *owner = s.owner;
+    void   (* fn)( void ) = (void (*)( void ))s.target;
+    if( owner == NULL || fn == NULL )
+      return;
+
+    owner->_active++;
+    fn();
+    owner->_active--;
+}
+
+int
+hotswap::_run( void *arg ) {
+    slot *s = (slot *)arg;
+    int (* fn)( void ) = (int (*)( void ))s->target;
+    return( ( fn != NULL ) ? fn() : 0 );
+}
+
+void
+hotswap::_start( slot &s ) {
+    if( s.target != NULL )
+      s.task = new vex::task( _run, &s, s.priority );
+}
+
+void
+hotswap::_stop( slot &s ) {
+    if( s.task != NULL ) {
+      s.task->stop();
+      delete s.task;
+      s.task = NULL;
+    }
+}
+
+// a name that is already registered by this object gets the same slot
+int32_t
+hotswap::_reserve( const char *name, int32_t priority, bool task ) {
+    for( int32_t i=0;i<_slotCount;i++ ) {
+      if( _slots[i].owner == this && strcmp( _slots[i].name, name ) == 0 && ( _slots[i].priority >= 0 ) == task )
+        return( i );
+    }
+    if( _slotCount >= MAX_SLOTS )
+      return( -1 );
+
+    slot &s    = _slots[_slotCount];
+    s.owner    = this;
+    s.name     = name;
+    s.target   = ( _current >= 0 ) ? _modules[_current].find( name ) : NULL;
+    s.task     = NULL;
+    s.priority = task ? priority : -1;
+    return( _slotCount++ );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Reload                                                           */
+/*---------------------------------------------------------------------------*/
+
+bool
+hotswap::reload() {
+    if( _swapping )
+      return( false );
+
+    int32_t next = ( _current == 0 ) ? 1 : 0;
+    _last = next;
+    if( !_modules[next].load( _name, _exports, _count ) )
+      return( false );
+
+    // hold new handler calls at the trampoline and let running ones finish
+    _swapping = true;
+    uint32_t start = vexSystemTimeGet();
+    while( _active > 0 ) {
+      if( vexSystemTimeGet() - start > QUIESCE_TIMEOUT ) {
+        _swapping = false;
+        _modules[next].unload();
+        _last = ( _current >= 0 ) ? _current : next;
+        return( false );
+      }
+      vex::task::yield();
+    }
+
+    for( int32_t i=0;i<_slotCount;i++ ) {
+      if( _slots[i].owner == this )
+        _stop( _slots[i] );
+    }
+
+    uint32_t size = 0;
+    if( _current >= 0 ) {
+      save_t save = _modules[_current].get<save_t>( SAVE_FUNCTION );
+      if( save != NULL )
+        size = save( _state, STATE_SIZE );
+      if( size > STATE_SIZE )
+        size = STATE_SIZE;
+    }
+
+    for( int32_t i=0;i<_slotCount;i++ ) {
+      if( _slots[i].owner == this )
+        _slots[i].target = _modules[next].find( _slots[i].name );
+    }
+
+    if( _current >= 0 )
+      _modules[_current].unload();
+    _current = next;
+    _reloads++;
+
+    restore_t restore = _modules[_current].get<restore_t>( RESTORE_FUNCTION );
+    if( restore != NULL )
+      restore( _state, size );
+
+    _swapping = false;
+    for( int32_t i=0;i<_slotCount;i++ ) {
+      if( _slots[i].owner == this && _slots[i].priority >= 0 )
+        _start( _slots[i] );
+    }
+    return( true );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Registration                                                     */
+/*---------------------------------------------------------------------------*/
+
+void
+(* hotswap::handler( const char *name ))( void ) {
+    int32_t index = _reserve( name, -1, false );
+    return( ( index >= 0 ) ? _trampolines[index] : NULL );
+}
+
+bool
+hotswap::task( const char *name, int32_t priority ) {
+    if( priority < 0 )
+      priority = 0;
+
+    int32_t index = _reserve( name, priority, true );
+    if( index < 0 )
+      return( false );
+
+    slot &s = _slots[index];
+    if( s.task == NULL && !_swapping )
+      _start( s );
+    return( true );
+}
+
+bool
+hotswap::loaded() {
+    return( _current >= 0 );
+}
+
+module::statusType
+hotswap::status() {
+    return( _modules[_last].status() );
+}
+
+const char *
+hotswap::missing() {
+    return( _modules[_last].missing() );
+}
+
+uint32_t
+hotswap::reloads() {
+    return( _reloads );
+}
@@ -0,0 +1,255 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_interpose.cpp                                           */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_thunks.h"
+#include "vex_interpose.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_interpose.cpp
+  * @brief   Firmware jumptable interposition for call counts and latency
+*//*---------------------------------------------------------------------------*/
+
+using namespace vex;
+
+interpose::stats      interpose::_stats[ interpose::MAX_HOOKS ];
+int32_t               interpose::_count = 0;
+uint64_t            (*interpose::_clock)( void ) = NULL;
+
+static inline void * volatile *
+_slot( uint32_t offset ) {
+    return( (void * volatile *)( offsets::TABLE_BASE + offset ) );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Validate an offset and take a statistics entry for it           */
+/*---------------------------------------------------------------------------*/
+//
+// A slot keeps its entry for the life of the program, installing it again
+// after remove() carries on counting in the same entry.  An entry that is
+// already wrapped is returned as it is.
+//
+int32_t
+interpose::_reserve( const char *name, uint32_t offset ) {
+    if( (offset & 3) != 0 || offset < 0x10 || offset >= TABLE_SIZE )
+      return( -1 );
+
+    int32_t index = -1;
+    for( int i=0;i<_count;i++ ) {
+      if( _stats[i].offset == offset ) {
+        if( _stats[i].wrapped )
+          return( i );
+        index = i;
+        break;
+      }
+    }
+    if( index < 0 && _count >= MAX_HOOKS )
+      return( -1 );
+
+    // the clock is captured before anything is patched, so wrapping
+    // vexSystemHighResTimeGet itself does not recurse
+    if( _clock == NULL )
+      _clock = (uint64_t (*)( void ))*_slot( offsets::vexSystemHighResTimeGet );
+
+    void *target = *_slot( offset );
+    if( target == NULL )
+      return( -1 );
+
+    if( index < 0 ) {
+      index = _count++;
+      memset( &_stats[index], 0, sizeof(stats) );
+    }
+
+    stats *s = &_stats[ index ];
+    s->name     = name;
+    s->offset   = offset;
+    s->original = target;
+    return( index );
+}
+
+//
+// The jumptable is data, callers load the slot on every call, so a single
+// aligned word store followed by a barrier is all that is needed.
+//
+void
+interpose::_patch( int32_t index, void *thunk ) {
+    *_slot( _stats[index].offset ) = thunk;
+    __sync_synchronize();
+    _stats[index].wrapped = true;
+}
+
+bool
+interpose::remove( uint32_t offset ) {
+    for( int i=0;i<_count;i++ ) {
+      stats *s = &_stats[i];
+      if( s->offset != offset || !s->wrapped )
+        continue;
+
+      // original is kept, a thunk still running may read it
+      *_slot( offset ) = s->original;
+      __sync_synchronize();
+      s->wrapped = false;
+      return( true );
+    }
+    return( false );
+}
+
+void
+interpose::removeAll() {
+    for( int i=0;i<_count;i++ ) {
+      if( _stats[i].wrapped )
+        remove( _stats[i].offset );
+    }
+}
+
+//
+// A wrapped slot keeps its thunk and only the function it calls changes,
+// so the replacement is timed and remove() later restores whatever was
+// exchanged last.
+//
+void *
+interpose::exchange( uint32_t offset, void *fn ) {
+    void *old;
+
+    for( int i=0;i<_count;i++ ) {
+      stats *s = &_stats[i];
+      if( s->offset != offset || !s->wrapped )
+        continue;
+
+      old = s->original;
+      s->original = fn;
+      __sync_synchronize();
+      return( old );
+    }
+
+    old = *_slot( offset );
+    *_slot( offset ) = fn;
+    __sync_synchronize();
+    return( old );
+}
+
+void
+interpose::reset() {
+    for( int i=0;i<_count;i++ ) {
+      stats *s = &_stats[i];
+      s->calls = 0;
+      s->max   = 0;
+      s->total = 0;
+      memset( s->histogram, 0, sizeof(s->histogram) );
+    }
+}
+
+int32_t
+interpose::count() {
+    return( _count );
+}
+
+const interpose::stats *
+interpose::data( int32_t index ) {
+    if( index < 0 || index >= _count )
+      return( NULL );
+    return( &_stats[index] );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Reports                                                          */
+/*---------------------------------------------------------------------------*/
+
+// percentile from the histogram, reported as the upper bound of its bucket in uS
+static uint32_t
+_percentile( const interpose::stats *s, double p ) {
+    uint32_t target = (uint32_t)( s->calls * p );
+    uint32_t seen   = 0;
+
+    for( int b=0;b<interpose::BUCKETS;b++ ) {
+      seen += s->histogram[b];
+      if( seen > target )
+        return( (b == 0) ? 0 : 1u << b );
+    }
+    return( s->max );
+}
+
+void
+interpose::print() {
+    int32_t order[MAX_HOOKS];
+
+    for( int i=0;i<_count;i++ ) {
+      int j = i;
+      while( j > 0 && _stats[ order[j-1] ].total < _stats[i].total ) {
+        order[j] = order[j-1];
+        j--;
+      }
+      order[j] = i;
+    }
+
+    vex_printf( "%-36s %5s %10s %12s %8s %8s %8s\n", "function", "slot", "calls", "total us", "mean", "p50<", "max" );
+    for( int i=0;i<_count;i++ ) {
+      const stats *s = &_stats[ order[i] ];
+      vex_printf( "%-36s %5x %10lu %12llu %8.2f %8lu %8lu\n", s->name, (unsigned)s->offset,
+                  (unsigned long)s->calls, (unsigned long long)s->total,
+                  s->calls ? (double)s->total / s->calls : 0.0,
+                  (unsigned long)_percentile( s, 0.5 ), (unsigned long)s->max );
+    }
+}
+
+//
+// snprintf returns the length it would have written, so len is clamped to
+// what is in the buffer and a line that does not fit is cut short.
+//
+static int
+_append( char *line, int size, int len, const char *format, ... ) {
+    if( len >= size - 1 )
+      return( len );
+
+    va_list args;
+    va_start( args, format );
+    int n = vex_vsnprintf( line + len, size - len, format, args );
+    va_end( args );
+
+    if( n < 0 )
+      return( len );
+    return( ( n < size - len ) ? len + n : size - 1 );
+}
+
+// the newline goes in the last byte when the line was cut short
+static void
+_writeLine( char *line, int size, int len, FIL *fp ) {
+    if( len > size - 2 )
+      len = size - 2;
+    line[len++] = '\n';
+    vexFileWrite( line, 1, len, fp );
+}
+
+bool
+interpose::save( const char *name ) {
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    // the longest row is a 36 character name, five counts and 20 buckets of 10 digits
+    char line[320];
+    int  len;
+
+    len = _append( line, sizeof(line), 0, "function,offset,calls,total_us,max_us" );
+    for( int b=0;b<BUCKETS;b++ )
+      len = _append( line, sizeof(line), len, ",lt%lu", (unsigned long)( 1u << b ) );
+    _writeLine( line, sizeof(line), len, fp );
+
+    for( int i=0;i<_count;i++ ) {
+      const stats *s = &_stats[i];
+      len = _append( line, sizeof(line), 0, "%s,0x%03x,%lu,%llu,%lu", s->name, (unsigned)s->offset,
+                     (unsigned long)s->calls, (unsigned long long)s->total, (unsigned long)s->max );
+      for( int b=0;b<BUCKETS;b++ )
+        len = _append( line, sizeof(line), len, ",%lu", (unsigned long)s->histogram[b] );
+      _writeLine( line, sizeof(line), len, fp );
+    }
+
+    vexFileClose( fp );
+    return( true );
+}
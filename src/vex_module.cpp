@@ -0,0 +1,498 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_module.cpp                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_thunks.h"
+#include "vex_module.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_module.cpp
+  * @brief   Relocating loader for code modules on the SD card
+*//*---------------------------------------------------------------------------*/
+
+// only the parts of the ELF format a shared object needs, newlib has no elf.h
+#define ET_DYN              3
+#define EM_ARM              40
+#define EF_ARM_ABI_HARD     0x00000400
+#define PT_LOAD             1
+#define PT_DYNAMIC          2
+#define SHN_UNDEF           0
+#define STB_WEAK            2
+
+#define DT_NULL             0
+#define DT_HASH             4
+#define DT_STRTAB           5
+#define DT_SYMTAB           6
+#define DT_STRSZ            10
+#define DT_INIT             12
+#define DT_FINI             13
+#define DT_REL              17
+#define DT_RELA             7
+#define DT_RELSZ            18
+#define DT_PLTREL           20
+#define DT_PLTRELSZ         2
+#define DT_JMPREL           23
+#define DT_INIT_ARRAY       25
+#define DT_FINI_ARRAY       26
+#define DT_INIT_ARRAYSZ     27
+#define DT_FINI_ARRAYSZ     28
+
+#define R_ARM_NONE          0
+#define R_ARM_ABS32         2
+#define R_ARM_GLOB_DAT      21
+#define R_ARM_JUMP_SLOT     22
+#define R_ARM_RELATIVE      23
+
+#define CACHE_LINE          32
+
+typedef struct _elf_header {
+    uint8_t     ident[16];
+    uint16_t    type;
+    uint16_t    machine;
+    uint32_t    version;
+    uint32_t    entry;
+    uint32_t    phoff;
+    uint32_t    shoff;
+    uint32_t    flags;
+    uint16_t    ehsize;
+    uint16_t    phentsize;
+    uint16_t    phnum;
+    uint16_t    shentsize;
+    uint16_t    shnum;
+    uint16_t    shstrndx;
+} elf_header;
+
+typedef struct _elf_segment {
+    uint32_t    type;
+    uint32_t    offset;
+    uint32_t    vaddr;
+    uint32_t    paddr;
+    uint32_t    filesz;
+    uint32_t    memsz;
+    uint32_t    flags;
+    uint32_t    align;
+} elf_segment;
+
+typedef struct _elf_symbol {
+    uint32_t    name;
+    uint32_t    value;
+    uint32_t    size;
+    uint8_t     info;
+    uint8_t     other;
+    uint16_t    shndx;
+} elf_symbol;
+
+typedef struct _elf_rel {
+    uint32_t    offset;
+    uint32_t    info;
+} elf_rel;
+
+using namespace vex;
+
+module::module() {
+    _memory     = NULL;
+    _status     = statusType::unloaded;
+    _missing[0] = 0;
+    unload();
+}
+
+module::~module() {
+    unload();
+}
+
+bool
+module::_fail( statusType status ) {
+    unload();
+    _status = status;
+    return( false );
+}
+
+bool
+module::_read( FIL *fp, uint32_t offset, void *to, uint32_t size ) {
+    if( vexFileSeek( fp, offset, SEEK_SET ) != FR_OK )
+      return( false );
+    return( size == 0 || vexFileRead( (char *)to, 1, size, fp ) == (int32_t)size );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Symbols                                                          */
+/*---------------------------------------------------------------------------*/
+
+static uint32_t
+elfHash( const char *name ) {
+    uint32_t h = 0;
+    while( *name ) {
+      h = ( h << 4 ) + (uint8_t)*name++;
+      uint32_t g = h & 0xF0000000;
+      if( g )
+        h ^= g >> 24;
+      h &= ~g;
+    }
+    return( h );
+}
+
+static const offsets::symbol *
+jumptable( const char *name ) {
+    int32_t lo = 0;
+    int32_t hi = (int32_t)offsets::SYMBOL_COUNT - 1;
+
+    while( lo <= hi ) {
+      int32_t mid = ( lo + hi ) / 2;
+      int     c   = strcmp( name, offsets::symbols[mid].name );
+      if( c == 0 )
+        return( &offsets::symbols[mid] );
+      if( c < 0 )
+        hi = mid - 1;
+      else
+        lo = mid + 1;
+    }
+    return( NULL );
+}
+
+// a weak import that is not found binds to 0
+bool
+module::_resolve( uint32_t index, const symbol *exports, int32_t count, uint32_t &value ) {
+    const elf_symbol *s = (const elf_symbol *)( _symtab + index * sizeof(elf_symbol) );
+    if( s->shndx != SHN_UNDEF ) {
+      value = (uint32_t)( _base + s->value );
+      return( true );
+    }
+
+    const char *name = _strtab + s->name;
+    for( int32_t i=0;i<count;i++ ) {
+      if( strcmp( exports[i].name, name ) == 0 ) {
+        value = (uint32_t)exports[i].address;
+        return( true );
+      }
+    }
+
+    const offsets::symbol *j = jumptable( name );
+    if( j != NULL ) {
+      value = *(uint32_t *)( offsets::TABLE_BASE + j->offset );
+      return( true );
+    }
+
+    value = 0;
+    if( ( s->info >> 4 ) == STB_WEAK )
+      return( true );
+
+    strncpy( _missing, name, NAME_SIZE - 1 );
+    _missing[NAME_SIZE - 1] = 0;
+    return( false );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Relocation                                                       */
+/*---------------------------------------------------------------------------*/
+
+//
+// ARM shared objects use REL, the addend is the word being relocated.
+//
+bool
+module::_relocate( const uint8_t *rel, uint32_t size, const symbol *exports, int32_t count ) {
+    if( rel < _base + _low || rel + size > _base + _end ) {
+      _status = statusType::badRelocation;
+      return( false );
+    }
+
+    for( uint32_t i=0;i+sizeof(elf_rel)<=size;i+=sizeof(elf_rel) ) {
+      const elf_rel *r = (const elf_rel *)( rel + i );
+      uint32_t  type   = r->info & 0xFF;
+      uint32_t  index  = r->info >> 8;
+
+      if( type == R_ARM_NONE )
+        continue;
+      if( r->offset < _low || r->offset > _end - 4 || (r->offset & 3) != 0 ) {
+        _status = statusType::badRelocation;
+        return( false );
+      }
+
+      uint32_t *p = (uint32_t *)( _base + r->offset );
+      if( type == R_ARM_RELATIVE ) {
+        *p += (uint32_t)_base;
+        continue;
+      }
+      if( type != R_ARM_ABS32 && type != R_ARM_GLOB_DAT && type != R_ARM_JUMP_SLOT ) {
+        _status = statusType::badRelocation;
+        return( false );
+      }
+
+      // the symbol and its name must be inside the tables load() checked
+      if( index >= _symbols || ( (const elf_symbol *)( _symtab + index * sizeof(elf_symbol) ) )->name >= _strsz ) {
+        _status = statusType::badRelocation;
+        return( false );
+      }
+
+      uint32_t value;
+      if( !_resolve( index, exports, count, value ) ) {
+        _status = statusType::unresolved;
+        return( false );
+      }
+      *p = ( type == R_ARM_ABS32 ) ? *p + value : value;
+    }
+    return( true );
+}
+
+//
+// Code was written through the data cache, clean it to the point of
+// unification and drop any stale instruction lines before it runs.  The L2
+// is unified so it needs nothing.
+//
+void
+module::_sync() {
+    uint32_t start = ( (uint32_t)_base + _low ) & ~(CACHE_LINE - 1);
+    uint32_t end   = (uint32_t)_base + _end;
+
+    for( uint32_t a=start;a<end;a+=CACHE_LINE )
+      asm volatile( "mcr p15, 0, %0, c7, c11, 1" :: "r" (a) : "memory" );   // DCCMVAU
+    asm volatile( "dsb" ::: "memory" );
+    for( uint32_t a=start;a<end;a+=CACHE_LINE )
+      asm volatile( "mcr p15, 0, %0, c7, c5, 1" :: "r" (a) : "memory" );    // ICIMVAU
+    asm volatile( "mcr p15, 0, %0, c7, c5, 6" :: "r" (0) : "memory" );      // BPIALL
+    asm volatile( "dsb\n\tisb" ::: "memory" );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Loading                                                          */
+/*---------------------------------------------------------------------------*/
+
+bool
+module::load( const char *name, const symbol *exports, int32_t count ) {
+    unload();
+    _missing[0] = 0;
+
+    FIL *fp = vexFileOpen( name, "r" );
+    if( fp == NULL )
+      return( _fail( statusType::fileError ) );
+
+    elf_header   h;
+    elf_segment  segments[MAX_SEGMENTS];
+    int32_t      n = 0;
+
+    if( !_read( fp, 0, &h, sizeof(h) ) ) {
+      vexFileClose( fp );
+      return( _fail( statusType::fileError ) );
+    }
+    if( memcmp( h.ident, "\x7F" "ELF\x01\x01", 6 ) != 0 || h.type != ET_DYN || h.machine != EM_ARM ||
+        (h.flags & EF_ARM_ABI_HARD) != 0 || h.phentsize != sizeof(elf_segment) || h.phnum > MAX_SEGMENTS ) {
+      vexFileClose( fp );
+      return( _fail( statusType::badFormat ) );
+    }
+
+    // keep PT_LOAD and PT_DYNAMIC in file order so the reads only seek forward
+    elf_segment all[MAX_SEGMENTS];
+    if( !_read( fp, h.phoff, all, h.phnum * sizeof(elf_segment) ) ) {
+      vexFileClose( fp );
+      return( _fail( statusType::fileError ) );
+    }
+
+    uint32_t low  = 0xFFFFFFFF;
+    uint32_t high = 0;
+    uint32_t dynamic = 0;
+    for( int32_t i=0;i<h.phnum;i++ ) {
+      if( all[i].type == PT_DYNAMIC )
+        dynamic = all[i].vaddr;
+      if( all[i].type != PT_LOAD )
+        continue;
+      if( all[i].filesz > all[i].memsz || all[i].vaddr + all[i].memsz < all[i].vaddr ) {
+        vexFileClose( fp );
+        return( _fail( statusType::badFormat ) );
+      }
+
+      int32_t j = n++;
+      while( j > 0 && segments[j-1].offset > all[i].offset ) {
+        segments[j] = segments[j-1];
+        j--;
+      }
+      segments[j] = all[i];
+      low  = ( all[i].vaddr < low ) ? all[i].vaddr : low;
+      high = ( all[i].vaddr + all[i].memsz > high ) ? all[i].vaddr + all[i].memsz : high;
+    }
+    if( n == 0 || dynamic == 0 ) {
+      vexFileClose( fp );
+      return( _fail( statusType::badFormat ) );
+    }
+
+    // one allocation for the whole image, the file is read straight into it
+    low &= ~(ALIGNMENT - 1);
+    _memory = (uint8_t *)malloc( high - low + ALIGNMENT );
+    if( _memory == NULL ) {
+      vexFileClose( fp );
+      return( _fail( statusType::noMemory ) );
+    }
+    uint8_t *image = (uint8_t *)( ( (uint32_t)_memory + ALIGNMENT - 1 ) & ~(ALIGNMENT - 1) );
+    _base  = image - low;
+    _low   = low;
+    _end   = high;
+    _size  = high - low;
+
+    for( int32_t i=0;i<n;i++ ) {
+      uint8_t *to = _base + segments[i].vaddr;
+      if( !_read( fp, segments[i].offset, to, segments[i].filesz ) ) {
+        vexFileClose( fp );
+        return( _fail( statusType::fileError ) );
+      }
+      memset( to + segments[i].filesz, 0, segments[i].memsz - segments[i].filesz );
+    }
+    vexFileClose( fp );
+
+    // the dynamic section, the tables it points to are all in the image
+    const uint8_t *rel     = NULL;
+    const uint8_t *jmprel  = NULL;
+    uint32_t  relSize      = 0;
+    uint32_t  jmprelSize   = 0;
+    uint32_t  init         = 0;
+    uint32_t  initArray    = 0;
+    uint32_t  initArraySize = 0;
+
+    if( dynamic < _low || dynamic > _end - 8 || (dynamic & 3) != 0 )
+      return( _fail( statusType::badFormat ) );
+
+    for( const uint32_t *d = (const uint32_t *)( _base + dynamic );d[0]!=DT_NULL;d+=2 ) {
+      if( (const uint8_t *)( d + 2 ) > _base + _end )
+        return( _fail( statusType::badFormat ) );
+
+      bool address = d[0] == DT_HASH || d[0] == DT_STRTAB || d[0] == DT_SYMTAB || d[0] == DT_REL ||
+                     d[0] == DT_JMPREL || d[0] == DT_INIT || d[0] == DT_FINI || d[0] == DT_INIT_ARRAY ||
+                     d[0] == DT_FINI_ARRAY;
+      if( ( address && ( d[1] < _low || d[1] >= _end ) ) || d[0] == DT_RELA || ( d[0] == DT_PLTREL && d[1] != DT_REL ) )
+        return( _fail( statusType::badFormat ) );
+      if( ( d[0] == DT_HASH || d[0] == DT_SYMTAB ) && (d[1] & 3) != 0 )
+        return( _fail( statusType::badFormat ) );
+
+      switch( d[0] ) {
+        case DT_HASH:         _hash          = (const uint32_t *)( _base + d[1] ); break;
+        case DT_STRTAB:       _strtab        = (const char *)( _base + d[1] );     break;
+        case DT_SYMTAB:       _symtab        = _base + d[1];                       break;
+        case DT_STRSZ:        _strsz         = d[1];                               break;
+        case DT_REL:          rel            = _base + d[1];                       break;
+        case DT_RELSZ:        relSize        = d[1];                               break;
+        case DT_JMPREL:       jmprel         = _base + d[1];                       break;
+        case DT_PLTRELSZ:     jmprelSize     = d[1];                               break;
+        case DT_INIT:         init           = d[1];                               break;
+        case DT_FINI:         _fini          = d[1];                               break;
+        case DT_INIT_ARRAY:   initArray      = d[1];                               break;
+        case DT_INIT_ARRAYSZ: initArraySize  = d[1];                               break;
+        case DT_FINI_ARRAY:   _finiArray     = d[1];                               break;
+        case DT_FINI_ARRAYSZ: _finiArraySize = d[1];                               break;
+        default: break;
+      }
+    }
+    if( _symtab == NULL || _strtab == NULL || _hash == NULL || _strsz == 0 )
+      return( _fail( statusType::badFormat ) );
+
+    // the hash table gives the number of symbols, relocations and find()
+    // index the symbol table with it.  The string table must end in a 0 so
+    // every name inside it is terminated.
+    uint32_t words = ( _end - (uint32_t)( (const uint8_t *)_hash - _base ) ) / 4;
+    if( words < 2 || _hash[0] == 0 || _hash[0] > words - 2 || _hash[1] > words - 2 - _hash[0] )
+      return( _fail( statusType::badFormat ) );
+    _symbols = _hash[1];
+    if( (uint32_t)( _symtab - _base ) + (uint64_t)_symbols * sizeof(elf_symbol) > _end ||
+        (uint32_t)( (const uint8_t *)_strtab - _base ) + (uint64_t)_strsz > _end || _strtab[_strsz - 1] != 0 )
+      return( _fail( statusType::badFormat ) );
+    if( (uint64_t)initArray + initArraySize > _end || (uint64_t)_finiArray + _finiArraySize > _end )
+      return( _fail( statusType::badFormat ) );
+
+    if( ( rel != NULL && !_relocate( rel, relSize, exports, count ) ) ||
+        ( jmprel != NULL && !_relocate( jmprel, jmprelSize, exports, count ) ) )
+      return( _fail( _status ) );
+
+    _entry  = h.entry;
+    _status = statusType::loaded;
+    _sync();
+
+    if( init != 0 )
+      ( (void (*)( void ))( _base + init ) )();
+    for( uint32_t i=0;i<initArraySize / 4;i++ )
+      ( (void (*)( void ))( ( (uint32_t *)( _base + initArray ) )[i] ) )();
+    return( true );
+}
+
+void
+module::unload() {
+    if( _memory != NULL && _status == statusType::loaded ) {
+      for( uint32_t i=_finiArraySize / 4;i>0;i-- )
+        ( (void (*)( void ))( ( (uint32_t *)( _base + _finiArray ) )[i-1] ) )();
+      if( _fini != 0 )
+        ( (void (*)( void ))( _base + _fini ) )();
+    }
+    if( _memory != NULL )
+      free( _memory );
+
+    _memory        = NULL;
+    _base          = NULL;
+    _low           = 0;
+    _end           = 0;
+    _size          = 0;
+    _entry         = 0;
+    _status        = statusType::unloaded;
+    _hash          = NULL;
+    _symtab        = NULL;
+    _strtab        = NULL;
+    _symbols       = 0;
+    _strsz         = 0;
+    _finiArray     = 0;
+    _finiArraySize = 0;
+    _fini          = 0;
+}
+
+bool
+module::loaded() {
+    return( _status == statusType::loaded );
+}
+
+module::statusType
+module::status() {
+    return( _status );
+}
+
+const char *
+module::missing() {
+    return( _missing );
+}
+
+//
+// The SysV hash table, nbucket and nchain followed by the buckets and the
+// chains.  Only defined symbols are returned.  load() checked the table
+// fits in the image, an index past nchain or a chain longer than nchain
+// ends the search.
+//
+void *
+module::find( const char *name ) {
+    if( _status != statusType::loaded || _hash == NULL )
+      return( NULL );
+
+    uint32_t        buckets = _hash[0];
+    const uint32_t *chains  = _hash + 2 + buckets;
+    uint32_t        steps   = 0;
+
+    for( uint32_t i=_hash[2 + elfHash( name ) % buckets];i!=0 && i<_symbols && steps<_symbols;i=chains[i],steps++ ) {
+      const elf_symbol *s = (const elf_symbol *)( _symtab + i * sizeof(elf_symbol) );
+      if( s->shndx != SHN_UNDEF && s->name < _strsz && strcmp( _strtab + s->name, name ) == 0 )
+        return( _base + s->value );
+    }
+    return( NULL );
+}
+
+void *
+module::entry() {
+    return( ( _status == statusType::loaded && _entry != 0 ) ? _base + _entry : NULL );
+}
+
+void *
+module::base() {
+    return( _base );
+}
+
+uint32_t
+module::size() {
+    return( _size );
+}
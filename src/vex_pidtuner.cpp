@@ -0,0 +1,421 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_pidtuner.cpp                                            */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_pidtuner.cpp
+  * @brief   Relay feedback autotuner for the motor internal PID loops
+*//*---------------------------------------------------------------------------*/
+
+#define MAX_MOTOR_VOLTAGE     12000     // mV
+#define SKIP_CYCLES           2         // let the limit cycle settle first
+#define MAX_CYCLES            16
+#define MAX_SAVED_ENTRIES     64
+#define PIDTUNER_MAGIC        0x54444950  // 'PIDT'
+#define PIDTUNER_VERSION      1
+
+using namespace vex;
+
+// SD card file layout, a header followed by a flat array of entries
+typedef struct __attribute__ ((__packed__)) _pidtuner_header {
+    uint32_t          magic;
+    uint16_t          version;
+    uint16_t          count;
+} pidtuner_header;
+
+typedef struct __attribute__ ((__packed__)) _pidtuner_entry {
+    uint8_t           port;
+    uint8_t           loop;
+    uint8_t           gearset;
+    uint8_t           pad;
+    V5_DeviceMotorPid pid;
+    float             ku;
+    float             tu;
+} pidtuner_entry;
+
+static pidtuner_entry  _entries[ MAX_SAVED_ENTRIES ];
+
+pidtuner::pidtuner() {
+    _init();
+}
+
+pidtuner::~pidtuner() {
+}
+
+void
+pidtuner::_init() {
+    _count         = 0;
+    _relay         = 3000;
+    _hysteresis    = 1.0;
+    _cycles        = 5;
+    _timeout       = 10000;
+    _rule          = ruleType::noOvershoot;
+    _firmwareScale = 1.0;
+    memset( &_template, 0, sizeof(_template) );
+}
+
+void
+pidtuner::_addMotor() {
+}
+
+void
+pidtuner::_addMotor( vex::motor &m ) {
+    if( _count >= MAX_MOTORS )
+      return;
+
+    V5_DeviceT device = vexDeviceGetByIndex( m.index() );
+    vexDeviceMotorEncoderUnitsSet( device, kMotorEncoderDegrees );
+    _ports[ _count ]   = m.index();
+    _devices[ _count ] = device;
+    _count++;
+}
+
+void
+pidtuner::setRelayAmplitude( double value, voltageUnits units ) {
+    int32_t mv = (units == voltageUnits::mV) ? (int32_t)value : (int32_t)(value * 1000.0);
+    _relay = (mv < 0) ? 0 : (mv > MAX_MOTOR_VOLTAGE) ? MAX_MOTOR_VOLTAGE : mv;
+}
+
+void
+pidtuner::setHysteresis( double value ) {
+    _hysteresis = fabs( value );
+}
+
+void
+pidtuner::setCycles( int32_t cycles ) {
+    _cycles = (cycles < 1) ? 1 : (cycles > MAX_CYCLES) ? MAX_CYCLES : cycles;
+}
+
+void
+pidtuner::setTimeout( int32_t time, timeUnits units ) {
+    _timeout = (uint32_t)( (units == timeUnits::sec) ? time * 1000 : time );
+}
+
+void
+pidtuner::setRule( ruleType rule ) {
+    _rule = rule;
+}
+
+void
+pidtuner::setTemplate( const V5_DeviceMotorPid &pid ) {
+    _template = pid;
+}
+
+void
+pidtuner::setFirmwareScale( double scale ) {
+    _firmwareScale = scale;
+}
+
+void
+pidtuner::_setVoltage( int32_t mv ) {
+    for( int i=0;i<_count;i++ )
+      vexDeviceMotorVoltageSet( _devices[i], mv );
+}
+
+double
+pidtuner::_measure( loopType loop ) {
+    double sum = 0;
+
+    for( int i=0;i<_count;i++ ) {
+      if( loop == loopType::position )
+        sum += vexDeviceMotorPositionGet( _devices[i] );
+      else
+        sum += vexDeviceMotorActualVelocityGet( _devices[i] );
+    }
+    return( sum / _count );
+}
+
+// raw encoder counts per output shaft degree, 1800 counts per rev on 36:1
+double
+pidtuner::_countsPerDegree( V5MotorGearset gearset ) {
+    switch( gearset ) {
+      case kMotorGearSet_36: return( V5_MOTOR_COUNTS_PER_ROT / 360.0 );
+      case kMotorGearSet_18: return( V5_MOTOR_COUNTS_PER_ROT / 2 / 360.0 );
+      default:               return( V5_MOTOR_COUNTS_PER_ROT / 6 / 360.0 );
+    }
+}
+
+// firmware gains are 4.4 fixed point
+uint8_t
+pidtuner::_toFixed( double gain ) {
+    double v = floor( gain * _firmwareScale * 16.0 + 0.5 );
+    return( (uint8_t)( (v < 0) ? 0 : (v > 255) ? 255 : v ) );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Convert Ku and Tu into gains using the selected rule            */
+/*---------------------------------------------------------------------------*/
+void
+pidtuner::_convert( result &r ) {
+    // { kp/ku, ti/tu, td/tu }, velocity loops use the PI form of each rule
+    static const double rules[3][2][3] = {
+      { { 0.60,  0.5, 0.125   }, { 0.45,   0.833, 0 } },
+      { { 0.45,  2.2, 0.15873 }, { 0.3125, 2.2,   0 } },
+      { { 0.20,  0.5, 0.3333  }, { 0.20,   0.5,   0 } }
+    };
+    const double *k = rules[ (int)_rule ][ (int)r.loop ];
+
+    // per count, the velocity loop error is taken in counts per second
+    double scale = _countsPerDegree( r.gearset );
+    if( r.loop == loopType::velocity )
+      scale *= 6.0;   // 1 rpm is 6 deg/s
+
+    double kp = k[0] * r.ku;
+    double ti = k[1] * r.tu;
+    double td = k[2] * r.tu;
+
+    r.kp = kp / scale;
+    r.ki = (ti > 0) ? r.kp / ti : 0;
+    r.kd = r.kp * td;
+
+    r.pid    = _template;
+    r.pid.kp = _toFixed( r.kp );
+    r.pid.ki = _toFixed( r.ki );
+    r.pid.kd = _toFixed( r.kd );
+    r.pid.kf = _toFixed( r.kf / scale );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Relay feedback test                                              */
+/*---------------------------------------------------------------------------*/
+//
+// The relay switches on the error with hysteresis h.  A cycle is measured
+// from one upward switch to the next, amplitude is half the peak to peak of
+// the measurement over that cycle.  For a relay of amplitude d
+//
+//   Ku = 4d / ( pi * sqrt( a^2 - h^2 ) )
+//
+pidtuner::result
+pidtuner::_runRelay( loopType loop, double target, int32_t base, int32_t relay ) {
+    result r;
+    memset( &r, 0, sizeof(r) );
+    r.loop    = loop;
+    r.gearset = vexDeviceMotorGearingGet( _devices[0] );
+
+    double   period[MAX_CYCLES];
+    double   amp[MAX_CYCLES];
+    int32_t  n        = 0;
+    int32_t  seen     = 0;
+    int32_t  state    = 1;
+    double   hi       = -1e9;
+    double   lo       = 1e9;
+    uint64_t lastRise = 0;
+    uint32_t last     = 0;
+    uint64_t start    = vexSystemHighResTimeGet();
+
+    _setVoltage( base + relay );
+
+    while( n < _cycles ) {
+      uint64_t now = vexSystemHighResTimeGet();
+      if( (uint32_t)( (now - start) / 1000 ) > _timeout )
+        break;
+
+      uint32_t timestamp = (uint32_t)vexDeviceGetTimestamp( _devices[0] );
+      if( timestamp != last ) {
+        last = timestamp;
+
+        double y = _measure( loop );
+        double e = target - y;
+
+        if( y > hi ) hi = y;
+        if( y < lo ) lo = y;
+
+        if( state > 0 && e < -_hysteresis ) {
+          state = -1;
+        }
+        else
+        if( state < 0 && e > _hysteresis ) {
+          state = 1;
+          if( lastRise != 0 ) {
+            if( ++seen > SKIP_CYCLES ) {
+              period[n] = (now - lastRise) / 1e6;
+              amp[n]    = (hi - lo) / 2.0;
+              n++;
+            }
+          }
+          lastRise = now;
+          hi = lo = y;
+        }
+
+        _setVoltage( base + state * relay );
+      }
+
+      vex::task::sleep( 1 );
+    }
+
+    _setVoltage( 0 );
+
+    if( n < _cycles )
+      return( r );
+
+    double tu = 0, a = 0;
+    for( int i=0;i<n;i++ ) {
+      tu += period[i];
+      a  += amp[i];
+    }
+    tu /= n;
+    a  /= n;
+
+    double ae = (a > _hysteresis) ? sqrt( a * a - _hysteresis * _hysteresis ) : a;
+    if( ae <= 0 || tu <= 0 )
+      return( r );
+
+    r.ku        = 4.0 * relay / ( M_PI * ae );
+    r.tu        = tu;
+    r.amplitude = a;
+    r.valid     = true;
+    return( r );
+}
+
+pidtuner::result
+pidtuner::tunePosition() {
+    result r;
+    memset( &r, 0, sizeof(r) );
+    if( _count == 0 )
+      return( r );
+
+    r = _runRelay( loopType::position, _measure( loopType::position ), 0, _relay );
+    if( r.valid )
+      _convert( r );
+    return( r );
+}
+
+pidtuner::result
+pidtuner::tuneVelocity( double velocity, velocityUnits units ) {
+    result r;
+    memset( &r, 0, sizeof(r) );
+    if( _count == 0 )
+      return( r );
+
+    V5MotorGearset gearset = vexDeviceMotorGearingGet( _devices[0] );
+    double free = (gearset == kMotorGearSet_36) ? 100 : (gearset == kMotorGearSet_18) ? 200 : 600;
+
+    double rpm = velocity;
+    if( units == velocityUnits::pct )
+      rpm = velocity * free / 100.0;
+    else
+    if( units == velocityUnits::dps )
+      rpm = velocity / 6.0;
+
+    // relay about an open loop estimate of the voltage needed
+    double  kf   = MAX_MOTOR_VOLTAGE / free;
+    int32_t base = (int32_t)( rpm * kf );
+    int32_t d    = _relay;
+    if( abs( base ) + d > MAX_MOTOR_VOLTAGE )
+      d = MAX_MOTOR_VOLTAGE - abs( base );
+
+    r = _runRelay( loopType::velocity, rpm, base, d );
+    if( r.valid ) {
+      r.kf = kf;
+      _convert( r );
+    }
+    return( r );
+}
+
+void
+pidtuner::apply( const result &r ) {
+    if( !r.valid )
+      return;
+
+    V5_DeviceMotorPid pid = r.pid;
+    for( int i=0;i<_count;i++ ) {
+      if( r.loop == loopType::position )
+        vexDeviceMotorPositionPidSet( _devices[i], &pid );
+      else
+        vexDeviceMotorVelocityPidSet( _devices[i], &pid );
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  SD card persistence                                              */
+/*---------------------------------------------------------------------------*/
+
+static int32_t
+_readEntries( const char *name ) {
+    FIL *fp = vexFileOpen( name, "r" );
+    if( fp == NULL )
+      return( 0 );
+
+    pidtuner_header header;
+    int32_t count = 0;
+
+    if( vexFileRead( (char *)&header, sizeof(header), 1, fp ) == 1 &&
+        header.magic == PIDTUNER_MAGIC && header.version == PIDTUNER_VERSION ) {
+      count = (header.count > MAX_SAVED_ENTRIES) ? MAX_SAVED_ENTRIES : header.count;
+      count = vexFileRead( (char *)_entries, sizeof(pidtuner_entry), count, fp );
+      if( count < 0 )
+        count = 0;
+    }
+
+    vexFileClose( fp );
+    return( count );
+}
+
+bool
+pidtuner::save( const char *name, const result &r ) {
+    if( !r.valid )
+      return( false );
+
+    int32_t count = _readEntries( name );
+
+    for( int i=0;i<_count;i++ ) {
+      int j;
+      for( j=0;j<count;j++ ) {
+        if( _entries[j].port == _ports[i] && _entries[j].loop == (uint8_t)r.loop && _entries[j].gearset == (uint8_t)r.gearset )
+          break;
+      }
+      if( j == count ) {
+        if( count >= MAX_SAVED_ENTRIES )
+          continue;
+        count++;
+      }
+
+      _entries[j].port    = (uint8_t)_ports[i];
+      _entries[j].loop    = (uint8_t)r.loop;
+      _entries[j].gearset = (uint8_t)r.gearset;
+      _entries[j].pad     = 0;
+      _entries[j].pid     = r.pid;
+      _entries[j].ku      = (float)r.ku;
+      _entries[j].tu      = (float)r.tu;
+    }
+
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    pidtuner_header header = { PIDTUNER_MAGIC, PIDTUNER_VERSION, (uint16_t)count };
+    vexFileWrite( (char *)&header, sizeof(header), 1, fp );
+    vexFileWrite( (char *)_entries, sizeof(pidtuner_entry), count, fp );
+    vexFileClose( fp );
+    return( true );
+}
+
+int32_t
+pidtuner::load( const char *name ) {
+    int32_t count   = _readEntries( name );
+    int32_t applied = 0;
+
+    for( int i=0;i<_count;i++ ) {
+      uint8_t gearset = (uint8_t)vexDeviceMotorGearingGet( _devices[i] );
+
+      for( int j=0;j<count;j++ ) {
+        if( _entries[j].port != _ports[i] || _entries[j].gearset != gearset )
+          continue;
+
+        V5_DeviceMotorPid pid = _entries[j].pid;
+        if( _entries[j].loop == (uint8_t)loopType::position )
+          vexDeviceMotorPositionPidSet( _devices[i], &pid );
+        else
+          vexDeviceMotorVelocityPidSet( _devices[i], &pid );
+        applied++;
+      }
+    }
+    return( applied );
+}
@@ -0,0 +1,346 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_powergovernor.cpp                                       */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_powergovernor.cpp
+  * @brief   Battery aware motor current governor class
+*//*---------------------------------------------------------------------------*/
+
+#define MAX_MOTOR_CURRENT     2.5       // A, per motor
+#define DEFAULT_BUDGET        20.0      // A, all motors together
+#define DEFAULT_BROWNOUT      10.5      // V
+#define DEFAULT_HEADROOM      0.5       // A per motor
+#define DEFAULT_RESISTANCE    0.1       // ohms, battery plus wiring
+#define MIN_RESISTANCE        0.01
+#define MAX_RESISTANCE        0.5
+#define BATTERY_FILTER_GAIN   0.02      // about one second at 20mS
+#define MIN_CURRENT_VARIANCE  0.25      // A^2, below this R is not observable
+#define SAG_CUT               0.8       // budget scale after a measured sag
+#define SAG_RECOVERY          0.01      // per tick
+#define MIN_SAG_SCALE         0.3
+#define LIMIT_DEADBAND        50        // mA, do not resend smaller changes
+
+using namespace vex;
+
+power_governor::power_governor() {
+    _init();
+}
+
+power_governor::~power_governor() {
+    stop();
+}
+
+void
+power_governor::_init() {
+    memset( _groups, 0, sizeof(_groups) );
+    _count           = 0;
+    _budget          = DEFAULT_BUDGET;
+    _available       = DEFAULT_BUDGET;
+    _brownoutVoltage = DEFAULT_BROWNOUT;
+    _headroom        = DEFAULT_HEADROOM;
+    _thermal         = NULL;
+
+    _meanV = _meanI = _varI = _covVI = 0;
+    _resistance      = DEFAULT_RESISTANCE;
+    _openCircuit     = 0;
+    _voltage         = 0;
+    _current         = 0;
+    _sagScale        = 1.0;
+    _primed          = false;
+
+    _task            = NULL;
+    _running         = false;
+    _period          = 20;
+}
+
+int32_t
+power_governor::_newGroup( int32_t priority ) {
+    if( _count >= MAX_GROUPS )
+      return( -1 );
+
+    group *g = &_groups[ _count ];
+    memset( g, 0, sizeof(group) );
+    g->priority = priority;
+    return( _count++ );
+}
+
+void
+power_governor::_addMotor( int32_t g ) {
+}
+
+void
+power_governor::_addMotor( int32_t g, vex::motor &m ) {
+    group *p = &_groups[g];
+    if( p->count >= MAX_MOTORS )
+      return;
+
+    p->devices[ p->count ] = vexDeviceGetByIndex( m.index() );
+    p->ports[ p->count ]   = m.index();
+    p->limits[ p->count ]  = -1;
+    p->count++;
+    p->maximum = p->count * MAX_MOTOR_CURRENT;
+}
+
+void
+power_governor::setGroupLimits( int32_t g, double minimum, double maximum ) {
+    if( g < 0 || g >= _count )
+      return;
+
+    group *p = &_groups[g];
+    double top = p->count * MAX_MOTOR_CURRENT;
+    p->maximum = (maximum > top) ? top : fabs( maximum );
+    p->minimum = (fabs( minimum ) > p->maximum) ? p->maximum : fabs( minimum );
+}
+
+void
+power_governor::setBudget( double value, currentUnits units ) {
+    _budget = fabs( value );
+}
+
+void
+power_governor::setBrownoutVoltage( double value, voltageUnits units ) {
+    _brownoutVoltage = fabs( (units == voltageUnits::mV) ? value / 1000.0 : value );
+}
+
+void
+power_governor::setHeadroom( double value ) {
+    _headroom = fabs( value );
+}
+
+void
+power_governor::setThermalModel( thermal_model &model ) {
+    _thermal = &model;
+    _thermal->setDerate( false );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Battery model                                                    */
+/*---------------------------------------------------------------------------*/
+//
+// V = Voc - R * I, fitted with exponentially weighted means so the estimate
+// follows the battery as it discharges and warms up.  R is only updated when
+// the current has varied enough to make the slope meaningful.
+//
+void
+power_governor::_battery() {
+    _voltage = vexBatteryVoltageGet() / 1000.0;
+    _current = vexBatteryCurrentGet() / 1000.0;
+
+    if( !_primed ) {
+      _meanV  = _voltage;
+      _meanI  = _current;
+      _varI   = 0;
+      _covVI  = 0;
+      _primed = true;
+    }
+    else {
+      double a  = BATTERY_FILTER_GAIN;
+      double dv = _voltage - _meanV;
+      double di = _current - _meanI;
+      _meanV += a * dv;
+      _meanI += a * di;
+      _varI   = (1 - a) * ( _varI  + a * di * di );
+      _covVI  = (1 - a) * ( _covVI + a * di * dv );
+    }
+
+    if( _varI > MIN_CURRENT_VARIANCE ) {
+      double r = -_covVI / _varI;
+      if( r > MIN_RESISTANCE && r < MAX_RESISTANCE )
+        _resistance = r;
+    }
+    _openCircuit = _meanV + _resistance * _meanI;
+
+    // the model lags, a real sag cuts the budget straight away
+    if( _voltage < _brownoutVoltage )
+      _sagScale = (_sagScale * SAG_CUT < MIN_SAG_SCALE) ? MIN_SAG_SCALE : _sagScale * SAG_CUT;
+    else
+      _sagScale = (_sagScale + SAG_RECOVERY > 1.0) ? 1.0 : _sagScale + SAG_RECOVERY;
+
+    double limit = ( _openCircuit - _brownoutVoltage ) / _resistance;
+    if( limit < 0 )
+      limit = 0;
+
+    _available = ( (limit < _budget) ? limit : _budget ) * _sagScale;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Allocation                                                       */
+/*---------------------------------------------------------------------------*/
+//
+// Three passes in priority order, minimums first, then what each group is
+// drawing plus headroom so it can accelerate, then anything left goes to the
+// highest priority groups up to their ceiling.  An idle high priority group
+// therefore keeps most of the budget in reserve, while a busy low priority
+// group still grows by its headroom every tick.  The ceiling is the group
+// maximum, reduced to the sum of its motors' thermal limits when a model is
+// attached.
+//
+void
+power_governor::_allocate() {
+    int32_t order[MAX_GROUPS];
+
+    for( int i=0;i<_count;i++ ) {
+      int j = i;
+      while( j > 0 && _groups[ order[j-1] ].priority < _groups[i].priority ) {
+        order[j] = order[j-1];
+        j--;
+      }
+      order[j] = i;
+    }
+
+    double remaining = _available;
+
+    for( int i=0;i<_count;i++ ) {
+      group *g = &_groups[ order[i] ];
+
+      g->demand = 0;
+      g->ceiling = 0;
+      for( int k=0;k<g->count;k++ ) {
+        g->demand  += vexDeviceMotorCurrentGet( g->devices[k] ) / 1000.0;
+        g->ceiling += (_thermal != NULL) ? _thermal->limit( g->ports[k] ) : MAX_MOTOR_CURRENT;
+      }
+      if( g->ceiling > g->maximum )
+        g->ceiling = g->maximum;
+
+      g->allocation = (g->minimum < remaining) ? g->minimum : remaining;
+      remaining -= g->allocation;
+    }
+
+    for( int i=0;i<_count;i++ ) {
+      group *g = &_groups[ order[i] ];
+      double request = g->demand + _headroom * g->count;
+      if( request > g->ceiling )
+        request = g->ceiling;
+
+      double extra = request - g->allocation;
+      if( extra <= 0 )
+        continue;
+      if( extra > remaining )
+        extra = remaining;
+      g->allocation += extra;
+      remaining     -= extra;
+    }
+
+    for( int i=0;i<_count && remaining > 0;i++ ) {
+      group *g = &_groups[ order[i] ];
+      double extra = g->ceiling - g->allocation;
+      if( extra <= 0 )
+        continue;
+      if( extra > remaining )
+        extra = remaining;
+      g->allocation += extra;
+      remaining     -= extra;
+    }
+}
+
+void
+power_governor::_apply() {
+    for( int i=0;i<_count;i++ ) {
+      group *g = &_groups[i];
+      if( g->count == 0 )
+        continue;
+
+      int32_t share = (int32_t)( g->allocation * 1000.0 / g->count );
+      for( int k=0;k<g->count;k++ ) {
+        int32_t ma = share;
+        if( _thermal != NULL ) {
+          int32_t hot = (int32_t)( _thermal->limit( g->ports[k] ) * 1000.0 );
+          if( hot < ma )
+            ma = hot;
+        }
+        if( g->limits[k] >= 0 && abs( g->limits[k] - ma ) < LIMIT_DEADBAND )
+          continue;
+        vexDeviceMotorCurrentLimitSet( g->devices[k], ma );
+        g->limits[k] = ma;
+      }
+    }
+}
+
+void
+power_governor::update() {
+    _battery();
+    _allocate();
+    _apply();
+}
+
+int
+power_governor::_run( void *arg ) {
+    power_governor *p = (power_governor *)arg;
+
+    while( p->_running ) {
+      p->update();
+      vex::task::sleep( p->_period );
+    }
+    return( 0 );
+}
+
+void
+power_governor::start( uint32_t period ) {
+    _period = (period < 5) ? 5 : period;
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this );
+}
+
+void
+power_governor::stop() {
+    if( _task == NULL )
+      return;
+
+    _running = false;
+    _task->stop();
+    delete _task;
+    _task = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Accessors                                                        */
+/*---------------------------------------------------------------------------*/
+
+double
+power_governor::allocation( int32_t g ) {
+    if( g < 0 || g >= _count )
+      return( 0 );
+    return( _groups[g].allocation );
+}
+
+double
+power_governor::available() {
+    return( _available );
+}
+
+double
+power_governor::resistance() {
+    return( _resistance );
+}
+
+double
+power_governor::openCircuitVoltage() {
+    return( _openCircuit );
+}
+
+double
+power_governor::predictedVoltage( double current ) {
+    return( _openCircuit - _resistance * current );
+}
+
+bool
+power_governor::brownoutPredicted() {
+    double total = 0;
+    for( int i=0;i<_count;i++ )
+      total += _groups[i].maximum;
+
+    if( total > _budget )
+      total = _budget;
+    return( _primed && predictedVoltage( total ) < _brownoutVoltage );
+}
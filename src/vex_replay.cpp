@@ -0,0 +1,237 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_replay.cpp                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+#include "vex_interpose.h"
+#include "vex_replay.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_replay.cpp
+  * @brief   Record and replay of firmware inputs, brain side
+*//*---------------------------------------------------------------------------*/
+
+#define FLUSH_PERIOD      20
+
+#define X( id, offset, fn, arity )    + 1
+static const uint32_t FUNCTIONS = 0 VEX_REPLAY_FUNCTIONS( X );
+#undef  X
+
+using namespace vex;
+
+volatile replay::modeType replay::_mode = replay::modeType::idle;
+uint32_t              replay::_last[ replay::LAST_SIZE ];
+uint8_t               replay::_buffer[2][ replay::BUFFER_SIZE ];
+int32_t               replay::_current      = 0;
+int32_t               replay::_length       = 0;
+int32_t               replay::_position     = 0;
+volatile int32_t      replay::_pending[2]   = { 0, 0 };
+volatile bool         replay::_writing      = false;
+uint32_t              replay::_calls        = 0;
+uint32_t              replay::_stalls       = 0;
+int32_t               replay::_diverged     = -1;
+uint8_t              *replay::_deviceBase   = NULL;
+int32_t               replay::_deviceStride = 0;
+vex::task            *replay::_task         = NULL;
+FIL                  *replay::_file         = NULL;
+
+void
+replay::_reset() {
+    memset( _last, 0, sizeof(_last) );
+    _current     = 0;
+    _length      = 0;
+    _position    = 0;
+    _pending[0]  = 0;
+    _pending[1]  = 0;
+    _writing     = false;
+    _calls       = 0;
+    _stalls      = 0;
+    _diverged    = -1;
+
+    // device handles are evenly spaced, the port is recovered from the address
+    _deviceBase   = (uint8_t *)vexDeviceGetByIndex( 0 );
+    _deviceStride = (int32_t)( (uint8_t *)vexDeviceGetByIndex( 1 ) - _deviceBase );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Jumptable                                                        */
+/*---------------------------------------------------------------------------*/
+
+void *
+replay::_exchange( uint32_t offset, void *fn ) {
+    return( interpose::exchange( offset, fn ) );
+}
+
+void
+replay::_installAll( bool play ) {
+#define X( id, offset, fn, arity )    _install<id>( offset, &fn, play );
+    VEX_REPLAY_FUNCTIONS( X )
+#undef  X
+}
+
+void
+replay::_removeAll() {
+#define X( id, offset, fn, arity )    _remove<id>( offset, &fn );
+    VEX_REPLAY_FUNCTIONS( X )
+#undef  X
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Stream                                                           */
+/*---------------------------------------------------------------------------*/
+
+void
+replay::_flush( int32_t index ) {
+    _writing = true;
+    vexFileWrite( (char *)_buffer[index], 1, _pending[index], _file );
+    vexFileSync( _file );
+    _pending[index] = 0;
+    _writing = false;
+}
+
+//
+// Called from a wrapper when the current buffer is full.  Normally the
+// other buffer was written by the flush task long ago, if not the SD card
+// has fallen behind and the caller has to wait.
+//
+void
+replay::_swap() {
+    int32_t next = _current ^ 1;
+
+    if( _pending[next] > 0 ) {
+      _stalls++;
+      if( !_writing )
+        _flush( next );
+      while( _pending[next] > 0 )
+        vex::task::yield();
+    }
+
+    _pending[_current] = _length;
+    _current = next;
+    _length  = 0;
+}
+
+bool
+replay::_refill() {
+    int32_t n = ( _file != NULL ) ? vexFileRead( (char *)_buffer[0], 1, BUFFER_SIZE, _file ) : 0;
+
+    _position = 0;
+    _length   = ( n > 0 ) ? n : 0;
+    return( _length > 0 );
+}
+
+int
+replay::_run( void *arg ) {
+    while( true ) {
+      for( int b=0;b<2;b++ ) {
+        if( _pending[b] > 0 && !_writing )
+          _flush( b );
+      }
+      vex::task::sleep( FLUSH_PERIOD );
+    }
+    return( 0 );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Control                                                          */
+/*---------------------------------------------------------------------------*/
+
+bool
+replay::record( const char *name ) {
+    if( _mode != modeType::idle )
+      return( false );
+
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    h.magic     = MAGIC;
+    h.version   = VERSION;
+    h.functions = FUNCTIONS;
+    h.time      = vexSystemTimeGet();
+    vexFileWrite( (char *)&h, sizeof(header), 1, fp );
+
+    _reset();
+    _file = fp;
+    _installAll( false );
+    _mode = modeType::recording;
+    _task = new vex::task( _run, NULL );
+    return( true );
+}
+
+bool
+replay::play( const char *name ) {
+    if( _mode != modeType::idle )
+      return( false );
+
+    FIL *fp = vexFileOpen( name, "r" );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    if( vexFileRead( (char *)&h, sizeof(header), 1, fp ) != 1 ||
+        h.magic != MAGIC || h.version != VERSION || h.functions > FUNCTIONS ) {
+      vexFileClose( fp );
+      return( false );
+    }
+
+    _reset();
+    _file = fp;
+    _installAll( true );
+    _mode = modeType::playing;
+    return( true );
+}
+
+void
+replay::stop() {
+    modeType was = _mode;
+    if( was == modeType::idle )
+      return;
+
+    _mode = modeType::idle;
+    _removeAll();
+
+    if( was == modeType::recording ) {
+      if( _task != NULL ) {
+        _task->stop();
+        delete _task;
+        _task = NULL;
+      }
+
+      // at most one buffer is waiting and it is older than the current one
+      _writing = false;
+      if( _pending[_current ^ 1] > 0 )
+        _flush( _current ^ 1 );
+      _pending[_current] = _length;
+      if( _length > 0 )
+        _flush( _current );
+    }
+
+    vexFileClose( _file );
+    _file = NULL;
+}
+
+replay::modeType
+replay::mode() {
+    return( _mode );
+}
+
+uint32_t
+replay::calls() {
+    return( _calls );
+}
+
+uint32_t
+replay::stalls() {
+    return( _stalls );
+}
+
+int32_t
+replay::diverged() {
+    return( _diverged );
+}
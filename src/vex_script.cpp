@@ -0,0 +1,468 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_script.cpp                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_script.cpp
+  * @brief   Bytecode interpreter for autonomous routines
+*//*---------------------------------------------------------------------------*/
+
+#define POLL_TIME         10        // mS between checks while waiting
+
+using namespace vex;
+
+script::script() {
+    _size     = 0;
+    _signals  = 0;
+    _abort    = false;
+    _status   = statusType::empty;
+    _position = 0;
+    _steps    = 0;
+    memset( _drives, 0, sizeof(_drives) );
+    memset( _smart,  0, sizeof(_smart) );
+    memset( _groups, 0, sizeof(_groups) );
+    memset( _events, 0, sizeof(_events) );
+}
+
+script::~script() {
+    stop();
+}
+
+void
+script::attach( int32_t index, drivetrain &d ) {
+    if( index >= 0 && index < MAX_DRIVES ) {
+      _drives[index] = &d;
+      _smart[index]  = NULL;
+    }
+}
+
+void
+script::attach( int32_t index, smartdrive &d ) {
+    if( index >= 0 && index < MAX_DRIVES ) {
+      _drives[index] = &d;
+      _smart[index]  = &d;
+    }
+}
+
+void
+script::attach( int32_t index, motor_group &g ) {
+    if( index >= 0 && index < MAX_GROUPS )
+      _groups[index] = &g;
+}
+
+void
+script::attach( int32_t signal, event &e ) {
+    if( signal >= 0 && signal < MAX_SIGNALS )
+      _events[signal] = &e;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Loading                                                          */
+/*---------------------------------------------------------------------------*/
+
+#define X( id, name, format )   format,
+static const char * const _formats[] = { VEX_SCRIPT_OPCODES( X ) };
+#undef  X
+
+static int32_t
+operandSize( char c ) {
+    return( ( c == 'f' ) ? 4 : ( c == 'c' || c == 'o' ) ? 2 : 1 );
+}
+
+//
+// Walks the code once so run() can trust it.  Every opcode is known and
+// its operands fit, indexes are in range, repeat and next pair up and
+// the last instruction is end, so the program counter can never leave
+// the code.
+//
+bool
+script::_check() {
+    int32_t  starts[MAX_DEPTH];
+    int32_t  depth = 0;
+    int32_t  pc    = 0;
+    uint8_t  op    = (uint8_t)opcode::end;
+
+    while( pc < _size ) {
+      _position = pc;
+      op = _code[pc++];
+      if( op >= (uint8_t)opcode::count )
+        return( false );
+
+      const char *format = _formats[op];
+      int32_t     length = 0;
+      for( const char *f=format;*f;f++ )
+        length += operandSize( *f );
+      if( pc + length > _size )
+        return( false );
+
+      const uint8_t *operands = &_code[pc];
+      pc += length;
+
+      bool group = op >= (uint8_t)opcode::groupVelocity && op <= (uint8_t)opcode::groupWait;
+      if( format[0] == 'd' && operands[0] >= ( group ? MAX_GROUPS : MAX_DRIVES ) )
+        return( false );
+      if( ( op == (uint8_t)opcode::signal || op == (uint8_t)opcode::await ) && operands[0] >= MAX_SIGNALS )
+        return( false );
+
+      if( op == (uint8_t)opcode::repeat ) {
+        uint16_t count;
+        memcpy( &count, operands, 2 );
+        if( count == 0 || depth >= MAX_DEPTH )
+          return( false );
+        starts[depth++] = pc;
+      }
+      else if( op == (uint8_t)opcode::next ) {
+        int16_t offset;
+        memcpy( &offset, operands, 2 );
+        if( depth == 0 || pc + offset != starts[--depth] )
+          return( false );
+      }
+    }
+
+    _position = 0;
+    return( depth == 0 && _size > 0 && op == (uint8_t)opcode::end );
+}
+
+bool
+script::load( const uint8_t *data, int32_t size ) {
+    header h;
+
+    _size = 0;
+    _status = statusType::badFile;
+    if( size < (int32_t)sizeof(header) )
+      return( false );
+
+    memcpy( &h, data, sizeof(header) );
+    if( h.magic != MAGIC || h.version != VERSION || h.size > MAX_CODE || (int32_t)( sizeof(header) + h.size ) > size )
+      return( false );
+
+    memcpy( _code, data + sizeof(header), h.size );
+    _size = h.size;
+
+    if( !_check() ) {
+      _status = statusType::badCode;
+      return( false );
+    }
+    _status = statusType::ready;
+    return( true );
+}
+
+bool
+script::load( const char *name ) {
+    _size = 0;
+    _status = statusType::badFile;
+
+    FIL *fp = vexFileOpen( name, "r" );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    bool ok = vexFileRead( (char *)&h, sizeof(header), 1, fp ) == 1 &&
+              h.magic == MAGIC && h.version == VERSION && h.size <= MAX_CODE &&
+              vexFileRead( (char *)_code, 1, h.size, fp ) == (int32_t)h.size;
+    vexFileClose( fp );
+    if( !ok )
+      return( false );
+
+    _size = h.size;
+    if( !_check() ) {
+      _status = statusType::badCode;
+      return( false );
+    }
+    _status = statusType::ready;
+    return( true );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Interpreter                                                      */
+/*---------------------------------------------------------------------------*/
+
+bool
+script::_sleep( uint32_t ms ) {
+    uint32_t end = vexSystemTimeGet() + ms;
+    while( !_abort ) {
+      int32_t left = (int32_t)( end - vexSystemTimeGet() );
+      if( left <= 0 )
+        return( true );
+      vex::task::sleep( ( left < POLL_TIME ) ? left : POLL_TIME );
+    }
+    return( false );
+}
+
+bool
+script::_until( bool (* done)( void * ), void *arg ) {
+    while( !done( arg ) ) {
+      if( !_sleep( POLL_TIME ) )
+        return( false );
+    }
+    return( true );
+}
+
+static bool
+driveDone( void *arg ) {
+    return( ( (drivetrain *)arg )->isDone() );
+}
+
+static bool
+groupDone( void *arg ) {
+    return( ( (motor_group *)arg )->isDone() );
+}
+
+static inline float
+operandFloat( const uint8_t *&pc ) {
+    float f;
+    memcpy( &f, pc, sizeof(f) );
+    pc += sizeof(f);
+    return( f );
+}
+
+static inline int32_t
+operandShort( const uint8_t *&pc ) {
+    int16_t s;
+    memcpy( &s, pc, sizeof(s) );
+    pc += sizeof(s);
+    return( s );
+}
+
+//
+// Motion instructions never block inside the vex classes, a waiting
+// instruction polls isDone() so stop() takes effect within POLL_TIME.
+//
+script::statusType
+script::run() {
+    if( _status == statusType::empty || _status == statusType::badFile ||
+        _status == statusType::badCode || _status == statusType::running )
+      return( _status );
+
+    #define X( id, name, format )   &&op_##name,
+    static void * const dispatch[] = { VEX_SCRIPT_OPCODES( X ) };
+    #undef  X
+
+    uint16_t       counts[MAX_DEPTH];
+    int32_t        depth = 0;
+    const uint8_t *pc    = _code;
+    const uint8_t *op    = pc;
+    drivetrain    *d;
+    motor_group   *g;
+    uint8_t        index;
+    float          value;
+    uint8_t        units;
+    bool           wait;
+
+    _abort   = false;
+    _status  = statusType::running;
+    _steps   = 0;
+
+    #define DISPATCH()                                      \
+      do {                                                  \
+        if( _abort )                                        \
+          goto stopped;                                     \
+        op = pc;                                            \
+        _steps++;                                           \
+        goto *dispatch[ *pc++ ];                            \
+      } while( 0 )
+    #define DRIVE()                                         \
+      index = *pc++;                                        \
+      if( ( d = _drives[index] ) == NULL )                  \
+        goto missing
+    #define GROUP()                                         \
+      index = *pc++;                                        \
+      if( ( g = _groups[index] ) == NULL )                  \
+        goto missing
+    #define WAIT( test, arg )                               \
+      if( wait && !_until( test, arg ) )                    \
+        goto stopped
+
+    DISPATCH();
+
+  op_end:
+    _position = (int32_t)( op - _code );
+    _status   = statusType::done;
+    return( _status );
+
+  op_wait:
+    if( !_sleep( (uint32_t)operandFloat( pc ) ) )
+      goto stopped;
+    DISPATCH();
+
+  op_driveVelocity:
+    DRIVE();
+    value = operandFloat( pc );
+    d->setDriveVelocity( value, (velocityUnits)*pc++ );
+    DISPATCH();
+
+  op_turnVelocity:
+    DRIVE();
+    value = operandFloat( pc );
+    d->setTurnVelocity( value, (velocityUnits)*pc++ );
+    DISPATCH();
+
+  op_driveFor:
+    DRIVE();
+    value = operandFloat( pc );
+    units = *pc++;
+    wait  = *pc++;
+    d->driveFor( value, (distanceUnits)units, false );
+    WAIT( driveDone, d );
+    DISPATCH();
+
+  op_turnFor:
+    DRIVE();
+    value = operandFloat( pc );
+    units = *pc++;
+    wait  = *pc++;
+    d->turnFor( value, (rotationUnits)units, false );
+    WAIT( driveDone, d );
+    DISPATCH();
+
+  op_turnToHeading:
+    DRIVE();
+    if( _smart[index] == NULL )
+      goto missing;
+    value = operandFloat( pc );
+    units = *pc++;
+    wait  = *pc++;
+    _smart[index]->turnToHeading( value, (rotationUnits)units, false );
+    WAIT( driveDone, d );
+    DISPATCH();
+
+  op_driveStop:
+    DRIVE();
+    d->stop( (brakeType)*pc++ );
+    DISPATCH();
+
+  op_driveWait:
+    DRIVE();
+    wait = true;
+    WAIT( driveDone, d );
+    DISPATCH();
+
+  op_groupVelocity:
+    GROUP();
+    value = operandFloat( pc );
+    g->setVelocity( value, (velocityUnits)*pc++ );
+    DISPATCH();
+
+  op_spinFor:
+    GROUP();
+    value = operandFloat( pc );
+    units = *pc++;
+    wait  = *pc++;
+    g->spinFor( value, (rotationUnits)units, false );
+    WAIT( groupDone, g );
+    DISPATCH();
+
+  op_spinForTime:
+    // spin and time it here, motor_group::spinFor would block until the end
+    GROUP();
+    value = operandFloat( pc );
+    units = *pc++;
+    g->spin( directionType::fwd );
+    if( !_sleep( (uint32_t)( ( (timeUnits)units == timeUnits::sec ) ? value * 1000 : value ) ) )
+      goto stopped;
+    g->stop();
+    DISPATCH();
+
+  op_spinToPosition:
+    GROUP();
+    value = operandFloat( pc );
+    units = *pc++;
+    wait  = *pc++;
+    g->spinToPosition( value, (rotationUnits)units, false );
+    WAIT( groupDone, g );
+    DISPATCH();
+
+  op_groupStop:
+    GROUP();
+    g->stop( (brakeType)*pc++ );
+    DISPATCH();
+
+  op_groupWait:
+    GROUP();
+    wait = true;
+    WAIT( groupDone, g );
+    DISPATCH();
+
+  op_signal:
+    index = *pc++;
+    if( _events[index] != NULL )
+      _events[index]->broadcast();
+    DISPATCH();
+
+  op_await:
+    {
+      index = *pc++;
+      value = operandFloat( pc );
+      uint32_t bit   = 1u << index;
+      uint32_t start = vexSystemTimeGet();
+      while( ( _signals & bit ) == 0 ) {
+        if( value > 0 && vexSystemTimeGet() - start >= (uint32_t)value )
+          break;
+        if( !_sleep( 1 ) )
+          goto stopped;
+      }
+      _signals &= ~bit;
+    }
+    DISPATCH();
+
+  op_repeat:
+    counts[depth++] = (uint16_t)operandShort( pc );
+    DISPATCH();
+
+  op_next:
+    {
+      int32_t offset = operandShort( pc );
+      if( --counts[depth-1] > 0 )
+        pc += offset;
+      else
+        depth--;
+    }
+    DISPATCH();
+
+  missing:
+    _position = (int32_t)( op - _code );
+    _status   = statusType::noDevice;
+    return( _status );
+
+  stopped:
+    _position = (int32_t)( op - _code );
+    _status   = statusType::stopped;
+    return( _status );
+
+    #undef  DISPATCH
+    #undef  DRIVE
+    #undef  GROUP
+    #undef  WAIT
+}
+
+void
+script::stop() {
+    _abort = true;
+}
+
+void
+script::signal( int32_t signal ) {
+    if( signal >= 0 && signal < MAX_SIGNALS )
+      _signals |= 1u << signal;
+}
+
+script::statusType
+script::status() {
+    return( _status );
+}
+
+int32_t
+script::position() {
+    return( _position );
+}
+
+uint32_t
+script::steps() {
+    return( _steps );
+}
@@ -0,0 +1,138 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_startuptrace.cpp                                        */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_startuptrace.cpp
+  * @brief   Startup time profiler class
+*//*---------------------------------------------------------------------------*/
+
+using namespace vex;
+
+startup_trace::entry  startup_trace::_entries[ startup_trace::MAX_ENTRIES ];
+int32_t               startup_trace::_count     = 0;
+uint32_t              startup_trace::_dropped   = 0;
+uint64_t              startup_trace::_start     = 0;
+uint32_t              startup_trace::_firstTick = 0;
+
+// constructed before any other global so the trace covers all of them
+namespace {
+  class startup_trace_begin {
+    public:
+      startup_trace_begin() { startup_trace::begin(); };
+  };
+  startup_trace_begin   _begin __attribute__ ((init_priority (101)));
+};
+
+void
+startup_trace::begin() {
+    _count     = 0;
+    _dropped   = 0;
+    _firstTick = 0;
+    _start     = vexSystemHighResTimeGet();
+    mark( "static init" );
+}
+
+void
+startup_trace::span( const char *label, uint64_t start ) {
+    uint64_t now = vexSystemHighResTimeGet();
+
+    if( _count >= MAX_ENTRIES ) {
+      _dropped++;
+      return;
+    }
+
+    entry *e = &_entries[ _count++ ];
+    e->label    = label;
+    e->time     = (uint32_t)( start - _start );
+    e->duration = (uint32_t)( now - start );
+}
+
+void
+startup_trace::mark( const char *label ) {
+    if( _count >= MAX_ENTRIES ) {
+      _dropped++;
+      return;
+    }
+
+    entry *e = &_entries[ _count++ ];
+    e->label    = label;
+    e->time     = (uint32_t)( vexSystemHighResTimeGet() - _start );
+    e->duration = 0;
+}
+
+void
+startup_trace::firstTick() {
+    if( _firstTick != 0 )
+      return;
+
+    mark( "first tick" );
+    _firstTick = (uint32_t)( vexSystemHighResTimeGet() - _start );
+    if( _firstTick == 0 )
+      _firstTick = 1;
+}
+
+uint32_t
+startup_trace::startupTime() {
+    return( _firstTick );
+}
+
+int32_t
+startup_trace::count() {
+    return( _count );
+}
+
+const startup_trace::entry *
+startup_trace::data( int32_t index ) {
+    if( index < 0 || index >= _count )
+      return( NULL );
+    return( &_entries[index] );
+}
+
+void
+startup_trace::print() {
+    vex_printf( "startup trace, %d entries", (int)_count );
+    if( _dropped )
+      vex_printf( ", %lu dropped", (unsigned long)_dropped );
+    vex_printf( "\n" );
+
+    uint32_t last = 0;
+    for( int i=0;i<_count;i++ ) {
+      const entry *e = &_entries[i];
+      vex_printf( "%10.3f ms  +%8.3f  %-20s", e->time / 1000.0, ( e->time - last ) / 1000.0, e->label );
+      if( e->duration )
+        vex_printf( "  took %.3f ms", e->duration / 1000.0 );
+      vex_printf( "\n" );
+      last = e->time;
+    }
+
+    if( _firstTick )
+      vex_printf( "start to first tick %.3f ms\n", _firstTick / 1000.0 );
+}
+
+bool
+startup_trace::save( const char *name ) {
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( false );
+
+    char line[96];
+    int  len;
+
+    len = vex_snprintf( line, sizeof(line), "label,time_us,duration_us\n" );
+    vexFileWrite( line, 1, len, fp );
+
+    for( int i=0;i<_count;i++ ) {
+      const entry *e = &_entries[i];
+      len = vex_snprintf( line, sizeof(line), "%s,%lu,%lu\n", e->label, (unsigned long)e->time, (unsigned long)e->duration );
+      vexFileWrite( line, 1, len, fp );
+    }
+
+    vexFileClose( fp );
+    return( true );
+}
@@ -0,0 +1,326 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_sysid.cpp                                               */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_sysid.cpp
+  * @brief   Feedforward characterization (system identification) class
+*//*---------------------------------------------------------------------------*/
+
+#define MAX_MOTOR_VOLTAGE     12000     // mV
+#define DEFAULT_CAPACITY      8192      // samples, about 190k of memory
+#define MIN_FIT_VELOCITY      1.0       // rpm, samples slower than this are in stiction
+
+using namespace vex;
+
+sysid::sysid() {
+    _init();
+}
+
+sysid::~sysid() {
+    if( _log != NULL )
+      delete [] _log;
+}
+
+void
+sysid::_init() {
+    _count         = 0;
+    _log           = NULL;
+    _capacity      = 0;
+    _length        = 0;
+    _runs          = 0;
+    _positionLimit = 0;
+
+    setCapacity( DEFAULT_CAPACITY );
+}
+
+void
+sysid::_addMotor() {
+}
+
+void
+sysid::_addMotor( vex::motor &m ) {
+    if( _count >= MAX_MOTORS )
+      return;
+
+    V5_DeviceT device = vexDeviceGetByIndex( m.index() );
+    vexDeviceMotorEncoderUnitsSet( device, kMotorEncoderDegrees );
+    _devices[ _count++ ] = device;
+}
+
+void
+sysid::setCapacity( int32_t samples ) {
+    if( _log != NULL )
+      delete [] _log;
+
+    _log      = (samples > 0) ? new sample[ samples ] : NULL;
+    _capacity = (_log != NULL) ? samples : 0;
+    _length   = 0;
+}
+
+void
+sysid::setPositionLimit( double value, rotationUnits units ) {
+    _positionLimit = fabs( (units == rotationUnits::rev) ? value * 360.0 : value );
+}
+
+void
+sysid::clear() {
+    _length = 0;
+    _runs   = 0;
+}
+
+const sysid::sample *
+sysid::data( int32_t index ) {
+    if( index < 0 || index >= _length )
+      return( NULL );
+    return( &_log[index] );
+}
+
+void
+sysid::_setVoltage( int32_t mv ) {
+    for( int i=0;i<_count;i++ )
+      vexDeviceMotorVoltageSet( _devices[i], mv );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Log a sample if the motors have reported new data               */
+/*---------------------------------------------------------------------------*/
+//
+// The task polls far faster than the motors update, a sample is only stored
+// when the device timestamp of the first motor changes so the log holds
+// every motor update exactly once.
+//
+bool
+sysid::_record( testType test, uint64_t start, int32_t mv, uint32_t *lastTimestamp ) {
+    uint32_t timestamp = (uint32_t)vexDeviceGetTimestamp( _devices[0] );
+
+    if( timestamp == *lastTimestamp )
+      return( true );
+    *lastTimestamp = timestamp;
+
+    if( _length >= _capacity )
+      return( false );
+
+    double  position = 0;
+    double  velocity = 0;
+    int32_t current  = 0;
+
+    for( int i=0;i<_count;i++ ) {
+      position += vexDeviceMotorPositionGet( _devices[i] );
+      velocity += vexDeviceMotorActualVelocityGet( _devices[i] );
+      current  += vexDeviceMotorCurrentGet( _devices[i] );
+    }
+
+    sample *s = &_log[ _length++ ];
+    s->time      = (uint32_t)( vexSystemHighResTimeGet() - start );
+    s->timestamp = timestamp;
+    s->voltage   = (int16_t)mv;
+    s->test      = (uint8_t)test;
+    s->run       = _runs;
+    s->position  = (float)( position / _count );
+    s->velocity  = (float)( velocity / _count );
+    s->current   = current;
+
+    return( true );
+}
+
+bool
+sysid::_run( testType test, double rate, double voltage, uint32_t timeout, directionType dir ) {
+    if( _count == 0 || _log == NULL )
+      return( false );
+
+    double   sign      = (dir == directionType::rev) ? -1.0 : 1.0;
+    int32_t  target    = (int32_t)( fmin( fabs( voltage ), MAX_MOTOR_VOLTAGE / 1000.0 ) * 1000.0 );
+    uint32_t last      = (uint32_t)vexDeviceGetTimestamp( _devices[0] );
+    double   origin    = vexDeviceMotorPositionGet( _devices[0] );
+    uint64_t start     = vexSystemHighResTimeGet();
+    bool     completed = true;
+
+    _runs++;
+    while( true ) {
+      uint32_t elapsed = (uint32_t)( ( vexSystemHighResTimeGet() - start ) / 1000 );
+      int32_t  mv;
+
+      if( test == testType::quasistatic ) {
+        mv = (int32_t)( rate * elapsed );
+        if( mv > target )
+          break;
+      }
+      else {
+        if( elapsed > timeout )
+          break;
+        mv = target;
+      }
+
+      mv = (int32_t)( mv * sign );
+      _setVoltage( mv );
+
+      if( !_record( test, start, mv, &last ) ) {
+        completed = false;
+        break;
+      }
+
+      if( _positionLimit > 0 && fabs( vexDeviceMotorPositionGet( _devices[0] ) - origin ) > _positionLimit ) {
+        completed = false;
+        break;
+      }
+
+      // poll well inside the motor update period
+      vex::task::sleep( 1 );
+    }
+
+    _setVoltage( 0 );
+    return( completed );
+}
+
+bool
+sysid::quasistatic( double rate, double maxVoltage, directionType dir ) {
+    if( rate <= 0 )
+      return( false );
+
+    // rate is V/s which is the same as mV/mS
+    return( _run( testType::quasistatic, rate, maxVoltage, 0, dir ) );
+}
+
+bool
+sysid::dynamic( double voltage, double time, timeUnits units, directionType dir ) {
+    uint32_t timeout = (uint32_t)( (units == timeUnits::sec) ? time * 1000.0 : time );
+
+    return( _run( testType::dynamic, 0, voltage, timeout, dir ) );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Ordinary least squares fit of V = kS*sgn(v) + kV*v + kA*a       */
+/*---------------------------------------------------------------------------*/
+//
+// Acceleration is the central difference of velocity using the device
+// timestamps, the normal equations are small enough to solve directly.
+//
+sysid::result
+sysid::fit() {
+    result r;
+    memset( &r, 0, sizeof(r) );
+    r.gearset = (_count > 0) ? vexDeviceMotorGearingGet( _devices[0] ) : kMotorGearSet_18;
+
+    double ata[3][3] = {{0}};
+    double atb[3]    = {0};
+    double sy = 0, syy = 0;
+    int32_t n = 0;
+
+    for( int i=1;i<_length-1;i++ ) {
+      const sample *p = &_log[i-1];
+      const sample *s = &_log[i];
+      const sample *q = &_log[i+1];
+
+      // do not difference across the boundary between two tests
+      if( p->run != s->run || q->run != s->run )
+        continue;
+      if( fabs( s->velocity ) < MIN_FIT_VELOCITY || s->voltage == 0 )
+        continue;
+
+      double dt = (double)(int32_t)( q->timestamp - p->timestamp ) / 1000.0;
+      if( dt <= 0 )
+        continue;
+
+      double x[3];
+      x[0] = (s->velocity > 0) ? 1.0 : -1.0;
+      x[1] = s->velocity;
+      x[2] = ( q->velocity - p->velocity ) / dt;
+      double y = s->voltage / 1000.0;
+
+      for( int j=0;j<3;j++ ) {
+        for( int k=0;k<3;k++ )
+          ata[j][k] += x[j] * x[k];
+        atb[j] += x[j] * y;
+      }
+      sy  += y;
+      syy += y * y;
+      n++;
+    }
+
+    if( n < 3 )
+      return( r );
+
+    // gaussian elimination with partial pivoting
+    double m[3][4];
+    for( int j=0;j<3;j++ ) {
+      for( int k=0;k<3;k++ )
+        m[j][k] = ata[j][k];
+      m[j][3] = atb[j];
+    }
+    for( int c=0;c<3;c++ ) {
+      int p = c;
+      for( int j=c+1;j<3;j++ )
+        if( fabs( m[j][c] ) > fabs( m[p][c] ) )
+          p = j;
+      if( fabs( m[p][c] ) < 1e-12 )
+        return( r );
+      for( int k=0;k<4;k++ ) {
+        double t = m[c][k]; m[c][k] = m[p][k]; m[p][k] = t;
+      }
+      for( int j=0;j<3;j++ ) {
+        if( j == c )
+          continue;
+        double f = m[j][c] / m[c][c];
+        for( int k=c;k<4;k++ )
+          m[j][k] -= f * m[c][k];
+      }
+    }
+
+    r.kS = m[0][3] / m[0][0];
+    r.kV = m[1][3] / m[1][1];
+    r.kA = m[2][3] / m[2][2];
+    r.samples = n;
+
+    // residual sum of squares from the normal equations
+    double beta[3] = { r.kS, r.kV, r.kA };
+    double sse = syy;
+    for( int j=0;j<3;j++ ) {
+      sse -= 2 * beta[j] * atb[j];
+      for( int k=0;k<3;k++ )
+        sse += beta[j] * beta[k] * ata[j][k];
+    }
+    double sst = syy - sy * sy / n;
+    r.r2 = (sst > 0) ? 1.0 - sse / sst : 0;
+
+    if( r.kV > 0 ) {
+      r.freeSpeed    = ( MAX_MOTOR_VOLTAGE / 1000.0 - r.kS ) / r.kV;
+      r.timeConstant = r.kA / r.kV;
+    }
+
+    return( r );
+}
+
+int32_t
+sysid::save( const char *name ) {
+    FIL *fp = vexFileOpenWrite( name );
+    if( fp == NULL )
+      return( -1 );
+
+    char line[128];
+    int  len;
+
+    len = vex_snprintf( line, sizeof(line), "# sysid motors=%d gearset=%d\n", (int)_count,
+                        (_count > 0) ? (int)vexDeviceMotorGearingGet( _devices[0] ) : -1 );
+    vexFileWrite( line, 1, len, fp );
+    len = vex_snprintf( line, sizeof(line), "time_us,timestamp_ms,test,run,voltage_mv,position_deg,velocity_rpm,current_ma\n" );
+    vexFileWrite( line, 1, len, fp );
+
+    for( int i=0;i<_length;i++ ) {
+      const sample *s = &_log[i];
+      len = vex_snprintf( line, sizeof(line), "%lu,%lu,%d,%d,%d,%.3f,%.3f,%ld\n",
+                          (unsigned long)s->time, (unsigned long)s->timestamp, (int)s->test, (int)s->run, (int)s->voltage,
+                          (double)s->position, (double)s->velocity, (long)s->current );
+      vexFileWrite( line, 1, len, fp );
+    }
+
+    vexFileClose( fp );
+    return( _length );
+}
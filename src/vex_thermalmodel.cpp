@@ -0,0 +1,359 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     vex_thermalmodel.cpp                                        */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+#include "v5_cpp.h"
+
+/*-----------------------------------------------------------------------------*/
+/** @file    vex_thermalmodel.cpp
+  * @brief   Motor thermal model and predictive derating class
+*//*---------------------------------------------------------------------------*/
+
+#define DEFAULT_GAIN          0.04f     // C/s per A^2, about 0.25 C/s at stall
+#define DEFAULT_LOSS          (1.0f / 300.0f)  // 1/s, five minute cool down
+#define MIN_GAIN              0.005f
+#define MAX_GAIN              0.2f
+#define MIN_LOSS              (1.0f / 3000.0f)
+#define MAX_LOSS              (1.0f / 30.0f)
+#define DEFAULT_HORIZON       45.0f     // s
+#define DEFAULT_START_TEMP    45.0f     // C
+#define DEFAULT_LIMIT_TEMP    55.0f     // C, firmware starts to throttle here
+#define DEFAULT_MIN_CURRENT   0.5f      // A
+#define MAX_MOTOR_CURRENT     2.5f      // A
+#define FIT_WINDOW            5000      // mS
+#define FIT_FORGET            0.95f     // per window, about 100 seconds memory
+#define PRIOR_WEIGHT_Q        25.0f     // one window at 1A^2
+#define PRIOR_WEIGHT_E        2500.0f   // one window at 10C above ambient
+#define HEAT_AVERAGE_TIME     5.0f      // s
+#define OBSERVER_TIME         20.0f     // s, temperature readings are coarse
+#define LIMIT_SLEW_TIME       2.0f      // s
+#define LIMIT_DEADBAND        50        // mA
+
+using namespace vex;
+
+thermal_model::thermal_model() {
+    _init();
+}
+
+thermal_model::~thermal_model() {
+    stop();
+}
+
+void
+thermal_model::_init() {
+    memset( _present,  0, sizeof(_present) );
+    memset( _measured, 0, sizeof(_measured) );
+    memset( _current2, 0, sizeof(_current2) );
+    memset( _model,    0, sizeof(_model) );
+    memset( _heat,     0, sizeof(_heat) );
+    memset( _predicted,0, sizeof(_predicted) );
+    memset( _windowQ,  0, sizeof(_windowQ) );
+    memset( _windowE,  0, sizeof(_windowE) );
+    memset( _windowT,  0, sizeof(_windowT) );
+    memset( _sQQ, 0, sizeof(_sQQ) );
+    memset( _sQE, 0, sizeof(_sQE) );
+    memset( _sEE, 0, sizeof(_sEE) );
+    memset( _sQY, 0, sizeof(_sQY) );
+    memset( _sEY, 0, sizeof(_sEY) );
+
+    for( int i=0;i<PORTS;i++ ) {
+      _devices[i] = vexDeviceGetByIndex( i );
+      _gain[i]    = DEFAULT_GAIN;
+      _loss[i]    = DEFAULT_LOSS;
+      _limit[i]   = MAX_MOTOR_CURRENT;
+      _sent[i]    = -1;
+    }
+
+    _ambient     = 0;
+    _ambientSet  = false;
+    _horizon     = DEFAULT_HORIZON;
+    _startTemp   = DEFAULT_START_TEMP;
+    _limitTemp   = DEFAULT_LIMIT_TEMP;
+    _minCurrent  = DEFAULT_MIN_CURRENT;
+    _maxCurrent  = MAX_MOTOR_CURRENT;
+    _derate      = true;
+    _window      = FIT_WINDOW;
+    _windowStart = 0;
+    _last        = 0;
+
+    _task        = NULL;
+    _running     = false;
+    _period      = 100;
+}
+
+void
+thermal_model::setHorizon( double time, timeUnits units ) {
+    _horizon = (float)fabs( (units == timeUnits::msec) ? time / 1000.0 : time );
+}
+
+void
+thermal_model::setThresholds( double start, double limit ) {
+    if( limit <= start )
+      return;
+    _startTemp = (float)start;
+    _limitTemp = (float)limit;
+}
+
+void
+thermal_model::setCurrentRange( double minimum, double maximum ) {
+    _maxCurrent = (float)( (maximum > MAX_MOTOR_CURRENT) ? MAX_MOTOR_CURRENT : fabs( maximum ) );
+    _minCurrent = (float)( (fabs( minimum ) > _maxCurrent) ? _maxCurrent : fabs( minimum ) );
+}
+
+void
+thermal_model::setAmbient( double value ) {
+    _ambient    = (float)value;
+    _ambientSet = true;
+}
+
+void
+thermal_model::setDerate( bool enable ) {
+    _derate = enable;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Gather, the only part that talks to the devices                 */
+/*---------------------------------------------------------------------------*/
+void
+thermal_model::_read() {
+    V5_DeviceTypeBuffer types;
+    vexDeviceGetStatus( types );
+
+    float coldest = 1000.0f;
+
+    for( int i=0;i<PORTS;i++ ) {
+      if( types[i] != kDeviceTypeMotorSensor ) {
+        _present[i]  = 0;
+        _measured[i] = 0;
+        _current2[i] = 0;
+        continue;
+      }
+
+      float t = (float)vexDeviceMotorTemperatureGet( _devices[i] );
+      float a = vexDeviceMotorCurrentGet( _devices[i] ) / 1000.0f;
+
+      // a motor that has just appeared starts from its reported temperature
+      if( _present[i] == 0 ) {
+        _model[i]   = t;
+        _windowT[i] = t;
+        _windowQ[i] = 0;
+        _windowE[i] = 0;
+        _heat[i]    = a * a;
+        _limit[i]   = _maxCurrent;
+        _sent[i]    = -1;
+      }
+
+      _present[i]  = 1;
+      _measured[i] = t;
+      _current2[i] = a * a;
+      if( t < coldest )
+        coldest = t;
+    }
+
+    if( !_ambientSet && coldest < 1000.0f ) {
+      _ambient    = coldest;
+      _ambientSet = true;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Model, prediction and derate for every port in one pass         */
+/*---------------------------------------------------------------------------*/
+//
+// No branches and no calls other than expf, so this is a straight pass over
+// contiguous floats.  Empty ports run the same arithmetic and are masked.
+//
+void
+thermal_model::_step( float dt ) {
+    const float amb   = _ambient;
+    const float avg   = fminf( dt / HEAT_AVERAGE_TIME, 1.0f );
+    const float obs   = fminf( dt / OBSERVER_TIME,     1.0f );
+    const float slew  = fminf( dt / LIMIT_SLEW_TIME,   1.0f );
+    const float range = _maxCurrent - _minCurrent;
+    const float band  = 1.0f / ( _limitTemp - _startTemp );
+    const float h     = _horizon;
+    const float top   = _limitTemp;
+    const float lo    = _minCurrent;
+
+    for( int i=0;i<PORTS;i++ ) {
+      float m = _present[i];
+
+      // Euler step of the model, then pull gently towards the coarse reading
+      float model = _model[i] + dt * ( _gain[i] * _current2[i] - _loss[i] * ( _model[i] - amb ) );
+      model += obs * ( _measured[i] - model );
+
+      float heat = _heat[i] + avg * ( _current2[i] - _heat[i] );
+
+      // closed form solution at the horizon with heat held constant
+      float steady = amb + _gain[i] * heat / _loss[i];
+      float pred   = steady + ( model - steady ) * expf( -_loss[i] * h );
+
+      float scale  = fminf( fmaxf( ( top - pred ) * band, 0.0f ), 1.0f );
+      float target = lo + range * scale;
+      float limit  = _limit[i] + slew * ( target - _limit[i] );
+
+      _model[i]     = model * m;
+      _heat[i]      = heat  * m;
+      _predicted[i] = pred  * m;
+      _limit[i]     = limit;
+      _windowQ[i]  += _current2[i] * dt * m;
+      _windowE[i]  += ( _measured[i] - amb ) * dt * m;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Refit gain and loss from the last window                        */
+/*---------------------------------------------------------------------------*/
+//
+// Over a window the model integrates to
+//
+//   T(end) - T(start) = gain * integral( I^2 ) - loss * integral( T - ambient )
+//
+// which is linear in gain and loss.  The sums are forgotten slowly and
+// regularized towards the default motor so a motor that never works hard
+// keeps sensible values.
+//
+void
+thermal_model::_fit() {
+    for( int i=0;i<PORTS;i++ ) {
+      float m = _present[i];
+      float y = ( _measured[i] - _windowT[i] ) * m;
+      float q = _windowQ[i];
+      float e = _windowE[i];
+
+      _sQQ[i] = FIT_FORGET * _sQQ[i] + q * q;
+      _sQE[i] = FIT_FORGET * _sQE[i] + q * e;
+      _sEE[i] = FIT_FORGET * _sEE[i] + e * e;
+      _sQY[i] = FIT_FORGET * _sQY[i] + q * y;
+      _sEY[i] = FIT_FORGET * _sEY[i] + e * y;
+
+      float a11 = _sQQ[i] + PRIOR_WEIGHT_Q;
+      float a12 = -_sQE[i];
+      float a22 = _sEE[i] + PRIOR_WEIGHT_E;
+      float b1  = _sQY[i] + PRIOR_WEIGHT_Q * DEFAULT_GAIN;
+      float b2  = -_sEY[i] + PRIOR_WEIGHT_E * DEFAULT_LOSS;
+      float det = a11 * a22 - a12 * a12;
+
+      float gain = ( b1 * a22 - a12 * b2 ) / det;
+      float loss = ( a11 * b2 - a12 * b1 ) / det;
+
+      _gain[i]    = fminf( fmaxf( gain, MIN_GAIN ), MAX_GAIN );
+      _loss[i]    = fminf( fmaxf( loss, MIN_LOSS ), MAX_LOSS );
+      _windowT[i] = _measured[i];
+      _windowQ[i] = 0;
+      _windowE[i] = 0;
+    }
+}
+
+void
+thermal_model::_apply() {
+    for( int i=0;i<PORTS;i++ ) {
+      if( _present[i] == 0 )
+        continue;
+
+      int32_t ma = (int32_t)( _limit[i] * 1000.0f );
+      if( _sent[i] >= 0 && abs( ma - _sent[i] ) < LIMIT_DEADBAND )
+        continue;
+      vexDeviceMotorCurrentLimitSet( _devices[i], ma );
+      _sent[i] = ma;
+    }
+}
+
+void
+thermal_model::update() {
+    uint64_t now = vexSystemHighResTimeGet();
+
+    _read();
+    if( _last == 0 ) {
+      _last        = now;
+      _windowStart = now;
+      return;
+    }
+
+    _step( (float)( now - _last ) / 1e6f );
+    _last = now;
+
+    if( now - _windowStart >= (uint64_t)_window * 1000 ) {
+      _fit();
+      _windowStart = now;
+    }
+
+    if( _derate )
+      _apply();
+}
+
+int
+thermal_model::_run( void *arg ) {
+    thermal_model *t = (thermal_model *)arg;
+
+    while( t->_running ) {
+      t->update();
+      vex::task::sleep( t->_period );
+    }
+    return( 0 );
+}
+
+void
+thermal_model::start( uint32_t period ) {
+    _period = (period < 10) ? 10 : period;
+    if( _task != NULL )
+      return;
+
+    _running = true;
+    _task = new vex::task( _run, (void *)this );
+}
+
+void
+thermal_model::stop() {
+    if( _task == NULL )
+      return;
+
+    _running = false;
+    _task->stop();
+    delete _task;
+    _task = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Accessors                                                        */
+/*---------------------------------------------------------------------------*/
+
+double
+thermal_model::temperature( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( 0 );
+    return( _measured[port] );
+}
+
+double
+thermal_model::predicted( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( 0 );
+    return( _predicted[port] );
+}
+
+double
+thermal_model::limit( int32_t port ) {
+    if( port < 0 || port >= PORTS || _present[port] == 0 )
+      return( _maxCurrent );
+    return( _limit[port] );
+}
+
+double
+thermal_model::timeConstant( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( 0 );
+    return( 1.0 / _loss[port] );
+}
+
+double
+thermal_model::steadyRise( int32_t port ) {
+    if( port < 0 || port >= PORTS )
+      return( 0 );
+    return( _gain[port] / _loss[port] );
+}
@@ -0,0 +1,1153 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     a32.h                                                       */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    a32.h
+  * @brief   ARMv7-A user mode interpreter with a decoded block cache
+*//*---------------------------------------------------------------------------*/
+//
+// Header only, used by v5emu.cpp.
+//
+// Runs the A32 instruction set of the Cortex-A9 in the brain, integer and
+// VFPv3, in user mode.  Guest memory is one flat region, any access outside
+// it is a fault.  Thumb and NEON are not decoded, V5 user programs and
+// libv5rt are built as A32 with softfp VFP.
+//
+// Code is decoded once into blocks of pre-extracted operations that end at
+// the first instruction that can write pc.  Blocks are found by address in
+// a hash table and each block remembers the last two blocks that followed
+// it, so a loop runs from block to block without a lookup.  A store to a
+// 64 byte line holding decoded code drops the whole cache at the end of
+// the block.
+//
+// run() returns when pc leaves guest memory, the embedder maps its traps
+// there, or when the instruction budget is spent.
+//
+
+#ifndef   A32_H
+#define   A32_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/mman.h>
+
+namespace a32 {
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Register state, swapped whole to switch tasks                    */
+/*---------------------------------------------------------------------------*/
+
+struct state {
+    uint32_t      r[16];                // r15 is pc between runs
+    uint32_t      n, z, c, v;           // condition flags, 0 or 1
+    uint32_t      fpscr;
+    union {
+      float       s[64];
+      double      d[32];
+      uint32_t    w[64];
+      uint64_t    x[32];
+    } f;
+};
+
+struct fault {
+    uint32_t      pc;
+    uint32_t      address;
+    const char   *what;
+};
+
+class core;
+
+struct op {
+    void        (*fn)( core &, const op & );
+    void        (*inner)( core &, const op & );   // called by fn when it sets pc
+    uint32_t      addr;                 // guest address of the instruction
+    uint32_t      imm;                  // immediate, offset or raw word
+    uint8_t       cond;
+    uint8_t       rd, rn, rm, rs;
+    uint8_t       kind;                 // shift type or sub operation
+    uint8_t       amount;               // shift amount or size
+    uint8_t       bits;                 // P U W S style flags
+    uint16_t      list;                 // register list
+    bool          ends;                 // may write pc
+};
+
+struct block {
+    uint32_t      start;
+    uint32_t      end;                  // first address after the block
+    uint32_t      count;
+    std::vector<op> ops;
+    block        *chain[2] = { nullptr, nullptr };
+    uint8_t       next = 0;             // chain slot to replace
+};
+
+enum { P = 1, U = 2, W = 4, S = 8 };
+enum { LSL, LSR, ASR, ROR };
+
+/*---------------------------------------------------------------------------*/
+/** @brief  The interpreter                                                  */
+/*---------------------------------------------------------------------------*/
+
+class core {
+  public:
+    state         s;
+    uint8_t      *mem;
+    uint32_t      base;
+    uint32_t      size;
+
+    // statistics
+    uint64_t      instructions = 0;
+    uint64_t      blocks       = 0;     // decoded
+    uint64_t      lookups      = 0;     // hash table
+    uint64_t      chained      = 0;     // followed a chain pointer
+    uint64_t      flushes      = 0;
+
+    uint32_t      npc;                  // pc after the current block
+    bool          flushPending = false;
+
+  private:
+    std::unordered_map<uint32_t, std::unique_ptr<block>> _cache;
+    std::vector<uint8_t>  _code;        // lines holding decoded code
+    static const uint32_t LINE = 6;              // 64 byte lines
+    static const uint32_t MAX_BLOCK = 64;
+
+  public:
+    core( uint32_t base, uint32_t size ) : base( base ), size( size ) {
+      memset( &s, 0, sizeof(s) );
+      void *p = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+      mem = p == MAP_FAILED ? nullptr : (uint8_t *)p;
+      _code.assign( ( size >> LINE ) + 1, 0 );
+    }
+    core( const core & ) = delete;
+    ~core() {
+      if( mem != nullptr )
+        munmap( mem, size );
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* memory                                                                 */
+    /*------------------------------------------------------------------------*/
+
+    inline bool inside( uint32_t a, uint32_t n = 1 ) const {
+      return a - base <= size - n;
+    }
+    inline uint8_t *ptr( uint32_t a, uint32_t n ) {
+      if( !inside( a, n ) )
+        throw fault{ 0, a, "access outside guest memory" };
+      return mem + ( a - base );
+    }
+    inline uint32_t guest( const void *p ) const {
+      return (uint32_t)( (const uint8_t *)p - mem ) + base;
+    }
+
+    inline uint32_t rd32( uint32_t a ) { uint32_t v; memcpy( &v, ptr( a, 4 ), 4 ); return v; }
+    inline uint32_t rd16( uint32_t a ) { uint16_t v; memcpy( &v, ptr( a, 2 ), 2 ); return v; }
+    inline uint32_t rd8( uint32_t a )  { return *ptr( a, 1 ); }
+    inline uint64_t rd64( uint32_t a ) { uint64_t v; memcpy( &v, ptr( a, 8 ), 8 ); return v; }
+
+    inline void written( uint32_t a ) {
+      if( _code[ ( a - base ) >> LINE ] )
+        flushPending = true;
+    }
+    // for the embedder, after it writes guest memory directly
+    void written( uint32_t a, uint32_t n ) {
+      for( uint32_t l=( a - base ) >> LINE;n && l<=( a - base + n - 1 ) >> LINE;l++ )
+        if( _code[l] )
+          flushPending = true;
+    }
+    inline void wr32( uint32_t a, uint32_t v ) { memcpy( ptr( a, 4 ), &v, 4 ); written( a ); }
+    inline void wr16( uint32_t a, uint32_t v ) { uint16_t h = (uint16_t)v; memcpy( ptr( a, 2 ), &h, 2 ); written( a ); }
+    inline void wr8( uint32_t a, uint32_t v )  { *ptr( a, 1 ) = (uint8_t)v; written( a ); }
+    inline void wr64( uint32_t a, uint64_t v ) { memcpy( ptr( a, 8 ), &v, 8 ); written( a ); written( a + 7 ); }
+
+    // writes pc from a register, a load or an alu result
+    inline void branch( uint32_t target ) {
+      if( target & 1 )
+        throw fault{ 0, target, "branch to Thumb code" };
+      npc = target & ~3u;
+    }
+
+    void flush() {
+      _cache.clear();
+      std::fill( _code.begin(), _code.end(), 0 );
+      flushPending = false;
+      flushes++;
+    }
+
+    inline bool passed( uint32_t cond ) const {
+      switch( cond ) {
+        case 0x0: return s.z;
+        case 0x1: return !s.z;
+        case 0x2: return s.c;
+        case 0x3: return !s.c;
+        case 0x4: return s.n;
+        case 0x5: return !s.n;
+        case 0x6: return s.v;
+        case 0x7: return !s.v;
+        case 0x8: return s.c && !s.z;
+        case 0x9: return !s.c || s.z;
+        case 0xA: return s.n == s.v;
+        case 0xB: return s.n != s.v;
+        case 0xC: return !s.z && s.n == s.v;
+        case 0xD: return s.z || s.n != s.v;
+        default:  return true;
+      }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* execution                                                              */
+    /*------------------------------------------------------------------------*/
+
+    block *lookup( uint32_t pc );
+
+    // runs from s.r[15] until pc leaves guest memory or about budget
+    // instructions have run, returns the new pc.  r15 is only kept for
+    // the instructions that read it, a fault gets its pc here.
+    uint32_t run( uint64_t budget ) {
+      uint64_t  limit = instructions + budget;
+      uint32_t  pc    = s.r[15];
+      block    *b     = nullptr;
+      const op *o     = nullptr;
+
+      try {
+        while( inside( pc, 4 ) && instructions < limit ) {
+          if( b != nullptr && b->chain[0] != nullptr && b->chain[0]->start == pc ) {
+            b = b->chain[0];
+            chained++;
+          }
+          else if( b != nullptr && b->chain[1] != nullptr && b->chain[1]->start == pc ) {
+            b = b->chain[1];
+            chained++;
+          }
+          else {
+            block *prev = b;
+            b = lookup( pc );
+            if( prev != nullptr ) {
+              prev->chain[ prev->next ] = b;
+              prev->next ^= 1;
+            }
+          }
+
+          npc = b->end;
+          o = b->ops.data();
+          const op *e = o + b->count;
+          for( ;o != e;o++ ) {
+            if( o->cond != 0xE && !passed( o->cond ) )
+              continue;
+            o->fn( *this, *o );
+          }
+          instructions += b->count;
+          pc = npc;
+
+          if( flushPending ) {
+            flush();
+            b = nullptr;
+          }
+        }
+      }
+      catch( fault &f ) {
+        if( f.pc == 0 && o != nullptr )
+          f.pc = o->addr;
+        s.r[15] = f.pc;
+        throw;
+      }
+      s.r[15] = pc;
+      return pc;
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Shifter                                                          */
+/*---------------------------------------------------------------------------*/
+
+static inline uint32_t
+shiftC( uint32_t v, uint32_t type, uint32_t n, uint32_t &carry ) {
+    switch( type ) {
+      case LSL:
+        if( n == 0 ) return v;
+        if( n < 32 ) { carry = ( v >> ( 32 - n ) ) & 1; return v << n; }
+        carry = n == 32 ? v & 1 : 0;
+        return 0;
+      case LSR:
+        if( n == 0 ) return v;
+        if( n < 32 ) { carry = ( v >> ( n - 1 ) ) & 1; return v >> n; }
+        carry = n == 32 ? v >> 31 : 0;
+        return 0;
+      case ASR:
+        if( n == 0 ) return v;
+        if( n < 32 ) { carry = ( v >> ( n - 1 ) ) & 1; return (uint32_t)( (int32_t)v >> n ); }
+        carry = v >> 31;
+        return (uint32_t)( (int32_t)v >> 31 );
+      default:
+        if( n == 0 ) return v;
+        n &= 31;
+        if( n == 0 ) { carry = v >> 31; return v; }
+        carry = ( v >> ( n - 1 ) ) & 1;
+        return ( v >> n ) | ( v << ( 32 - n ) );
+    }
+}
+
+// immediate shifts, LSR and ASR #0 mean 32, ROR #0 is RRX
+static inline uint32_t
+shiftImm( uint32_t v, uint32_t type, uint32_t n, uint32_t &carry ) {
+    if( n == 0 ) {
+      if( type == LSR || type == ASR )
+        return shiftC( v, type, 32, carry );
+      if( type == ROR ) {
+        uint32_t r = ( carry << 31 ) | ( v >> 1 );
+        carry = v & 1;
+        return r;
+      }
+      return v;
+    }
+    return shiftC( v, type, n, carry );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Data processing                                                  */
+/*---------------------------------------------------------------------------*/
+
+enum { AND, EOR, SUB, RSB, ADD, ADC, SBC, RSC, TST, TEQ, CMP, CMN, ORR, MOV, BIC, MVN };
+
+template <int O, int F, bool SET>
+static void
+dp( core &c, const op &o ) {
+    state   &s = c.s;
+    uint32_t carry = s.c;
+    uint32_t b;
+    if( F == 0 ) {
+      b = o.imm;
+      if( SET && o.amount )
+        carry = b >> 31;
+    }
+    else if( F == 1 )
+      b = shiftImm( s.r[o.rm], o.kind, o.amount, carry );
+    else if( F == 2 )
+      b = shiftC( s.r[o.rm], o.kind, s.r[o.rs] & 0xFF, carry );
+    else
+      b = s.r[o.rm];                    // lsl #0, the common case
+
+    uint32_t a = s.r[o.rn];
+    uint32_t r = 0;
+    uint32_t v = s.v;
+    switch( O ) {
+      case AND: case TST: r = a & b; break;
+      case EOR: case TEQ: r = a ^ b; break;
+      case ORR: r = a | b; break;
+      case MOV: r = b; break;
+      case BIC: r = a & ~b; break;
+      case MVN: r = ~b; break;
+      case SUB: case CMP:
+        r = a - b; carry = a >= b; v = ( ( a ^ b ) & ( a ^ r ) ) >> 31; break;
+      case RSB:
+        r = b - a; carry = b >= a; v = ( ( b ^ a ) & ( b ^ r ) ) >> 31; break;
+      case ADD: case CMN:
+        r = a + b; carry = r < a; v = ( ~( a ^ b ) & ( a ^ r ) ) >> 31; break;
+      case ADC: {
+        uint64_t t = (uint64_t)a + b + s.c;
+        r = (uint32_t)t; carry = (uint32_t)( t >> 32 ); v = ( ~( a ^ b ) & ( a ^ r ) ) >> 31; break;
+      }
+      case SBC: {
+        uint64_t t = (uint64_t)a + (uint32_t)~b + s.c;
+        r = (uint32_t)t; carry = (uint32_t)( t >> 32 ); v = ( ( a ^ b ) & ( a ^ r ) ) >> 31; break;
+      }
+      case RSC: {
+        uint64_t t = (uint64_t)b + (uint32_t)~a + s.c;
+        r = (uint32_t)t; carry = (uint32_t)( t >> 32 ); v = ( ( b ^ a ) & ( b ^ r ) ) >> 31; break;
+      }
+    }
+
+    if( O < TST || O > CMN ) {
+      if( o.rd == 15 ) {
+        c.branch( r );                  // subs pc, lr is not used in user mode
+        return;
+      }
+      s.r[o.rd] = r;
+    }
+    if( SET ) {
+      s.n = r >> 31;
+      s.z = r == 0;
+      s.c = carry;
+      s.v = v;
+    }
+}
+
+typedef void (*handler)( core &, const op & );
+
+#define A32_DP_FORMS( O )   { { dp<O,0,false>, dp<O,0,true> }, { dp<O,1,false>, dp<O,1,true> }, \
+                              { dp<O,2,false>, dp<O,2,true> }, { dp<O,3,false>, dp<O,3,true> } }
+
+static const handler dpTable[16][4][2] = {
+    A32_DP_FORMS( AND ), A32_DP_FORMS( EOR ), A32_DP_FORMS( SUB ), A32_DP_FORMS( RSB ),
+    A32_DP_FORMS( ADD ), A32_DP_FORMS( ADC ), A32_DP_FORMS( SBC ), A32_DP_FORMS( RSC ),
+    A32_DP_FORMS( TST ), A32_DP_FORMS( TEQ ), A32_DP_FORMS( CMP ), A32_DP_FORMS( CMN ),
+    A32_DP_FORMS( ORR ), A32_DP_FORMS( MOV ), A32_DP_FORMS( BIC ), A32_DP_FORMS( MVN ),
+};
+
+#undef  A32_DP_FORMS
+
+static void movw( core &c, const op &o ) { c.s.r[o.rd] = o.imm; }
+static void movt( core &c, const op &o ) { c.s.r[o.rd] = ( c.s.r[o.rd] & 0xFFFF ) | ( o.imm << 16 ); }
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Multiply and divide                                              */
+/*---------------------------------------------------------------------------*/
+
+template <bool ACC, bool SET>
+static void
+mul( core &c, const op &o ) {
+    state   &s = c.s;
+    uint32_t r = s.r[o.rm] * s.r[o.rs] + ( ACC ? s.r[o.rn] : 0 );
+    s.r[o.rd] = r;
+    if( SET ) {
+      s.n = r >> 31;
+      s.z = r == 0;
+    }
+}
+
+static void
+mls( core &c, const op &o ) {
+    c.s.r[o.rd] = c.s.r[o.rn] - c.s.r[o.rm] * c.s.r[o.rs];
+}
+
+// rd is RdHi, rn is RdLo
+template <bool SIGNED, bool ACC, bool SET>
+static void
+mull( core &c, const op &o ) {
+    state   &s = c.s;
+    uint64_t r;
+    if( SIGNED )
+      r = (uint64_t)( (int64_t)(int32_t)s.r[o.rm] * (int64_t)(int32_t)s.r[o.rs] );
+    else
+      r = (uint64_t)s.r[o.rm] * s.r[o.rs];
+    if( ACC )
+      r += ( (uint64_t)s.r[o.rd] << 32 ) | s.r[o.rn];
+    s.r[o.rn] = (uint32_t)r;
+    s.r[o.rd] = (uint32_t)( r >> 32 );
+    if( SET ) {
+      s.n = (uint32_t)( r >> 63 );
+      s.z = r == 0;
+    }
+}
+
+static void
+sdiv( core &c, const op &o ) {
+    int32_t n = (int32_t)c.s.r[o.rn];
+    int32_t m = (int32_t)c.s.r[o.rm];
+    c.s.r[o.rd] = m == 0 ? 0 : ( n == INT32_MIN && m == -1 ) ? (uint32_t)n : (uint32_t)( n / m );
+}
+
+static void
+udiv( core &c, const op &o ) {
+    uint32_t m = c.s.r[o.rm];
+    c.s.r[o.rd] = m == 0 ? 0 : c.s.r[o.rn] / m;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Loads and stores                                                 */
+/*---------------------------------------------------------------------------*/
+
+enum { LDR, STR, LDRB, STRB, LDRH, STRH, LDRSB, LDRSH, LDRD, STRD };
+
+template <int K, bool REG>
+static void
+ls( core &c, const op &o ) {
+    state   &s = c.s;
+    uint32_t offset = o.imm;
+    if( REG ) {
+      uint32_t carry = s.c;
+      offset = shiftImm( s.r[o.rm], o.kind, o.amount, carry );
+    }
+    uint32_t base = s.r[o.rn];
+    uint32_t next = ( o.bits & U ) ? base + offset : base - offset;
+    uint32_t a    = ( o.bits & P ) ? next : base;
+    if( !( o.bits & P ) || ( o.bits & W ) )
+      s.r[o.rn] = next;
+
+    switch( K ) {
+      case LDR: {
+        uint32_t v = c.rd32( a );
+        if( o.rd == 15 )
+          c.branch( v );
+        else
+          s.r[o.rd] = v;
+        break;
+      }
+      case STR:   c.wr32( a, s.r[o.rd] ); break;
+      case LDRB:  s.r[o.rd] = c.rd8( a ); break;
+      case STRB:  c.wr8( a, s.r[o.rd] ); break;
+      case LDRH:  s.r[o.rd] = c.rd16( a ); break;
+      case STRH:  c.wr16( a, s.r[o.rd] ); break;
+      case LDRSB: s.r[o.rd] = (uint32_t)(int32_t)(int8_t)c.rd8( a ); break;
+      case LDRSH: s.r[o.rd] = (uint32_t)(int32_t)(int16_t)c.rd16( a ); break;
+      case LDRD:  s.r[o.rd] = c.rd32( a ); s.r[o.rd + 1] = c.rd32( a + 4 ); break;
+      case STRD:  c.wr32( a, s.r[o.rd] ); c.wr32( a + 4, s.r[o.rd + 1] ); break;
+    }
+}
+
+template <bool LOAD>
+static void
+lsm( core &c, const op &o ) {
+    state   &s = c.s;
+    uint32_t n    = (uint32_t)__builtin_popcount( o.list ) * 4;
+    uint32_t base = s.r[o.rn];
+    uint32_t a;
+    switch( o.bits & ( P | U ) ) {
+      case U:       a = base; break;            // IA
+      case P | U:   a = base + 4; break;        // IB
+      case 0:       a = base - n + 4; break;    // DA
+      default:      a = base - n; break;        // DB
+    }
+    uint32_t pcValue = 0;
+    bool     pc      = false;
+    if( LOAD ) {
+      if( o.bits & W )
+        s.r[o.rn] = ( o.bits & U ) ? base + n : base - n;
+      for( uint32_t i=0;i<16;i++ ) {
+        if( !( o.list & ( 1 << i ) ) )
+          continue;
+        uint32_t v = c.rd32( a );
+        a += 4;
+        if( i == 15 ) {
+          pcValue = v;
+          pc      = true;
+        }
+        else
+          s.r[i] = v;
+      }
+      if( pc )
+        c.branch( pcValue );
+    }
+    else {
+      for( uint32_t i=0;i<16;i++ ) {
+        if( o.list & ( 1 << i ) ) {
+          c.wr32( a, s.r[i] );
+          a += 4;
+        }
+      }
+      if( o.bits & W )
+        s.r[o.rn] = ( o.bits & U ) ? base + n : base - n;
+    }
+}
+
+// single core and no interrupts, the monitor always succeeds
+static void ldrex( core &c, const op &o ) {
+    switch( o.kind ) {
+      case 0: c.s.r[o.rd] = c.rd32( c.s.r[o.rn] ); break;
+      case 1: c.s.r[o.rd] = c.rd32( c.s.r[o.rn] ); c.s.r[o.rd + 1] = c.rd32( c.s.r[o.rn] + 4 ); break;
+      case 2: c.s.r[o.rd] = c.rd8( c.s.r[o.rn] ); break;
+      case 3: c.s.r[o.rd] = c.rd16( c.s.r[o.rn] ); break;
+    }
+}
+
+static void strex( core &c, const op &o ) {
+    switch( o.kind ) {
+      case 0: c.wr32( c.s.r[o.rn], c.s.r[o.rm] ); break;
+      case 1: c.wr32( c.s.r[o.rn], c.s.r[o.rm] ); c.wr32( c.s.r[o.rn] + 4, c.s.r[o.rm + 1] ); break;
+      case 2: c.wr8( c.s.r[o.rn], c.s.r[o.rm] ); break;
+      case 3: c.wr16( c.s.r[o.rn], c.s.r[o.rm] ); break;
+    }
+    c.s.r[o.rd] = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Branches and miscellaneous                                       */
+/*---------------------------------------------------------------------------*/
+
+static void withPc( core &c, const op &o ) { c.s.r[15] = o.addr + 8; o.inner( c, o ); }
+
+static void b( core &c, const op &o )   { c.npc = o.imm; }
+static void bl( core &c, const op &o )  { c.s.r[14] = o.addr + 4; c.npc = o.imm; }
+static void bx( core &c, const op &o )  { c.branch( c.s.r[o.rm] ); }
+static void blx( core &c, const op &o ) { uint32_t t = c.s.r[o.rm]; c.s.r[14] = o.addr + 4; c.branch( t ); }
+static void nop( core &, const op & )   {}
+
+static void undefined( core &, const op &o ) {
+    throw fault{ o.addr, o.imm, "undefined or unsupported instruction" };
+}
+
+static void svc( core &, const op &o ) {
+    throw fault{ o.addr, o.imm, "svc" };
+}
+
+static void mrs( core &c, const op &o ) {
+    c.s.r[o.rd] = c.s.n << 31 | c.s.z << 30 | c.s.c << 29 | c.s.v << 28 | 0x10;
+}
+
+static void msr( core &c, const op &o ) {
+    uint32_t v = o.kind ? o.imm : c.s.r[o.rm];
+    c.s.n = v >> 31;
+    c.s.z = ( v >> 30 ) & 1;
+    c.s.c = ( v >> 29 ) & 1;
+    c.s.v = ( v >> 28 ) & 1;
+}
+
+static void clz( core &c, const op &o ) {
+    uint32_t v = c.s.r[o.rm];
+    c.s.r[o.rd] = v ? __builtin_clz( v ) : 32;
+}
+
+// sign and zero extension with optional add, kind is bits 22-20
+static void ext( core &c, const op &o ) {
+    uint32_t v = c.s.r[o.rm];
+    v = o.amount ? ( v >> o.amount ) | ( v << ( 32 - o.amount ) ) : v;
+    switch( o.kind ) {
+      case 2: v = (uint32_t)(int32_t)(int8_t)v; break;
+      case 3: v = (uint32_t)(int32_t)(int16_t)v; break;
+      case 6: v &= 0xFF; break;
+      case 7: v &= 0xFFFF; break;
+    }
+    c.s.r[o.rd] = o.rn == 15 ? v : c.s.r[o.rn] + v;
+}
+
+static void rev( core &c, const op &o ) {
+    uint32_t v = c.s.r[o.rm];
+    switch( o.kind ) {
+      case 0: v = __builtin_bswap32( v ); break;
+      case 1: v = ( ( v & 0x00FF00FF ) << 8 ) | ( ( v >> 8 ) & 0x00FF00FF ); break;
+      case 2: v = (uint32_t)(int32_t)(int16_t)( ( ( v & 0xFF ) << 8 ) | ( ( v >> 8 ) & 0xFF ) ); break;
+      case 3: {
+        uint32_t r = 0;
+        for( int i=0;i<32;i++ )
+          r |= ( ( v >> i ) & 1 ) << ( 31 - i );
+        v = r;
+        break;
+      }
+    }
+    c.s.r[o.rd] = v;
+}
+
+// amount is lsb, imm is width
+static void ubfx( core &c, const op &o ) {
+    uint32_t v = c.s.r[o.rn] >> o.amount;
+    c.s.r[o.rd] = o.imm >= 32 ? v : v & ( ( 1u << o.imm ) - 1 );
+}
+
+static void sbfx( core &c, const op &o ) {
+    uint32_t shift = 32 - o.imm;
+    c.s.r[o.rd] = (uint32_t)( (int32_t)( c.s.r[o.rn] << ( shift - o.amount ) ) >> shift );
+}
+
+static void bfi( core &c, const op &o ) {
+    uint32_t mask = ( o.imm >= 32 ? ~0u : ( 1u << o.imm ) - 1 ) << o.amount;
+    uint32_t v    = o.rn == 15 ? 0 : c.s.r[o.rn] << o.amount;
+    c.s.r[o.rd] = ( c.s.r[o.rd] & ~mask ) | ( v & mask );
+}
+
+// imm is the saturation bit position
+template <bool SIGNED>
+static void sat( core &c, const op &o ) {
+    uint32_t carry = c.s.c;
+    int64_t  v = (int32_t)shiftImm( c.s.r[o.rm], o.kind, o.amount, carry );
+    int64_t  hi, lo;
+    if( SIGNED ) {
+      hi = ( (int64_t)1 << ( o.imm - 1 ) ) - 1;
+      lo = -( (int64_t)1 << ( o.imm - 1 ) );
+    }
+    else {
+      hi = ( (int64_t)1 << o.imm ) - 1;
+      lo = 0;
+    }
+    c.s.r[o.rd] = (uint32_t)( v > hi ? hi : v < lo ? lo : v );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  VFP                                                              */
+/*---------------------------------------------------------------------------*/
+
+enum { VMLA, VMLS, VNMLS, VNMLA, VMUL, VNMUL, VADD, VSUB, VDIV, VMOV, VABS, VNEG, VSQRT,
+       VCMP, VCMPZ, VCVTP, VCVTIF, VCVTFI, VMOVI };
+
+static inline void
+fpFlags( core &c, double a, double b ) {
+    uint32_t nzcv;
+    if( std::isnan( a ) || std::isnan( b ) ) nzcv = 0x3;
+    else if( a == b )                        nzcv = 0x6;
+    else if( a < b )                         nzcv = 0x8;
+    else                                     nzcv = 0x2;
+    c.s.fpscr = ( c.s.fpscr & 0x0FFFFFFF ) | nzcv << 28;
+}
+
+template <typename T>
+static inline T
+toInt( double v, bool zero, uint32_t fpscr ) {
+    if( std::isnan( v ) )
+      return 0;
+    if( !zero ) {
+      switch( ( fpscr >> 22 ) & 3 ) {
+        case 0: v = std::nearbyint( v ); break;
+        case 1: v = std::ceil( v ); break;
+        case 2: v = std::floor( v ); break;
+        default: break;
+      }
+    }
+    v = std::trunc( v );
+    if( v >= (double)std::numeric_limits<T>::max() ) return std::numeric_limits<T>::max();
+    if( v <= (double)std::numeric_limits<T>::min() ) return std::numeric_limits<T>::min();
+    return (T)v;
+}
+
+// rd, rn, rm are S or D register numbers
+template <int K, bool DBL>
+static void
+vfp( core &c, const op &o ) {
+    auto &f = c.s.f;
+    typedef typename std::conditional<DBL, double, float>::type T;
+    auto  get = [&]( uint32_t i ) -> T { return DBL ? (T)f.d[i] : (T)f.s[i]; };
+    auto  set = [&]( uint32_t i, T v ) { if( DBL ) f.d[i] = v; else f.s[i] = (float)v; };
+
+    switch( K ) {
+      case VMLA:  set( o.rd, get( o.rd ) + get( o.rn ) * get( o.rm ) ); break;
+      case VMLS:  set( o.rd, get( o.rd ) - get( o.rn ) * get( o.rm ) ); break;
+      case VNMLS: set( o.rd, -get( o.rd ) + get( o.rn ) * get( o.rm ) ); break;
+      case VNMLA: set( o.rd, -get( o.rd ) - get( o.rn ) * get( o.rm ) ); break;
+      case VMUL:  set( o.rd, get( o.rn ) * get( o.rm ) ); break;
+      case VNMUL: set( o.rd, -( get( o.rn ) * get( o.rm ) ) ); break;
+      case VADD:  set( o.rd, get( o.rn ) + get( o.rm ) ); break;
+      case VSUB:  set( o.rd, get( o.rn ) - get( o.rm ) ); break;
+      case VDIV:  set( o.rd, get( o.rn ) / get( o.rm ) ); break;
+      case VMOV:
+        if( DBL ) f.x[o.rd] = f.x[o.rm]; else f.w[o.rd] = f.w[o.rm];
+        break;
+      case VABS:
+        if( DBL ) f.x[o.rd] = f.x[o.rm] & ~( 1ull << 63 ); else f.w[o.rd] = f.w[o.rm] & ~( 1u << 31 );
+        break;
+      case VNEG:
+        if( DBL ) f.x[o.rd] = f.x[o.rm] ^ ( 1ull << 63 ); else f.w[o.rd] = f.w[o.rm] ^ ( 1u << 31 );
+        break;
+      case VSQRT: set( o.rd, std::sqrt( get( o.rm ) ) ); break;
+      case VCMP:  fpFlags( c, get( o.rd ), get( o.rm ) ); break;
+      case VCMPZ: fpFlags( c, get( o.rd ), 0 ); break;
+      case VCVTP:                                        // to the other precision
+        if( DBL ) f.s[o.rd] = (float)f.d[o.rm]; else f.d[o.rd] = f.s[o.rm];
+        break;
+      case VCVTIF:                                       // rm is an S register
+        set( o.rd, o.kind ? (T)(int32_t)f.w[o.rm] : (T)f.w[o.rm] );
+        break;
+      case VCVTFI:                                       // rd is an S register
+        f.w[o.rd] = o.kind & 1 ? (uint32_t)toInt<int32_t>( get( o.rm ), o.kind & 2, c.s.fpscr )
+                               : toInt<uint32_t>( get( o.rm ), o.kind & 2, c.s.fpscr );
+        break;
+      case VMOVI:
+        if( DBL ) f.x[o.rd] = (uint64_t)o.imm << 32; else f.w[o.rd] = o.imm;
+        break;
+    }
+}
+
+#define A32_VFP( K )    { vfp<K,false>, vfp<K,true> }
+
+static const handler vfpTable[][2] = {
+    A32_VFP( VMLA ), A32_VFP( VMLS ), A32_VFP( VNMLS ), A32_VFP( VNMLA ), A32_VFP( VMUL ),
+    A32_VFP( VNMUL ), A32_VFP( VADD ), A32_VFP( VSUB ), A32_VFP( VDIV ), A32_VFP( VMOV ),
+    A32_VFP( VABS ), A32_VFP( VNEG ), A32_VFP( VSQRT ), A32_VFP( VCMP ), A32_VFP( VCMPZ ),
+    A32_VFP( VCVTP ), A32_VFP( VCVTIF ), A32_VFP( VCVTFI ), A32_VFP( VMOVI ),
+};
+
+#undef  A32_VFP
+
+// imm is the offset, amount the register count, rd the first S register
+template <bool LOAD, bool DBL>
+static void
+vls( core &c, const op &o ) {
+    uint32_t base = c.s.r[o.rn];
+    uint32_t a    = ( o.bits & U ) ? base + o.imm : base - o.imm;
+    if( o.bits & W ) {                                   // vldm, vstm
+      uint32_t n = o.amount * ( DBL ? 8 : 4 );
+      a = ( o.bits & U ) ? base : base - n;
+      c.s.r[o.rn] = ( o.bits & U ) ? base + n : base - n;
+    }
+    else if( o.amount > 1 || !( o.bits & P ) )           // no writeback
+      a = ( o.bits & U ) ? base : base - o.amount * ( DBL ? 8 : 4 );
+
+    for( uint32_t i=0;i<o.amount;i++ ) {
+      if( DBL ) {
+        if( LOAD ) c.s.f.x[o.rd + i] = c.rd64( a ); else c.wr64( a, c.s.f.x[o.rd + i] );
+        a += 8;
+      }
+      else {
+        if( LOAD ) c.s.f.w[o.rd + i] = c.rd32( a ); else c.wr32( a, c.s.f.w[o.rd + i] );
+        a += 4;
+      }
+    }
+}
+
+static void vmovToCore( core &c, const op &o )   { c.s.r[o.rd] = c.s.f.w[o.rn]; }
+static void vmovFromCore( core &c, const op &o ) { c.s.f.w[o.rn] = c.s.r[o.rd]; }
+
+// two core registers and two S registers or one D register, rn is the S index
+static void vmov2ToCore( core &c, const op &o )   { c.s.r[o.rd] = c.s.f.w[o.rn]; c.s.r[o.rm] = c.s.f.w[o.rn + 1]; }
+static void vmov2FromCore( core &c, const op &o ) { c.s.f.w[o.rn] = c.s.r[o.rd]; c.s.f.w[o.rn + 1] = c.s.r[o.rm]; }
+
+static void vmrs( core &c, const op &o ) {
+    if( o.rd == 15 ) {
+      c.s.n = c.s.fpscr >> 31;
+      c.s.z = ( c.s.fpscr >> 30 ) & 1;
+      c.s.c = ( c.s.fpscr >> 29 ) & 1;
+      c.s.v = ( c.s.fpscr >> 28 ) & 1;
+    }
+    else
+      c.s.r[o.rd] = c.s.fpscr;
+}
+
+static void vmsr( core &c, const op &o ) { c.s.fpscr = c.s.r[o.rd]; }
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Decoder                                                          */
+/*---------------------------------------------------------------------------*/
+
+static inline uint32_t
+rotate( uint32_t v, uint32_t n ) { return n ? ( v >> n ) | ( v << ( 32 - n ) ) : v; }
+
+static inline uint32_t
+sreg( uint32_t v, uint32_t bit ) { return ( v << 1 ) | bit; }      // Vx:X
+
+static inline uint32_t
+dreg( uint32_t v, uint32_t bit ) { return ( bit << 4 ) | v; }      // X:Vx
+
+static void
+decodeVfp( uint32_t x, op &o ) {
+    bool     dbl = ( x >> 8 ) & 1;
+    uint32_t vd = ( x >> 12 ) & 0xF, vn = ( x >> 16 ) & 0xF, vm = x & 0xF;
+    uint32_t D = ( x >> 22 ) & 1, N = ( x >> 7 ) & 1, M = ( x >> 5 ) & 1;
+    uint32_t rd = dbl ? dreg( vd, D ) : sreg( vd, D );
+    uint32_t rn = dbl ? dreg( vn, N ) : sreg( vn, N );
+    uint32_t rm = dbl ? dreg( vm, M ) : sreg( vm, M );
+    o.rd = (uint8_t)rd;
+    o.rn = (uint8_t)rn;
+    o.rm = (uint8_t)rm;
+
+    uint32_t opc1 = ( ( x >> 21 ) & 4 ) | ( ( x >> 20 ) & 3 );        // bits 23, 21, 20
+    bool     op6  = ( x >> 6 ) & 1;
+    int      k    = -1;
+    switch( opc1 ) {
+      case 0: k = op6 ? VMLS : VMLA; break;
+      case 1: k = op6 ? VNMLA : VNMLS; break;
+      case 2: k = op6 ? VNMUL : VMUL; break;
+      case 3: k = op6 ? VSUB : VADD; break;
+      case 4: k = op6 ? -1 : VDIV; break;
+      case 7:
+        if( !op6 ) {                                     // vmov immediate
+          uint32_t i = ( ( x >> 12 ) & 0xF0 ) | ( x & 0xF );
+          uint32_t a = i >> 7, b = ( i >> 6 ) & 1, cdefgh = i & 0x3F;
+          if( dbl )
+            o.imm = a << 31 | ( b ^ 1 ) << 30 | ( b ? 0xFF : 0 ) << 22 | cdefgh << 16;
+          else
+            o.imm = a << 31 | ( b ^ 1 ) << 30 | ( b ? 0x1F : 0 ) << 25 | cdefgh << 19;
+          k = VMOVI;
+          break;
+        }
+        switch( vn ) {
+          case 0x0: k = N ? VABS : VMOV; break;
+          case 0x1: k = N ? VSQRT : VNEG; break;
+          case 0x4: k = VCMP; break;
+          case 0x5: k = VCMPZ; break;
+          case 0x7:
+            if( N ) {
+              k = VCVTP;
+              o.rd = (uint8_t)( dbl ? sreg( vd, D ) : dreg( vd, D ) );
+            }
+            break;
+          case 0x8:
+            k = VCVTIF;
+            o.kind = N;                                  // signed
+            o.rm = (uint8_t)sreg( vm, M );
+            break;
+          case 0xC: case 0xD:
+            k = VCVTFI;
+            o.kind = ( vn & 1 ) | ( N << 1 );            // signed, round to zero
+            o.rd = (uint8_t)sreg( vd, D );
+            break;
+        }
+        break;
+    }
+    o.fn = k < 0 ? undefined : vfpTable[k][dbl];
+}
+
+static op
+decode( uint32_t x, uint32_t addr ) {
+    op o;
+    memset( &o, 0, sizeof(o) );
+    o.addr = addr;
+    o.imm  = x;
+    o.cond = (uint8_t)( x >> 28 );
+    o.rd   = ( x >> 12 ) & 0xF;
+    o.rn   = ( x >> 16 ) & 0xF;
+    o.rm   = x & 0xF;
+    o.rs   = ( x >> 8 ) & 0xF;
+    o.fn   = undefined;
+
+    if( o.cond == 0xF ) {
+      o.cond = 0xE;
+      if( ( x & 0xFD70F000 ) == 0xF550F000 ||            // pld
+          ( x & 0xFFFFFF00 ) == 0xF57FF000 )             // clrex, dsb, dmb, isb
+        o.fn = nop;
+      o.ends = o.fn == undefined;
+      return o;
+    }
+
+    uint32_t pu = ( ( x >> 24 ) & 1 ? P : 0 ) | ( ( x >> 23 ) & 1 ? U : 0 );
+    switch( ( x >> 25 ) & 7 ) {
+      case 0:
+        if( ( x & 0x90 ) == 0x90 && ( x & 0x60 ) == 0 ) {
+          if( ( x & 0x0FC000F0 ) == 0x00000090 ) {
+            bool acc = ( x >> 21 ) & 1, set = ( x >> 20 ) & 1;
+            o.rd = o.rn; o.rn = ( x >> 12 ) & 0xF;
+            o.fn = acc ? ( set ? mul<true,true> : mul<true,false> ) : ( set ? mul<false,true> : mul<false,false> );
+          }
+          else if( ( x & 0x0FF000F0 ) == 0x00600090 ) {
+            o.rd = o.rn; o.rn = ( x >> 12 ) & 0xF;
+            o.fn = mls;
+          }
+          else if( ( x & 0x0F8000F0 ) == 0x00800090 ) {
+            static const handler t[8] = {
+              mull<false,false,false>, mull<false,false,true>, mull<false,true,false>, mull<false,true,true>,
+              mull<true,false,false>,  mull<true,false,true>,  mull<true,true,false>,  mull<true,true,true>,
+            };
+            o.rd = o.rn; o.rn = ( x >> 12 ) & 0xF;
+            o.fn = t[ ( x >> 20 ) & 7 ];
+          }
+          else if( ( x & 0x0F900FF0 ) == 0x01800F90 || ( x & 0x0F900FFF ) == 0x01900F9F ) {
+            o.kind = ( x >> 21 ) & 3;
+            o.fn   = ( x >> 20 ) & 1 ? ldrex : strex;
+          }
+        }
+        else if( ( x & 0x90 ) == 0x90 ) {
+          uint32_t sh = ( x >> 5 ) & 3;
+          bool     l  = ( x >> 20 ) & 1;
+          bool     im = ( x >> 22 ) & 1;
+          int      k  = sh == 1 ? ( l ? LDRH : STRH ) : sh == 2 ? ( l ? LDRSB : LDRD ) : ( l ? LDRSH : STRD );
+          static const handler t[10][2] = {
+            { nullptr, nullptr }, { nullptr, nullptr }, { nullptr, nullptr }, { nullptr, nullptr },
+            { ls<LDRH,false>, ls<LDRH,true> }, { ls<STRH,false>, ls<STRH,true> },
+            { ls<LDRSB,false>, ls<LDRSB,true> }, { ls<LDRSH,false>, ls<LDRSH,true> },
+            { ls<LDRD,false>, ls<LDRD,true> }, { ls<STRD,false>, ls<STRD,true> },
+          };
+          o.imm    = ( ( x >> 4 ) & 0xF0 ) | ( x & 0xF );
+          o.kind   = LSL;
+          o.amount = 0;
+          o.bits   = pu | ( ( x >> 21 ) & 1 ? W : 0 );
+          o.fn     = t[k][ im ? 0 : 1 ];
+          o.ends   = o.rd == 15 || ( o.rn == 15 && ( o.bits & W ) );
+        }
+        else if( ( x & 0x0F900000 ) == 0x01000000 ) {
+          if( ( x & 0x0FBF0FFF ) == 0x010F0000 )
+            o.fn = mrs;
+          else if( ( x & 0x0FB0FFF0 ) == 0x0120F000 )
+            o.fn = ( x >> 19 ) & 1 ? msr : nop;
+          else if( ( x & 0x0FFFFFF0 ) == 0x012FFF10 ) {
+            o.fn = bx; o.ends = true;
+          }
+          else if( ( x & 0x0FFFFFF0 ) == 0x012FFF30 ) {
+            o.fn = blx; o.ends = true;
+          }
+          else if( ( x & 0x0FFF0FF0 ) == 0x016F0F10 )
+            o.fn = clz;
+        }
+        else {
+          uint32_t opc = ( x >> 21 ) & 0xF;
+          bool     reg = ( x >> 4 ) & 1;
+          o.kind   = ( x >> 5 ) & 3;
+          o.amount = ( x >> 7 ) & 0x1F;
+          o.fn     = dpTable[opc][ reg ? 2 : ( x & 0xFE0 ) == 0 ? 3 : 1 ][ ( x >> 20 ) & 1 ];
+          o.ends   = o.rd == 15 && ( opc < TST || opc > CMN );
+        }
+        break;
+
+      case 1:
+        if( ( x & 0x0FF00000 ) == 0x03000000 || ( x & 0x0FF00000 ) == 0x03400000 ) {
+          o.imm = ( ( x >> 4 ) & 0xF000 ) | ( x & 0xFFF );
+          o.fn  = ( x >> 22 ) & 1 ? movt : movw;
+        }
+        else if( ( x & 0x0FB0F000 ) == 0x0320F000 ) {
+          o.imm  = rotate( x & 0xFF, ( ( x >> 8 ) & 0xF ) * 2 );
+          o.kind = 1;
+          o.fn   = ( ( x >> 19 ) & 1 ) && !( ( x >> 22 ) & 1 ) ? msr : nop;
+        }
+        else if( ( x & 0x0F900000 ) != 0x03000000 ) {
+          uint32_t opc = ( x >> 21 ) & 0xF;
+          uint32_t rot = ( ( x >> 8 ) & 0xF ) * 2;
+          o.imm    = rotate( x & 0xFF, rot );
+          o.amount = rot != 0;
+          o.fn     = dpTable[opc][0][ ( x >> 20 ) & 1 ];
+          o.ends   = o.rd == 15 && ( opc < TST || opc > CMN );
+        }
+        break;
+
+      case 2:
+      case 3: {
+        bool reg = ( x >> 25 ) & 1;
+        if( reg && ( x & 0x10 ) ) {                      // media
+          if( ( x & 0x0F8003F0 ) == 0x06800070 && ( ( x >> 20 ) & 7 ) != 0 && ( ( x >> 20 ) & 7 ) != 4 ) {
+            o.kind   = ( x >> 20 ) & 7;
+            o.amount = ( ( x >> 10 ) & 3 ) * 8;
+            o.fn     = ext;
+          }
+          else if( ( x & 0x0FFF0FF0 ) == 0x06BF0F30 ) { o.kind = 0; o.fn = rev; }
+          else if( ( x & 0x0FFF0FF0 ) == 0x06BF0FB0 ) { o.kind = 1; o.fn = rev; }
+          else if( ( x & 0x0FFF0FF0 ) == 0x06FF0FB0 ) { o.kind = 2; o.fn = rev; }
+          else if( ( x & 0x0FFF0FF0 ) == 0x06FF0F30 ) { o.kind = 3; o.fn = rev; }
+          else if( ( x & 0x0FA00070 ) == 0x07A00050 ) {
+            o.rn     = x & 0xF;
+            o.amount = ( x >> 7 ) & 0x1F;
+            o.imm    = ( ( x >> 16 ) & 0x1F ) + 1;
+            o.fn     = ( x >> 22 ) & 1 ? ubfx : sbfx;
+          }
+          else if( ( x & 0x0FE00070 ) == 0x07C00010 ) {
+            o.rn     = x & 0xF;
+            o.amount = ( x >> 7 ) & 0x1F;
+            o.imm    = ( ( x >> 16 ) & 0x1F ) + 1 - o.amount;
+            o.fn     = bfi;
+          }
+          else if( ( x & 0x0FA00030 ) == 0x06A00010 ) {
+            bool u   = ( x >> 22 ) & 1;
+            o.kind   = ( x >> 6 ) & 1 ? ASR : LSL;
+            o.amount = ( x >> 7 ) & 0x1F;
+            o.imm    = ( ( x >> 16 ) & 0x1F ) + ( u ? 0 : 1 );
+            o.fn     = u ? sat<false> : sat<true>;
+          }
+          else if( ( x & 0x0FF0F0F0 ) == 0x0710F010 || ( x & 0x0FF0F0F0 ) == 0x0730F010 ) {
+            o.rd = ( x >> 16 ) & 0xF;
+            o.rn = x & 0xF;
+            o.rm = ( x >> 8 ) & 0xF;
+            o.fn = ( x >> 21 ) & 1 ? udiv : sdiv;
+          }
+          break;
+        }
+        bool l = ( x >> 20 ) & 1, byte = ( x >> 22 ) & 1;
+        int  k = byte ? ( l ? LDRB : STRB ) : ( l ? LDR : STR );
+        static const handler t[4][2] = {
+          { ls<LDR,false>, ls<LDR,true> }, { ls<STR,false>, ls<STR,true> },
+          { ls<LDRB,false>, ls<LDRB,true> }, { ls<STRB,false>, ls<STRB,true> },
+        };
+        o.imm    = x & 0xFFF;
+        o.kind   = ( x >> 5 ) & 3;
+        o.amount = ( x >> 7 ) & 0x1F;
+        o.bits   = pu | ( ( x >> 21 ) & 1 ? W : 0 );
+        o.fn     = t[k][reg];
+        o.ends   = ( l && o.rd == 15 ) || ( o.rn == 15 && ( o.bits & W ) );
+        break;
+      }
+
+      case 4:
+        o.list = x & 0xFFFF;
+        o.bits = pu | ( ( x >> 21 ) & 1 ? W : 0 );
+        if( ( x >> 22 ) & 1 )                            // user bank or spsr
+          break;
+        o.fn   = ( x >> 20 ) & 1 ? lsm<true> : lsm<false>;
+        o.ends = ( ( x >> 20 ) & 1 ) && ( x & 0x8000 );
+        break;
+
+      case 5: {
+        int32_t off = (int32_t)( x << 8 ) >> 6;
+        o.imm  = addr + 8 + off;
+        o.fn   = ( x >> 24 ) & 1 ? bl : b;
+        o.ends = true;
+        break;
+      }
+
+      case 6:
+        if( ( ( x >> 9 ) & 7 ) != 5 )                    // cp10 and cp11 only
+          break;
+        if( ( x & 0x0FE00FD0 ) == 0x0C400A10 || ( x & 0x0FE00FD0 ) == 0x0C400B10 ) {
+          bool dbl = ( x >> 8 ) & 1;
+          o.rd = ( x >> 12 ) & 0xF;
+          o.rm = ( x >> 16 ) & 0xF;
+          o.rn = (uint8_t)( dbl ? dreg( x & 0xF, ( x >> 5 ) & 1 ) * 2 : sreg( x & 0xF, ( x >> 5 ) & 1 ) );
+          o.fn = ( x >> 20 ) & 1 ? vmov2ToCore : vmov2FromCore;
+        }
+        else {
+          bool dbl = ( x >> 8 ) & 1;
+          bool l   = ( x >> 20 ) & 1;
+          bool w   = ( x >> 21 ) & 1;
+          uint32_t vd = ( x >> 12 ) & 0xF, D = ( x >> 22 ) & 1;
+          o.rd   = (uint8_t)( dbl ? dreg( vd, D ) : sreg( vd, D ) );
+          o.bits = pu | ( w ? W : 0 );
+          if( ( pu & P ) && !w ) {                       // vldr, vstr
+            o.imm    = ( x & 0xFF ) * 4;
+            o.amount = 1;
+          }
+          else {                                         // vldm, vstm
+            o.imm    = 0;
+            o.amount = (uint8_t)( dbl ? ( x & 0xFF ) / 2 : x & 0xFF );
+            o.bits   = ( pu & U ) | ( w ? W : 0 ) | P;
+          }
+          static const handler t[2][2] = { { vls<false,false>, vls<false,true> }, { vls<true,false>, vls<true,true> } };
+          o.fn = t[l][dbl];
+        }
+        break;
+
+      case 7:
+        if( ( x >> 24 ) & 1 ) {
+          o.fn   = svc;
+          o.ends = true;
+          break;
+        }
+        if( ( ( x >> 9 ) & 7 ) != 5 )
+          break;
+        if( ( x & 0x0FFF0FFF ) == 0x0EF10A10 )
+          o.fn = vmrs;
+        else if( ( x & 0x0FFF0FFF ) == 0x0EE10A10 )
+          o.fn = vmsr;
+        else if( ( x & 0x0FE00F7F ) == 0x0E000A10 ) {     // vmov core and S register
+          o.rn = (uint8_t)sreg( ( x >> 16 ) & 0xF, ( x >> 7 ) & 1 );
+          o.fn = ( x >> 20 ) & 1 ? vmovToCore : vmovFromCore;
+        }
+        else if( ( x & 0x0FC00F7F ) == 0x0E000B10 ) {     // vmov.32 Dn[x] and core
+          o.rn = (uint8_t)( dreg( ( x >> 16 ) & 0xF, ( x >> 7 ) & 1 ) * 2 + ( ( x >> 21 ) & 1 ) );
+          o.fn = ( x >> 20 ) & 1 ? vmovToCore : vmovFromCore;
+        }
+        else if( ( x & 0x10 ) == 0 )
+          decodeVfp( x, o );
+        break;
+    }
+
+    if( o.fn == undefined || o.fn == svc ) {
+      o.imm  = x;
+      o.ends = true;
+    }
+    else if( o.fn != b && o.fn != bl && ( ( x & 0xF ) == 0xF || ( x & 0xF00 ) == 0xF00 ||
+             ( x & 0xF000 ) == 0xF000 || ( x & 0xF0000 ) == 0xF0000 ) ) {
+      o.inner = o.fn;                   // may read pc, the list of ldm/stm is in the same bits
+      o.fn    = withPc;
+    }
+    return o;
+}
+
+inline block *
+core::lookup( uint32_t pc ) {
+    lookups++;
+    auto found = _cache.find( pc );
+    if( found != _cache.end() )
+      return found->second.get();
+
+    block *b = new block;
+    b->start = pc;
+    for( uint32_t at=pc;inside( at, 4 ) && b->ops.size() < MAX_BLOCK;at+=4 ) {
+      uint32_t x;
+      memcpy( &x, mem + ( at - base ), 4 );
+      b->ops.push_back( decode( x, at ) );
+      _code[ ( at - base ) >> LINE ] = 1;
+      if( b->ops.back().ends )
+        break;
+    }
+    b->count = (uint32_t)b->ops.size();
+    b->end   = pc + b->count * 4;
+    blocks++;
+    _cache[pc].reset( b );
+    return b;
+}
+
+};
+
+#endif // A32_H
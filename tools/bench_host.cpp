@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     bench_host.cpp                                              */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    bench_host.cpp
+  * @brief   Host backend for vex::benchmark
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -I../pub -o bench_host bench_host.cpp ../src/vex_benchmark.cpp
+// usage:  bench_host [bench_host.csv]
+//
+// Runs the standard benchmark cases against a null implementation of the
+// calls they make, the results are the cost of the harness and an indirect
+// call on this machine.  Compare with the CSV saved on the brain to see
+// what the firmware adds.
+//
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "v5_api.h"
+#include "vex_task.h"
+#include "vex_thread.h"
+#include "vex_benchmark.h"
+
+static uint8_t  devices[V5_MAX_DEVICE_PORTS];
+static double   position;
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Null v5_api.h                                                    */
+/*---------------------------------------------------------------------------*/
+
+uint64_t
+vexSystemHighResTimeGet( void ) {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return( (uint64_t)duration_cast<microseconds>( steady_clock::now() - start ).count() );
+}
+
+uint32_t
+vexSystemTimeGet( void ) {
+    return( (uint32_t)( vexSystemHighResTimeGet() / 1000 ) );
+}
+
+int32_t
+vex_printf( char const *fmt, ... ) {
+    va_list args;
+    va_start( args, fmt );
+    int32_t n = vprintf( fmt, args );
+    va_end( args );
+    return( n );
+}
+
+int32_t
+vex_snprintf( char *out, uint32_t max_len, const char *format, ... ) {
+    va_list args;
+    va_start( args, format );
+    int32_t n = vsnprintf( out, max_len, format, args );
+    va_end( args );
+    return( n );
+}
+
+V5_DeviceT      vexDeviceGetByIndex( uint32_t index )                       { return( (V5_DeviceT)&devices[ index % V5_MAX_DEVICE_PORTS ] ); }
+int32_t         vexDeviceGetStatus( V5_DeviceType *buffer )                 { memset( buffer, 0, sizeof(V5_DeviceTypeBuffer) ); return( 0 ); }
+int32_t         vexDeviceGetTimestamp( V5_DeviceT device )                  { return( (int32_t)vexSystemTimeGet() ); }
+
+int32_t         vexDeviceMotorPositionRawGet( V5_DeviceT device, uint32_t *timestamp ) { *timestamp = vexSystemTimeGet(); return( (int32_t)position ); }
+void            vexDeviceMotorVoltageSet( V5_DeviceT device, int32_t value ){ position += value; }
+void            vexDeviceMotorVelocitySet( V5_DeviceT device, int32_t velocity ) { position += velocity; }
+
+void            vexDeviceImuQuaternionGet( V5_DeviceT device, V5_DeviceImuQuaternion *data ) { memset( data, 0, sizeof(*data) ); }
+
+#define X( kind, R, fn )    R fn( V5_DeviceT device ) { return( R() ); }
+VEX_BENCHMARK_GETTERS( X )
+#undef  X
+
+int32_t         vexControllerGet( V5_ControllerId id, V5_ControllerIndex index ) { return( 0 ); }
+
+void            vexDisplayPixelSet( uint32_t x, uint32_t y )                {}
+void            vexDisplayLineDraw( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {}
+void            vexDisplayRectFill( int32_t x1, int32_t y1, int32_t x2, int32_t y2 ) {}
+void            vexDisplayStringAt( int32_t xpos, int32_t ypos, const char *format, ... ) {}
+
+// files go to the working directory
+FIL            *vexFileOpen( const char *filename, const char *mode )      { return( fopen( filename, "rb" ) ); }
+FIL            *vexFileOpenWrite( const char *filename )                    { return( fopen( filename, "wb" ) ); }
+void            vexFileClose( FIL *fdp )                                    { fclose( (FILE *)fdp ); }
+int32_t         vexFileRead( char *buf, uint32_t size, uint32_t nItems, FIL *fdp )  { return( (int32_t)fread( buf, size, nItems, (FILE *)fdp ) ); }
+int32_t         vexFileWrite( char *buf, uint32_t size, uint32_t nItems, FIL *fdp ) { return( (int32_t)fwrite( buf, size, nItems, (FILE *)fdp ) ); }
+
+/*---------------------------------------------------------------------------*/
+/** @brief  vex::task and vex::mutex                                         */
+/*---------------------------------------------------------------------------*/
+
+void vex::task::yield()   { std::this_thread::yield(); }
+
+vex::mutex::mutex() : _sem( 0 ) {}
+vex::mutex::~mutex() {}
+void vex::mutex::lock()     { while( __atomic_exchange_n( &_sem, 1, __ATOMIC_ACQUIRE ) ) std::this_thread::yield(); }
+bool vex::mutex::try_lock() { return( __atomic_exchange_n( &_sem, 1, __ATOMIC_ACQUIRE ) == 0 ); }
+void vex::mutex::unlock()   { __atomic_store_n( &_sem, 0, __ATOMIC_RELEASE ); }
+
+int
+main( int argc, char **argv ) {
+    static vex::benchmark b;
+
+    // calls here take a few nS against the 1 uS clock, keep a sample at thousands of ticks
+    b.setBatchScale( 256 );
+    b.addStandard( 0, 1 );
+    b.run();
+    remove( vex::benchmark::TEMP_FILE );
+    b.print();
+    return( b.save( argc > 1 ? argv[1] : "bench_host.csv" ) ? 0 : 1 );
+}
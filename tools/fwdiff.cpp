@@ -0,0 +1,464 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fwdiff.cpp                                                  */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fwdiff.cpp
+  * @brief   Compares the jumptables of two VEXos builds
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o fwdiff fwdiff.cpp -lz
+// usage:  fwdiff [options] old new
+//
+//   --offsets firmware_offsets.txt     names for the old build
+//   --header priv/vex_firmware_offsets.h
+//                                      private functions for --write-header
+//   --write-offsets file               firmware_offsets.txt for the new build
+//   --write-header file                VEX_FIRMWARE_Vx_x_x_x list for the new build
+//   --version a.b.c.d                  version of new, if it has no jumptable
+//
+// Builds are VEXos zips, BOOT.bin or raw system_0.elf images.  The
+// jumptable is the system_0.elf partition loaded at 0x037FC000, each slot
+// points to the code of one export.  Every export is hashed from its entry
+// to its first return with branch targets, movw/movt immediates and
+// absolute addresses masked out, so code that only moved hashes the same.
+//
+// Slots are reported as moved when the function turns up at another slot,
+// changed when the slot is kept but the code is different, and removed or
+// added when the slot is emptied or filled.  Drops such as BOOT.zip have
+// the code but no jumptable, the exports of the other build are then
+// looked for by hash and assumed to keep their slot.  Moves can only be
+// seen when both builds have a jumptable.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "fwimage.h"
+#include "fwpackage.h"
+
+static const uint32_t  VERSION_WORD = 0x1000;       // vexos+systemVersion
+static const uint32_t  MAX_WORDS    = 4096;
+
+struct slot {
+    uint32_t      value;                // the jumptable word
+    uint32_t      words;                // 0 for data slots
+    uint64_t      hash;
+    bool          found;                // located by hash, no jumptable
+};
+
+struct build {
+    const char               *name;
+    fw::mapping               map;
+    std::vector<uint8_t>      code;
+    std::vector<uint8_t>      table;
+    std::string               manifest;
+    uint32_t                  version = 0;
+    std::map<uint32_t, slot>  slots;    // by offset
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Export hashing                                                   */
+/*---------------------------------------------------------------------------*/
+
+static uint32_t
+normal( uint32_t x ) {
+    if( ( x & 0x0E000000 ) == 0x0A000000 )                   // b, bl
+      return x & 0xFF000000;
+    if( ( x & 0x0FB00000 ) == 0x03000000 )                   // movw, movt
+      return x & 0xFFF0F000;
+    if( x >= 0x03000000 && x < 0x03900000 )                  // literal address
+      return 0;
+    return x;
+}
+
+// hashes the code from an entry point to its first return
+static uint32_t
+region( const std::vector<uint8_t> &code, uint32_t at, uint64_t &hash ) {
+    fw::hasher h;
+    uint32_t   n = 0;
+    while( at + 4 <= code.size() && n < MAX_WORDS ) {
+      uint32_t x = fw::word( &code[at] );
+      uint32_t y = normal( x );
+      h.update( (const uint8_t *)&y, 4 );
+      n++;
+      at += 4;
+      if( fw::isReturn( x ) )
+        break;
+    }
+    hash = h.h;
+    return n;
+}
+
+static void
+readTable( build &b ) {
+    for( uint32_t off=0;off+4<=fw::TABLE_SIZE && off+4<=b.table.size();off+=4 ) {
+      uint32_t value = fw::word( &b.table[off] );
+      if( value == 0 )
+        continue;
+      slot s = { value, 0, value, false };
+      uint32_t at = value - fw::RAW_BASE;
+      if( value >= fw::RAW_BASE && at < b.code.size() && ( value & 3 ) == 0 )
+        s.words = region( b.code, at, s.hash );
+      b.slots[off] = s;
+    }
+}
+
+//
+// No jumptable, find the code exports of the other build by hash.  Only
+// positions whose first word matches are hashed in full.
+//
+static void
+findSlots( build &b, const build &other ) {
+    std::unordered_map<uint32_t, std::vector<uint32_t>> first;
+    for( uint32_t at=0;at+4<=b.code.size();at+=4 )
+      first[ normal( fw::word( &b.code[at] ) ) ].push_back( at );
+
+    // common first words are shared by many exports, hash each place once
+    std::vector<uint32_t> words( b.code.size() / 4, 0 );
+    std::vector<uint64_t> hashes( b.code.size() / 4 );
+
+    for( auto &o : other.slots ) {
+      const slot &want = o.second;
+      if( want.words == 0 )
+        continue;
+      uint32_t lead = normal( fw::word( &other.code[ want.value - fw::RAW_BASE ] ) );
+      auto     cand = first.find( lead );
+      if( cand == first.end() )
+        continue;
+
+      // with identical copies the one at the same address wins
+      uint32_t best = 0;
+      for( uint32_t at : cand->second ) {
+        if( words[at / 4] == 0 )
+          words[at / 4] = region( b.code, at, hashes[at / 4] );
+        if( words[at / 4] == want.words && hashes[at / 4] == want.hash ) {
+          if( best == 0 || at + fw::RAW_BASE == want.value )
+            best = at + fw::RAW_BASE;
+        }
+      }
+      if( best != 0 )
+        b.slots[o.first] = { best, want.words, want.hash, true };
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Loading                                                          */
+/*---------------------------------------------------------------------------*/
+
+static uint32_t
+parseVersion( const std::string &text ) {
+    unsigned v[4];
+    if( sscanf( text.c_str(), "%u.%u.%u.%u", &v[0], &v[1], &v[2], &v[3] ) != 4 )
+      return 0;
+    return v[0] << 24 | v[1] << 16 | v[2] << 8 | v[3];
+}
+
+static std::string
+versionText( uint32_t v, char sep ) {
+    char text[32];
+    snprintf( text, sizeof(text), "%u%c%u%c%u%c%u", v >> 24, sep, ( v >> 16 ) & 0xFF, sep, ( v >> 8 ) & 0xFF, sep, v & 0xFF );
+    return text;
+}
+
+static bool
+load( build &b ) {
+    if( !b.map.open( b.name ) )
+      return false;
+    if( !fw::extractSystem( b.map.data, b.map.size, b.code, b.table, &b.manifest ) ) {
+      fprintf( stderr, "%s: no system_0.elf found\n", b.name );
+      return false;
+    }
+    if( b.table.size() >= VERSION_WORD + 4 )
+      b.version = fw::word( &b.table[VERSION_WORD] );
+    else {
+      size_t at = b.manifest.find( "\"version\"" );
+      if( at != std::string::npos && ( at = b.manifest.find( '"', b.manifest.find( ':', at ) ) ) != std::string::npos )
+        b.version = parseVersion( b.manifest.substr( at + 1 ) );
+    }
+    readTable( b );
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Output files                                                     */
+/*---------------------------------------------------------------------------*/
+
+static std::map<std::string, uint32_t>        names;        // old offsets file
+static std::multimap<uint32_t, std::string>   byOffset;
+static std::map<uint32_t, uint32_t>           moved;        // old offset to new
+static std::set<uint32_t>                     removed;
+static std::set<uint32_t>                     added;
+
+static std::string
+nameOf( uint32_t offset ) {
+    auto n = byOffset.find( offset );
+    return n == byOffset.end() ? "" : n->second;
+}
+
+static uint32_t
+newOffset( uint32_t offset ) {
+    auto m = moved.find( offset );
+    return m == moved.end() ? offset : m->second;
+}
+
+// keeps the layout of the file, only changed lines are rewritten
+static bool
+writeOffsets( const char *in, const char *out, const std::string &version ) {
+    FILE *src = fopen( in, "r" );
+    FILE *dst = fopen( out, "w" );
+    if( src == nullptr || dst == nullptr ) {
+      perror( src == nullptr ? in : out );
+      if( src ) fclose( src );
+      if( dst ) fclose( dst );
+      return false;
+    }
+
+    char line[256];
+    while( fgets( line, sizeof(line), src ) != nullptr ) {
+      char id[128];
+      char value[64];
+      if( line[0] == '#' || sscanf( line, "%127s %63s", id, value ) != 2 ||
+          strncmp( id, "vex", 3 ) != 0 || strchr( id, '+' ) != nullptr ) {
+        fputs( line, dst );
+        continue;
+      }
+      uint32_t offset = (uint32_t)strtoul( value, nullptr, 16 );
+      if( removed.count( offset ) )
+        fprintf( dst, "# removed in %s: %s", version.c_str(), line );
+      else if( moved.count( offset ) )
+        fprintf( dst, "%-37s0x%03x\n", id, newOffset( offset ) );
+      else
+        fputs( line, dst );
+    }
+    for( uint32_t offset : added )
+      fprintf( dst, "# added in %s, not named yet    0x%03x\n", version.c_str(), offset );
+
+    fclose( src );
+    fclose( dst );
+    return true;
+}
+
+static bool
+writeHeader( const char *in, const char *out, uint32_t version, const char *from ) {
+    FILE *src = fopen( in, "r" );
+    if( src == nullptr ) {
+      perror( in );
+      return false;
+    }
+    // the private functions are the first X-list in the header
+    std::vector<std::string> functions;
+    char line[256];
+    bool list = false;
+    while( fgets( line, sizeof(line), src ) != nullptr ) {
+      char id[128];
+      if( strstr( line, "#define VEX_FIRMWARE_FUNCTIONS" ) != nullptr )
+        list = true;
+      else if( list && sscanf( line, " X( %127[A-Za-z0-9_] )", id ) == 1 )
+        functions.push_back( id );
+      else if( list )
+        break;
+    }
+    fclose( src );
+
+    std::vector<std::pair<std::string, uint32_t>> entries;
+    for( const std::string &f : functions ) {
+      auto n = names.find( f );
+      if( n != names.end() && removed.count( n->second ) == 0 )
+        entries.push_back( { f, newOffset( n->second ) } );
+    }
+
+    FILE *dst = fopen( out, "w" );
+    if( dst == nullptr ) {
+      perror( out );
+      return false;
+    }
+    std::string dots  = versionText( version, '.' );
+    std::string under = versionText( version, '_' );
+    fprintf( dst, "//\n// VEXos %s from %s, %zu of %zu private functions.\n", dots.c_str(), from, entries.size(), functions.size() );
+    fprintf( dst, "// Add to vex_firmware_offsets.h and to _database in vex_firmware.cpp\n//\n" );
+    fprintf( dst, "//    { 0x%08X, _v%s, sizeof(_v%s) / sizeof(firmware::offset) },\n//\n", version, under.c_str(), under.c_str() );
+    fprintf( dst, "#define VEX_FIRMWARE_V%s( X ) \\\n", under.c_str() );
+    for( size_t i=0;i<entries.size();i++ ) {
+      std::string id = entries[i].first + ",";
+      fprintf( dst, "  X( %-35s0x%03x )%s\n", id.c_str(), entries[i].second, i + 1 < entries.size() ? " \\" : "" );
+    }
+    fclose( dst );
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Diff                                                             */
+/*---------------------------------------------------------------------------*/
+
+static void
+report( const char *what, uint32_t from, uint32_t to, const slot *a, const slot *b ) {
+    std::string n = nameOf( from );
+    printf( "  %-8s %-40s 0x%03X", what, n.empty() ? "?" : n.c_str(), from );
+    if( to != from )
+      printf( " -> 0x%03X", to );
+    else
+      printf( "         " );
+    if( a != nullptr )
+      printf( "  0x%08X %4u", a->value, a->words );
+    if( b != nullptr )
+      printf( "  0x%08X %4u", b->value, b->words );
+    printf( "\n" );
+}
+
+int
+main( int argc, char **argv ) {
+    const char *offsetsFile = nullptr;
+    const char *headerFile  = nullptr;
+    const char *outOffsets  = nullptr;
+    const char *outHeader   = nullptr;
+    uint32_t    version     = 0;
+    std::vector<const char *> inputs;
+
+    for( int i=1;i<argc;i++ ) {
+      bool more = i + 1 < argc;
+      if( strcmp( argv[i], "--offsets" ) == 0 && more )
+        offsetsFile = argv[++i];
+      else if( strcmp( argv[i], "--header" ) == 0 && more )
+        headerFile = argv[++i];
+      else if( strcmp( argv[i], "--write-offsets" ) == 0 && more )
+        outOffsets = argv[++i];
+      else if( strcmp( argv[i], "--write-header" ) == 0 && more )
+        outHeader = argv[++i];
+      else if( strcmp( argv[i], "--version" ) == 0 && more )
+        version = parseVersion( argv[++i] );
+      else if( argv[i][0] == '-' ) {
+        fprintf( stderr, "unknown option %s\n", argv[i] );
+        return 2;
+      }
+      else
+        inputs.push_back( argv[i] );
+    }
+    if( inputs.size() != 2 || ( outOffsets && !offsetsFile ) || ( outHeader && ( !offsetsFile || !headerFile ) ) ) {
+      fprintf( stderr, "usage: fwdiff [--offsets file] [--header file] [--write-offsets file] [--write-header file] [--version a.b.c.d] old new\n" );
+      return 2;
+    }
+    if( offsetsFile != nullptr ) {
+      if( !fw::readOffsets( offsetsFile, names ) )
+        return 2;
+      for( auto &n : names )
+        byOffset.emplace( n.second, n.first );
+    }
+
+    auto  start = std::chrono::steady_clock::now();
+    build a, b;
+    a.name = inputs[0];
+    b.name = inputs[1];
+    if( !load( a ) || !load( b ) )
+      return 2;
+    if( version != 0 )
+      b.version = version;
+
+    if( a.table.empty() && b.table.empty() ) {
+      fprintf( stderr, "neither build has a jumptable, use a VEXos zip or BOOT.bin for one of them\n" );
+      return 2;
+    }
+    if( a.table.empty() )
+      findSlots( a, b );
+    if( b.table.empty() )
+      findSlots( b, a );
+    bool guessed = a.table.empty() || b.table.empty();
+
+    for( build *x : { &a, &b } ) {
+      printf( "%s: %s, %zu bytes of code, %s, %zu exports\n", x->name,
+              x->version ? versionText( x->version, '.' ).c_str() : "unknown version", x->code.size(),
+              x->table.empty() ? "no jumptable" : "jumptable", x->slots.size() );
+    }
+
+    // where each function of b lives, by hash
+    std::multimap<uint64_t, uint32_t> where;
+    for( auto &s : b.slots )
+      if( s.second.words )
+        where.emplace( s.second.hash, s.first );
+
+    int same = 0, changed = 0;
+    for( auto &s : a.slots ) {
+      const slot &old = s.second;
+      auto        now = b.slots.find( s.first );
+
+      if( now != b.slots.end() && now->second.hash == old.hash ) {
+        same++;
+        continue;
+      }
+      if( guessed && ( old.words == 0 || now == b.slots.end() ) ) {
+        // data slots cannot be found by hash, code that was not found changed
+        if( old.words ) {
+          changed++;
+          report( "missing", s.first, s.first, &old, nullptr );
+        }
+        continue;
+      }
+      // the same code at a slot that held something else before
+      uint32_t to = s.first;
+      auto     r  = where.equal_range( old.hash );
+      for( auto w=r.first;old.words && w!=r.second;++w ) {
+        auto before = a.slots.find( w->second );
+        if( before == a.slots.end() || before->second.hash != old.hash ) {
+          to = w->second;
+          break;
+        }
+      }
+      if( to != s.first ) {
+        moved[s.first] = to;
+        report( "moved", s.first, to, &old, &b.slots[to] );
+      }
+      else if( now == b.slots.end() ) {
+        removed.insert( s.first );
+        report( "removed", s.first, s.first, &old, nullptr );
+      }
+      else {
+        changed++;
+        report( old.words ? "changed" : "data", s.first, s.first, &old, &now->second );
+      }
+    }
+    std::set<uint32_t> targets;
+    for( auto &m : moved )
+      targets.insert( m.second );
+    for( auto &s : b.slots ) {
+      if( a.slots.count( s.first ) || targets.count( s.first ) )
+        continue;
+      if( !guessed ) {
+        added.insert( s.first );
+        report( "added", s.first, s.first, nullptr, &s.second );
+      }
+      else if( s.second.words ) {
+        changed++;
+        report( "missing", s.first, s.first, nullptr, &s.second );
+      }
+    }
+
+    double ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count();
+    printf( "%d unchanged, %zu moved, %d changed, %zu removed, %zu added, %.1f mS\n",
+            same, moved.size(), changed, removed.size(), added.size(), ms );
+    if( guessed )
+      printf( "one build has no jumptable, its slots were found by code hash and moves cannot be seen\n" );
+
+    std::string newVersion = b.version ? versionText( b.version, '.' ) : "unknown";
+    if( outOffsets != nullptr && !writeOffsets( offsetsFile, outOffsets, newVersion ) )
+      return 2;
+    if( outHeader != nullptr ) {
+      if( b.version == 0 ) {
+        fprintf( stderr, "%s has no version, give one with --version\n", b.name );
+        return 2;
+      }
+      if( !writeHeader( headerFile, outHeader, b.version, b.name ) )
+        return 2;
+    }
+    return moved.size() || removed.size() || changed || added.size() ? 1 : 0;
+}
@@ -0,0 +1,427 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fwimage.h                                                   */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fwimage.h
+  * @brief   Shared firmware image scanning for the host tools
+*//*---------------------------------------------------------------------------*/
+//
+// Header only, used by fwscan.cpp and fwdiff.cpp.
+//
+// Files are mapped read only and never copied.  Three kinds of input are
+// understood
+//
+//   ar archives    libv5rt.a, every ELF member is scanned
+//   ELF32 ARM      objects or linked images, functions come from the
+//                  symbol table with their names and sizes
+//   raw images     system_0.elf from BOOT.bin is a plain memory image
+//                  loaded at 0x03400000, functions are found by their
+//                  prologue and return instructions
+//
+// A table reference is a load from the firmware jumptable, the base
+// 0x037FC000 is built with mov/movt or loaded from a literal pool and the
+// slot is read with ldr rX, [rBase, #offset].  Only ARM code is decoded.
+//
+
+#ifndef   FWIMAGE_H
+#define   FWIMAGE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fw {
+
+static const uint32_t  TABLE_BASE = 0x037FC000;
+static const uint32_t  TABLE_SIZE = 0x1000;
+static const uint32_t  RAW_BASE   = 0x03400000;
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Read only file mapping                                           */
+/*---------------------------------------------------------------------------*/
+
+class mapping {
+  public:
+    const uint8_t  *data = nullptr;
+    size_t          size = 0;
+
+    mapping() {}
+    mapping( const mapping & ) = delete;
+    ~mapping() { close(); }
+
+    bool open( const char *name ) {
+      int fd = ::open( name, O_RDONLY );
+      if( fd < 0 ) {
+        perror( name );
+        return false;
+      }
+      struct stat st;
+      if( fstat( fd, &st ) != 0 || st.st_size == 0 ) {
+        ::close( fd );
+        fprintf( stderr, "%s: empty\n", name );
+        return false;
+      }
+      void *p = mmap( nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      ::close( fd );
+      if( p == MAP_FAILED ) {
+        perror( name );
+        return false;
+      }
+      data = (const uint8_t *)p;
+      size = (size_t)st.st_size;
+      return true;
+    }
+
+    void close() {
+      if( data != nullptr )
+        munmap( (void *)data, size );
+      data = nullptr;
+      size = 0;
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Scan results                                                     */
+/*---------------------------------------------------------------------------*/
+
+struct function {
+    std::string   name;                 // empty for raw images
+    std::string   member;               // archive member, if any
+    uint32_t      address;
+    uint32_t      size;                 // bytes
+    uint32_t      instructions;
+    const uint8_t *code;                // points into the mapping
+    bool          thumb;
+};
+
+struct reference {
+    uint32_t      offset;               // jumptable offset
+    uint32_t      site;                 // address of the ldr
+    int32_t       function;             // index into image::functions, -1 if none
+};
+
+struct image {
+    std::vector<function>   functions;
+    std::vector<reference>  references;
+    std::string             kind;
+};
+
+static inline uint32_t
+word( const uint8_t *p ) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint16_t
+half( const uint8_t *p ) {
+    return (uint16_t)( p[0] | p[1] << 8 );
+}
+
+// 64 bit FNV-1a, used to compare function bodies between builds
+static inline uint64_t
+hash( const uint8_t *p, size_t n ) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for( size_t i=0;i<n;i++ ) {
+      h ^= p[i];
+      h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  ARM decoding                                                     */
+/*---------------------------------------------------------------------------*/
+
+static inline bool
+isReturn( uint32_t x ) {
+    if( ( x >> 28 ) != 0xE )
+      return false;
+    return ( x & 0xFFFFFFF0 ) == 0xE12FFF10 ||        // bx rN
+           ( x & 0xFFFF8000 ) == 0xE8BD8000 ||        // pop {..., pc}
+             x == 0xE49DF004;                         // ldr pc, [sp], #4
+}
+
+static inline bool
+isPrologue( uint32_t x ) {
+    return ( x & 0xFFFF4000 ) == 0xE92D4000 ||        // push {..., lr}
+             x == 0xE52DE004;                         // str lr, [sp, #-4]!
+}
+
+//
+// Walk ARM code tracking registers that hold known constants, every ldr
+// through a register holding TABLE_BASE is a table reference.  pc is the
+// address of the first instruction, literal loads are resolved inside the
+// same block.
+//
+static inline void
+scanArm( const uint8_t *code, uint32_t size, uint32_t pc, int32_t fn, std::vector<reference> &out ) {
+    uint32_t value[16];
+    uint16_t known = 0;
+
+    for( uint32_t i=0;i+4<=size;i+=4 ) {
+      uint32_t x  = word( code + i );
+      uint32_t rd = ( x >> 12 ) & 0xF;
+      uint32_t rn = ( x >> 16 ) & 0xF;
+
+      if( ( x & 0x0FEF0000 ) == 0x03A00000 ) {                     // mov rd, #imm
+        uint32_t imm = x & 0xFF;
+        uint32_t rot = ( ( x >> 8 ) & 0xF ) * 2;
+        value[rd] = rot ? ( imm >> rot ) | ( imm << ( 32 - rot ) ) : imm;
+        known |= 1 << rd;
+      }
+      else if( ( x & 0x0FF00000 ) == 0x03000000 ) {                // movw rd, #imm16
+        value[rd] = ( ( x >> 4 ) & 0xF000 ) | ( x & 0xFFF );
+        known |= 1 << rd;
+      }
+      else if( ( x & 0x0FF00000 ) == 0x03400000 ) {                // movt rd, #imm16
+        value[rd] = ( value[rd] & 0xFFFF ) | ( ( ( x >> 4 ) & 0xF000 ) | ( x & 0xFFF ) ) << 16;
+      }
+      else if( ( x & 0x0E500000 ) == 0x04100000 ) {                // ldr rd, [rn, #imm12]
+        uint32_t imm  = x & 0xFFF;
+        bool     up   = ( x >> 23 ) & 1;
+        bool     pre  = ( x >> 24 ) & 1;
+        uint32_t disp = pre ? ( up ? imm : 0u - imm ) : 0;
+
+        if( rn == 15 ) {
+          uint32_t at = i + 8 + disp;
+          if( at + 4 <= size ) {
+            value[rd] = word( code + at );
+            known |= 1 << rd;
+          }
+          else
+            known &= ~( 1 << rd );
+          continue;
+        }
+
+        if( ( known >> rn ) & 1 && value[rn] == TABLE_BASE && disp < TABLE_SIZE )
+          out.push_back( { disp, pc + i, fn } );
+        known &= ~( 1 << rd );
+      }
+      else if( ( x & 0x0C000000 ) == 0x00000000 && ( x & 0x0F900000 ) != 0x01000000 ) {
+        known &= ~( 1 << rd );                                     // other data processing
+      }
+      else if( ( x & 0x0E100000 ) == 0x08100000 ) {
+        known &= ~( x & 0xFFFF );                                  // ldm
+      }
+      else if( ( x & 0x0F000000 ) == 0x0B000000 ) {
+        known &= ~0x500F;                                          // bl clobbers r0-r3, r12, lr
+      }
+    }
+}
+
+static inline uint32_t
+thumbInstructions( const uint8_t *code, uint32_t size ) {
+    uint32_t n = 0;
+    for( uint32_t i=0;i+2<=size;n++ ) {
+      uint16_t h = half( code + i );
+      i += ( ( h >> 11 ) >= 0x1D ) ? 4 : 2;
+    }
+    return n;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  ELF32                                                            */
+/*---------------------------------------------------------------------------*/
+
+struct elfSection {
+    uint32_t  name, type, flags, addr, offset, size, link, info, align, entsize;
+};
+
+static inline bool
+scanElf( const uint8_t *p, size_t size, const std::string &member, image &img ) {
+    if( size < 52 || memcmp( p, "\x7f" "ELF", 4 ) != 0 || p[4] != 1 || p[5] != 1 )
+      return false;
+
+    uint16_t type    = half( p + 16 );
+    uint32_t shoff   = word( p + 32 );
+    uint16_t shentsz = half( p + 46 );
+    uint16_t shnum   = half( p + 48 );
+    if( shoff == 0 || shentsz < 40 || (size_t)shoff + (size_t)shnum * shentsz > size )
+      return false;
+
+    std::vector<elfSection> sec( shnum );
+    for( int i=0;i<shnum;i++ ) {
+      const uint8_t *s = p + shoff + i * shentsz;
+      sec[i] = { word( s ), word( s+4 ), word( s+8 ), word( s+12 ), word( s+16 ),
+                 word( s+20 ), word( s+24 ), word( s+28 ), word( s+32 ), word( s+36 ) };
+    }
+
+    for( int i=0;i<shnum;i++ ) {
+      const elfSection &st = sec[i];
+      if( st.type != 2 || st.link >= shnum || st.entsize < 16 )   // SHT_SYMTAB
+        continue;
+      const elfSection &str = sec[ st.link ];
+      if( (size_t)st.offset + st.size > size || (size_t)str.offset + str.size > size )
+        continue;
+
+      for( uint32_t o=0;o+16<=st.size;o+=st.entsize ) {
+        const uint8_t *s = p + st.offset + o;
+        uint32_t nm    = word( s );
+        uint32_t value = word( s + 4 );
+        uint32_t sz    = word( s + 8 );
+        uint8_t  info  = s[12];
+        uint16_t shndx = half( s + 14 );
+
+        if( ( info & 0xF ) != 2 || shndx == 0 || shndx >= shnum || sz == 0 )   // STT_FUNC
+          continue;
+
+        const elfSection &code = sec[shndx];
+        bool     thumb = value & 1;
+        uint32_t addr  = value & ~1u;
+        uint32_t at    = ( type == 1 ) ? addr : addr - code.addr;           // ET_REL
+        if( code.type == 8 || at + (uint64_t)sz > code.size || (size_t)code.offset + at + sz > size )
+          continue;
+
+        function f;
+        f.name         = ( nm < str.size ) ? (const char *)( p + str.offset + nm ) : "";
+        f.member       = member;
+        f.address      = addr;
+        f.size         = sz;
+        f.code         = p + code.offset + at;
+        f.thumb        = thumb;
+        f.instructions = thumb ? thumbInstructions( f.code, sz ) : sz / 4;
+
+        int32_t index = (int32_t)img.functions.size();
+        img.functions.push_back( f );
+        if( !thumb ) {
+          // literal pools sit at the end of the section, scan to its end
+          uint32_t end = code.size - at;
+          scanArm( f.code, end < sz + 64 ? end : sz + 64, addr, index, img.references );
+        }
+      }
+    }
+    return true;
+}
+
+static inline bool
+scanArchive( const uint8_t *p, size_t size, image &img ) {
+    if( size < 8 || memcmp( p, "!<arch>\n", 8 ) != 0 )
+      return false;
+
+    const char *names = nullptr;
+    size_t      namesSize = 0;
+
+    for( size_t o=8;o+60<=size; ) {
+      const char *h = (const char *)( p + o );
+      size_t len = strtoul( std::string( h + 48, 10 ).c_str(), nullptr, 10 );
+      const uint8_t *body = p + o + 60;
+      if( o + 60 + len > size )
+        break;
+
+      std::string name( h, 16 );
+      name = name.substr( 0, name.find_last_not_of( ' ' ) + 1 );
+      if( name == "//" ) {
+        names     = (const char *)body;
+        namesSize = len;
+      }
+      else if( name != "/" && name != "/SYM64/" ) {
+        if( name[0] == '/' && names != nullptr ) {
+          size_t at = strtoul( name.c_str() + 1, nullptr, 10 );
+          if( at < namesSize )
+            name = std::string( names + at, strcspn( names + at, "/\n" ) );
+        }
+        else if( !name.empty() && name.back() == '/' )
+          name.pop_back();
+        scanElf( body, len, name, img );
+      }
+      o += 60 + len + ( len & 1 );
+    }
+    return true;
+}
+
+//
+// Raw images have no symbols.  Functions are split at unconditional
+// returns, a function starts at the first prologue after a return or at
+// the word after it when there is no prologue before the next return.
+//
+static inline void
+scanRaw( const uint8_t *p, size_t size, uint32_t base, image &img ) {
+    uint32_t words = (uint32_t)( size / 4 );
+    uint32_t start = 0;
+    bool     open  = false;
+
+    for( uint32_t i=0;i<words;i++ ) {
+      uint32_t x = word( p + i * 4 );
+
+      if( !open && isPrologue( x ) ) {
+        start = i;
+        open  = true;
+      }
+      if( isReturn( x ) ) {
+        if( !open )
+          start = ( start <= i ) ? start : i;
+
+        function f;
+        f.address      = base + start * 4;
+        f.size         = ( i - start + 1 ) * 4;
+        f.instructions = i - start + 1;
+        f.code         = p + start * 4;
+        f.thumb        = false;
+
+        int32_t index = (int32_t)img.functions.size();
+        img.functions.push_back( f );
+        scanArm( f.code, f.size, f.address, index, img.references );
+
+        start = i + 1;
+        open  = false;
+      }
+    }
+}
+
+static inline bool
+load( const uint8_t *p, size_t size, uint32_t base, image &img ) {
+    if( scanArchive( p, size, img ) ) {
+      img.kind = "archive";
+      return true;
+    }
+    if( scanElf( p, size, std::string(), img ) ) {
+      img.kind = "elf";
+      return true;
+    }
+    scanRaw( p, size, base, img );
+    img.kind = "raw";
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  firmware_offsets.txt                                             */
+/*---------------------------------------------------------------------------*/
+
+static inline bool
+readOffsets( const char *name, std::map<std::string, uint32_t> &offsets ) {
+    FILE *fp = fopen( name, "r" );
+    if( fp == nullptr ) {
+      perror( name );
+      return false;
+    }
+
+    char line[256];
+    while( fgets( line, sizeof(line), fp ) != nullptr ) {
+      char id[128];
+      char value[64];
+      if( line[0] == '#' || sscanf( line, "%127s %63s", id, value ) != 2 )
+        continue;
+      // vexos+ lines are data addresses, the newlib hooks such as _write_user are slots
+      if( ( strncmp( id, "vex", 3 ) != 0 && id[0] != '_' ) || strchr( id, '+' ) != nullptr )
+        continue;
+      offsets.emplace( id, (uint32_t)strtoul( value, nullptr, 16 ) );
+    }
+    fclose( fp );
+    return true;
+}
+
+};
+
+#endif // FWIMAGE_H
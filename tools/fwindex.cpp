@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fwindex.cpp                                                 */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fwindex.cpp
+  * @brief   Indexes VEXos firmware packages without extracting them
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o fwindex fwindex.cpp -lz
+// usage:  fwindex VEXOS_V5_1_1_2_0.zip                    list every entry
+//         fwindex VEXOS_V5_1_1_2_0.zip system_0.elf       entries matching a name
+//         fwindex old.zip new.zip                         entries that changed
+//
+// Lists the zip members, the BOOT.bin partitions and the assets.bin
+// blocks with their offset, size, load address and hash.  Entries are kept
+// in a hash table by path, with the top directory of the zip removed so
+// two drops line up.  A ! after the hash marks a failed CRC or checksum.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "fwimage.h"
+#include "fwpackage.h"
+
+struct package {
+    std::vector<fw::entry>                        entries;
+    std::unordered_map<std::string, size_t>       byPath;
+    std::string                                   manifest;
+    double                                        ms;
+    bool                                          ok;
+};
+
+// VEXOS_V5_1_1_2_0/BOOT.bin:FSBL.elf becomes BOOT.bin:FSBL.elf
+static std::string
+key( const std::string &path ) {
+    size_t colon = path.find( ':' );
+    size_t slash = path.rfind( '/', colon );
+    return slash == std::string::npos ? path : path.substr( slash + 1 );
+}
+
+static bool
+load( const char *name, fw::mapping &map, package &pkg ) {
+    auto start = std::chrono::steady_clock::now();
+    if( !map.open( name ) )
+      return false;
+    if( !fw::indexPackage( map.data, map.size, name, pkg.entries, &pkg.manifest ) && pkg.entries.empty() ) {
+      fprintf( stderr, "%s: not a firmware package\n", name );
+      return false;
+    }
+    pkg.ok = true;
+    for( size_t i=0;i<pkg.entries.size();i++ ) {
+      pkg.byPath.emplace( key( pkg.entries[i].path ), i );
+      pkg.ok &= pkg.entries[i].valid;
+    }
+    pkg.ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count();
+    return true;
+}
+
+static std::string
+field( const std::string &json, const char *name ) {
+    std::string tag = std::string( "\"" ) + name + "\"";
+    size_t at = json.find( tag );
+    if( at == std::string::npos || ( at = json.find( '"', json.find( ':', at ) ) ) == std::string::npos )
+      return "";
+    size_t end = json.find( '"', at + 1 );
+    return end == std::string::npos ? "" : json.substr( at + 1, end - at - 1 );
+}
+
+static void
+print( const fw::entry &e ) {
+    printf( "  %-44s 0x%08llX %9llu  ", key( e.path ).c_str(), (unsigned long long)e.offset, (unsigned long long)e.size );
+    if( e.load )
+      printf( "0x%08X", e.load );
+    else
+      printf( "%10s", "" );
+    printf( "  %016llX%s\n", (unsigned long long)e.hash, e.valid ? "" : " !" );
+}
+
+static void
+header( const char *name, const package &pkg ) {
+    printf( "%s", name );
+    if( !pkg.manifest.empty() )
+      printf( "  version %s  build %s", field( pkg.manifest, "version" ).c_str(), field( pkg.manifest, "build" ).c_str() );
+    printf( "  %zu entries  %.2f mS%s\n", pkg.entries.size(), pkg.ms, pkg.ok ? "" : "  damaged" );
+}
+
+int
+main( int argc, char **argv ) {
+    if( argc < 2 || argc > 3 ) {
+      fprintf( stderr, "usage: fwindex package [name | other package]\n" );
+      return 2;
+    }
+
+    fw::mapping map[2];
+    package     pkg[2];
+    if( !load( argv[1], map[0], pkg[0] ) )
+      return 2;
+    header( argv[1], pkg[0] );
+
+    // a second argument that is not a file is a name to look up
+    FILE *fp = argc == 3 ? fopen( argv[2], "rb" ) : nullptr;
+    if( argc == 3 && fp == nullptr ) {
+      int found = 0;
+      auto e = pkg[0].byPath.find( argv[2] );
+      if( e != pkg[0].byPath.end() ) {
+        print( pkg[0].entries[ e->second ] );
+        return 0;
+      }
+      for( const fw::entry &x : pkg[0].entries ) {
+        if( key( x.path ).find( argv[2] ) != std::string::npos ) {
+          print( x );
+          found++;
+        }
+      }
+      return found ? 0 : 1;
+    }
+    if( fp == nullptr ) {
+      for( const fw::entry &e : pkg[0].entries )
+        print( e );
+      return pkg[0].ok ? 0 : 1;
+    }
+    fclose( fp );
+
+    if( !load( argv[2], map[1], pkg[1] ) )
+      return 2;
+    header( argv[2], pkg[1] );
+
+    int changes = 0;
+    for( const fw::entry &e : pkg[0].entries ) {
+      auto other = pkg[1].byPath.find( key( e.path ) );
+      if( other == pkg[1].byPath.end() ) {
+        printf( "- " );
+        print( e );
+        changes++;
+      }
+      else if( pkg[1].entries[ other->second ].hash != e.hash ) {
+        printf( "~ " );
+        print( pkg[1].entries[ other->second ] );
+        changes++;
+      }
+    }
+    for( const fw::entry &e : pkg[1].entries ) {
+      if( pkg[0].byPath.count( key( e.path ) ) == 0 ) {
+        printf( "+ " );
+        print( e );
+        changes++;
+      }
+    }
+    printf( "%d changed\n", changes );
+    return changes ? 1 : 0;
+}
@@ -0,0 +1,536 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fwpackage.h                                                 */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fwpackage.h
+  * @brief   Streaming readers for VEXos firmware packages
+*//*---------------------------------------------------------------------------*/
+//
+// Header only, needs zlib (-lz).
+//
+// A VEXOS_V5_x_x_x_x.zip is read in place from its mapping.  Stored entries
+// are handed on as one block, deflated ones are inflated through a 64K
+// window, nothing is extracted and no entry is held in memory whole.
+// Entries are passed to a sink as a stream of blocks
+//
+//   boot       BOOT.bin, a Zynq boot image.  The headers are kept until
+//              the partition table is known, after that every partition
+//              is hashed as it streams past.  system_0.elf has two
+//              partitions, the code at 0x03400000 and the jumptable at
+//              0x037FC000.
+//   assets     assets.bin, a 512 byte V5AS header and an encrypted
+//              payload.  The payload CRC is checked and it is hashed in
+//              64K blocks so changes between drops can be located.
+//
+
+#ifndef   FWPACKAGE_H
+#define   FWPACKAGE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include "fwimage.h"
+
+namespace fw {
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Index entries                                                    */
+/*---------------------------------------------------------------------------*/
+
+struct entry {
+    std::string   path;                 // zip entry, then :partition or :block
+    uint64_t      offset;               // in the containing stream
+    uint64_t      size;
+    uint32_t      load;                 // load address, partitions only
+    uint64_t      hash;                 // FNV-1a of the contents
+    bool          valid;                // checksum or CRC matched
+};
+
+// incremental FNV-1a, hash() in fwimage.h gives the same result in one call
+struct hasher {
+    uint64_t      h = 0xcbf29ce484222325ull;
+    void update( const uint8_t *p, size_t n ) {
+      for( size_t i=0;i<n;i++ ) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+      }
+    }
+};
+
+class sink {
+  public:
+    virtual ~sink() {}
+    virtual void data( uint64_t offset, const uint8_t *p, size_t n ) = 0;
+    virtual void end( std::vector<entry> &index ) = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  BOOT.bin                                                         */
+/*---------------------------------------------------------------------------*/
+
+class boot : public sink {
+  public:
+    struct partition {
+      entry       e;
+      hasher      h;
+      uint32_t    section;
+      std::vector<uint8_t> *copy;       // set by keep()
+    };
+
+  private:
+    static const uint32_t WIDTH         = 0xAA995566;
+    static const uint32_t PARTITIONS    = 0x9C;
+    static const uint32_t MAX_HEADER    = 0x10000;
+
+    std::string             _path;
+    std::vector<uint8_t>    _head;      // headers up to the end of the partition table
+    std::vector<partition>  _parts;
+    bool                    _parsed = false;
+    bool                    _bad    = false;
+    hasher                  _file;
+    uint64_t                _size   = 0;
+    std::vector<std::pair<uint32_t, std::vector<uint8_t> *>> _keep;
+
+    uint32_t w( uint32_t o ) const { return o + 4 <= _head.size() ? word( &_head[o] ) : 0; }
+
+    // names are packed big endian in the image header words
+    std::string imageName( uint32_t at ) const {
+      std::string name;
+      for( uint32_t i=0;i<32;i++ ) {
+        uint32_t x = w( at + 16 + i * 4 );
+        for( int b=3;b>=0;b-- ) {
+          char c = (char)( x >> ( b * 8 ) );
+          if( c == 0 )
+            return name;
+          name += c;
+        }
+      }
+      return name;
+    }
+
+    // true once the whole partition table is in _head
+    bool parse() {
+      if( _head.size() < 0xA0 )
+        return false;
+      if( w( 0x20 ) != WIDTH || memcmp( &_head[0x24], "XNLX", 4 ) != 0 ) {
+        _bad = true;
+        return true;
+      }
+      uint32_t table = w( PARTITIONS );
+      for( uint32_t o=table;;o+=64 ) {
+        if( o + 64 > _head.size() )
+          return more();
+        uint32_t hw[16];
+        uint32_t sum = 0;
+        for( int i=0;i<16;i++ ) {
+          hw[i] = w( o + i * 4 );
+          if( i < 15 )
+            sum += hw[i];
+        }
+        if( hw[0] == 0 && hw[1] == 0 && hw[2] == 0 )
+          break;
+        if( hw[9] * 4 + 64 > _head.size() )
+          return more();
+
+        partition p;
+        p.section  = hw[7];
+        p.e.offset = (uint64_t)hw[5] * 4;
+        p.e.size   = (uint64_t)hw[2] * 4;
+        p.e.load   = hw[3];
+        p.e.valid  = ~sum == hw[15];
+        p.e.path   = _path + ":" + imageName( hw[9] * 4 );
+        p.e.hash   = 0;
+        p.copy     = nullptr;
+        for( auto &k : _keep )
+          if( k.first == p.e.load )
+            p.copy = k.second;
+        _parts.push_back( p );
+      }
+      // an image split over several partitions is numbered in table order
+      std::vector<std::string> names;
+      for( partition &p : _parts )
+        names.push_back( p.e.path );
+      for( size_t i=0;i<_parts.size();i++ ) {
+        int n = 0, count = 0;
+        for( size_t j=0;j<names.size();j++ ) {
+          if( names[j] == names[i] ) {
+            count++;
+            n += j < i;
+          }
+        }
+        if( count > 1 )
+          _parts[i].e.path += "#" + std::to_string( n + 1 );
+      }
+      return true;
+    }
+
+    // the table is not all here yet, give up once the limit is reached
+    bool more() {
+      _parts.clear();
+      _bad = _head.size() >= MAX_HEADER;
+      return _bad;
+    }
+
+  public:
+    boot( const std::string &path ) : _path( path ) {}
+
+    // copies the partition loaded at an address as it streams past
+    void keep( uint32_t load, std::vector<uint8_t> *out ) { _keep.push_back( { load, out } ); }
+
+    const std::vector<partition> &partitions() const { return _parts; }
+
+    void data( uint64_t offset, const uint8_t *p, size_t n ) override {
+      _file.update( p, n );
+      _size = offset + n;
+
+      if( !_parsed ) {
+        size_t take = n;
+        if( _head.size() + take > MAX_HEADER )
+          take = MAX_HEADER - _head.size();
+        _head.insert( _head.end(), p, p + take );
+        _parsed = parse();
+      }
+      if( !_parsed || _bad )
+        return;
+
+      for( partition &part : _parts ) {
+        uint64_t from = part.e.offset > offset ? part.e.offset : offset;
+        uint64_t to   = part.e.offset + part.e.size < offset + n ? part.e.offset + part.e.size : offset + n;
+        if( from >= to )
+          continue;
+        part.h.update( p + ( from - offset ), (size_t)( to - from ) );
+        if( part.copy != nullptr )
+          part.copy->insert( part.copy->end(), p + ( from - offset ), p + ( to - offset ) );
+      }
+    }
+
+    void end( std::vector<entry> &index ) override {
+      index.push_back( { _path, 0, _size, 0, _file.h, _parsed && !_bad } );
+      if( !_parsed || _bad )
+        return;
+      for( partition &part : _parts ) {
+        part.e.hash   = part.h.h;
+        part.e.valid &= part.e.offset + part.e.size <= _size;
+        index.push_back( part.e );
+      }
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  assets.bin                                                       */
+/*---------------------------------------------------------------------------*/
+
+class assets : public sink {
+    static const uint32_t MAGIC  = 0x53413556;     // V5AS
+    static const uint32_t HEADER = 0x200;
+    static const uint32_t BLOCK  = 0x10000;
+
+    std::string             _path;
+    uint8_t                 _head[HEADER];
+    uint32_t                _crc = 0;
+    uint32_t                _table[256];
+    std::vector<entry>      _blocks;
+    hasher                  _block;
+    hasher                  _file;
+    uint64_t                _size = 0;
+
+    void closeBlock( uint64_t end ) {
+      entry &e = _blocks.back();
+      e.size = end - e.offset;
+      e.hash = _block.h;
+      _block = hasher();
+    }
+
+  public:
+    uint32_t    version = 0;                        // vexSystemVersion format
+
+    assets( const std::string &path ) : _path( path ) {
+      // CRC-32 as the brain computes it, not reflected, no final xor
+      for( uint32_t i=0;i<256;i++ ) {
+        uint32_t c = i << 24;
+        for( int b=0;b<8;b++ )
+          c = ( c & 0x80000000 ) ? ( c << 1 ) ^ 0x04C11DB7 : c << 1;
+        _table[i] = c;
+      }
+    }
+
+    void data( uint64_t offset, const uint8_t *p, size_t n ) override {
+      _file.update( p, n );
+      _size = offset + n;
+
+      while( n > 0 && offset < HEADER ) {
+        _head[offset++] = *p++;
+        n--;
+      }
+      for( size_t i=0;i<n;i++ ) {
+        uint64_t at = offset + i;
+        if( ( at - HEADER ) % BLOCK == 0 ) {
+          if( !_blocks.empty() )
+            closeBlock( at );
+          char name[32];
+          snprintf( name, sizeof(name), ":%04X", (unsigned)( ( at - HEADER ) / BLOCK ) );
+          _blocks.push_back( { _path + name, at, 0, 0, 0, true } );
+        }
+        _crc = ( _crc << 8 ) ^ _table[ ( ( _crc >> 24 ) ^ p[i] ) & 0xFF ];
+        _block.h ^= p[i];
+        _block.h *= 0x100000001b3ull;
+      }
+    }
+
+    void end( std::vector<entry> &index ) override {
+      bool valid = _size >= HEADER && word( _head ) == MAGIC &&
+                   word( _head + 0x0C ) == _crc && word( _head + 0x10 ) == _size - HEADER;
+      if( _size >= HEADER )
+        version = word( _head + 0x08 );
+      index.push_back( { _path, 0, _size, 0, _file.h, valid } );
+      if( !_blocks.empty() )
+        closeBlock( _size );
+      for( entry &e : _blocks )
+        index.push_back( e );
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Other entries, hashed whole                                      */
+/*---------------------------------------------------------------------------*/
+
+class plain : public sink {
+    std::string   _path;
+    hasher        _h;
+    uint64_t      _size = 0;
+  public:
+    std::string   text;                 // kept when small, for manifest.json
+    std::vector<uint8_t> *copy = nullptr;
+
+    plain( const std::string &path ) : _path( path ) {}
+
+    void data( uint64_t offset, const uint8_t *p, size_t n ) override {
+      _h.update( p, n );
+      _size = offset + n;
+      if( text.size() + n <= 4096 )
+        text.append( (const char *)p, n );
+      if( copy != nullptr )
+        copy->insert( copy->end(), p, p + n );
+    }
+    void end( std::vector<entry> &index ) override {
+      index.push_back( { _path, 0, _size, 0, _h.h, true } );
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Zip archives                                                     */
+/*---------------------------------------------------------------------------*/
+
+class zip {
+  public:
+    struct member {
+      std::string   name;
+      uint16_t      method;             // 0 stored, 8 deflated
+      uint32_t      crc;
+      uint64_t      compressed;
+      uint64_t      size;
+      uint64_t      header;             // local header offset
+    };
+
+  private:
+    const uint8_t  *_data;
+    size_t          _size;
+
+  public:
+    std::vector<member> members;
+
+    zip( const uint8_t *data, size_t size ) : _data( data ), _size( size ) {}
+
+    bool open() {
+      if( _size < 22 )
+        return false;
+      // end of central directory, the comment can push it back 64K
+      size_t eocd = _size - 22;
+      size_t stop = _size > 22 + 0xFFFF ? _size - 22 - 0xFFFF : 0;
+      while( word( _data + eocd ) != 0x06054B50 ) {
+        if( eocd == stop )
+          return false;
+        eocd--;
+      }
+      uint16_t count = half( _data + eocd + 10 );
+      uint32_t at    = word( _data + eocd + 16 );
+
+      for( int i=0;i<count;i++ ) {
+        if( at + 46 > _size || word( _data + at ) != 0x02014B50 )
+          return false;
+        const uint8_t *c = _data + at;
+        member m;
+        m.method     = half( c + 10 );
+        m.crc        = word( c + 16 );
+        m.compressed = word( c + 20 );
+        m.size       = word( c + 24 );
+        m.header     = word( c + 42 );
+        uint16_t nameLen  = half( c + 28 );
+        uint16_t extraLen = half( c + 30 );
+        uint16_t noteLen  = half( c + 32 );
+        if( at + 46 + nameLen > _size )
+          return false;
+        m.name.assign( (const char *)c + 46, nameLen );
+        if( m.name.empty() || m.name.back() != '/' )
+          members.push_back( m );
+        at += 46 + nameLen + extraLen + noteLen;
+      }
+      return true;
+    }
+
+    // streams one member to the sink, false if it is damaged
+    bool read( const member &m, sink &out ) const {
+      if( m.header + 30 > _size || word( _data + m.header ) != 0x04034B50 )
+        return false;
+      uint64_t start = m.header + 30 + half( _data + m.header + 26 ) + half( _data + m.header + 28 );
+      if( start + m.compressed > _size )
+        return false;
+      const uint8_t *src = _data + start;
+
+      if( m.method == 0 ) {
+        out.data( 0, src, (size_t)m.size );
+        return (uint32_t)crc32( 0, src, (uInt)m.size ) == m.crc;
+      }
+      if( m.method != 8 )
+        return false;
+
+      z_stream z;
+      memset( &z, 0, sizeof(z) );
+      if( inflateInit2( &z, -MAX_WBITS ) != Z_OK )
+        return false;
+      z.next_in  = (Bytef *)src;
+      z.avail_in = (uInt)m.compressed;
+
+      static uint8_t window[0x10000];
+      uint64_t offset = 0;
+      uLong    crc    = crc32( 0, nullptr, 0 );
+      int      r;
+      do {
+        z.next_out  = window;
+        z.avail_out = sizeof(window);
+        r = inflate( &z, Z_NO_FLUSH );
+        if( r != Z_OK && r != Z_STREAM_END )
+          break;
+        size_t n = sizeof(window) - z.avail_out;
+        crc = crc32( crc, window, (uInt)n );
+        out.data( offset, window, n );
+        offset += n;
+      } while( r != Z_STREAM_END );
+      inflateEnd( &z );
+      return r == Z_STREAM_END && offset == m.size && (uint32_t)crc == m.crc;
+    }
+};
+
+static inline std::string
+baseName( const std::string &path ) {
+    size_t slash = path.find_last_of( '/' );
+    return slash == std::string::npos ? path : path.substr( slash + 1 );
+}
+
+//
+// Indexes a firmware package, a zip or a bare BOOT.bin or assets.bin.  The
+// manifest text is returned when there is one.
+//
+static inline bool
+indexPackage( const uint8_t *p, size_t size, const std::string &name, std::vector<entry> &index, std::string *manifest = nullptr ) {
+    zip z( p, size );
+    if( !z.open() ) {
+      std::string base = baseName( name );
+      if( size >= 0x28 && word( p + 0x20 ) == 0xAA995566 ) {
+        boot b( base );
+        b.data( 0, p, size );
+        b.end( index );
+      }
+      else if( size >= 4 && word( p ) == 0x53413556 ) {
+        assets a( base );
+        a.data( 0, p, size );
+        a.end( index );
+      }
+      else
+        return false;
+      return true;
+    }
+
+    bool ok = true;
+    for( const zip::member &m : z.members ) {
+      std::string base = baseName( m.name );
+      size_t      mark = index.size();
+      if( base == "BOOT.bin" ) {
+        boot b( m.name );
+        ok &= z.read( m, b );
+        b.end( index );
+      }
+      else if( base == "assets.bin" ) {
+        assets a( m.name );
+        ok &= z.read( m, a );
+        a.end( index );
+      }
+      else {
+        plain t( m.name );
+        ok &= z.read( m, t );
+        t.end( index );
+        if( base == "manifest.json" && manifest != nullptr )
+          *manifest = t.text;
+      }
+      if( index.size() > mark )
+        index[mark].offset = m.header;
+    }
+    return ok;
+}
+
+//
+// Copies out the system_0.elf code and its jumptable from a package, a bare
+// BOOT.bin or a raw system_0.elf.  Drops such as BOOT.zip carry only the
+// code, table is left empty for those.
+//
+static inline bool
+extractSystem( const uint8_t *p, size_t size, std::vector<uint8_t> &code, std::vector<uint8_t> &table, std::string *manifest = nullptr ) {
+    std::vector<entry> index;
+    zip z( p, size );
+    if( !z.open() ) {
+      if( size >= 0x28 && word( p + 0x20 ) == 0xAA995566 ) {
+        boot b( "BOOT.bin" );
+        b.keep( RAW_BASE, &code );
+        b.keep( TABLE_BASE, &table );
+        b.data( 0, p, size );
+        b.end( index );
+      }
+      else
+        code.assign( p, p + size );
+      return !code.empty();
+    }
+
+    bool ok = true;
+    for( const zip::member &m : z.members ) {
+      std::string base = baseName( m.name );
+      if( base == "BOOT.bin" ) {
+        boot b( m.name );
+        b.keep( RAW_BASE, &code );
+        b.keep( TABLE_BASE, &table );
+        ok &= z.read( m, b );
+        b.end( index );
+      }
+      else if( base == "system_0.elf" || ( base == "manifest.json" && manifest != nullptr ) ) {
+        plain t( m.name );
+        if( base == "system_0.elf" )
+          t.copy = &code;
+        ok &= z.read( m, t );
+        if( manifest != nullptr && base == "manifest.json" )
+          *manifest = t.text;
+      }
+    }
+    return ok && !code.empty();
+}
+
+};
+
+#endif // FWPACKAGE_H
@@ -0,0 +1,196 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     fwscan.cpp                                                  */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    fwscan.cpp
+  * @brief   Verifies firmware_offsets.txt against firmware and library images
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o fwscan fwscan.cpp
+// usage:  fwscan [--offsets firmware_offsets.txt] [--base 0x03400000] [--functions] image...
+//
+// The jumptable is filled in by the firmware at boot, no image holds it as
+// data.  What the images do hold is every load from it, so the table is
+// recovered from its users
+//
+//   libv5rt.a      every v5_api.h thunk is a named function that loads one
+//                  slot, name and offset are checked against the file
+//   system_0.elf   the raw image from BOOT.bin, every slot the firmware
+//                  reads itself is checked to be a known offset
+//
+// --functions lists every function with its size, instruction count and
+// the slots it reads.  Exit status is 1 if the file disagrees with an
+// image, entries that no image can confirm are listed but do not fail.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "fwimage.h"
+
+static std::map<std::string, uint32_t>  offsets;
+static std::map<uint32_t, std::string>  names;
+static std::set<std::string>            confirmed;
+
+static const char *
+nameOf( uint32_t offset ) {
+    auto n = names.find( offset );
+    return n == names.end() ? "?" : n->second.c_str();
+}
+
+static void
+listFunctions( const fw::image &img ) {
+    std::vector<std::vector<uint32_t>> reads( img.functions.size() );
+    for( const fw::reference &r : img.references )
+      if( r.function >= 0 )
+        reads[ r.function ].push_back( r.offset );
+
+    printf( "  %-10s %6s %6s  %s\n", "address", "bytes", "instr", "name / slots" );
+    for( size_t i=0;i<img.functions.size();i++ ) {
+      const fw::function &f = img.functions[i];
+      printf( "  0x%08X %6u %6u  %s%s%s", f.address, f.size, f.instructions,
+              f.member.c_str(), f.member.empty() ? "" : ":", f.name.c_str() );
+      for( uint32_t o : reads[i] )
+        printf( " [0x%03X %s]", o, nameOf( o ) );
+      printf( "\n" );
+    }
+}
+
+//
+// A thunk is a named function reading exactly one slot, the name must be
+// in the file at that offset.
+//
+static int
+checkNamed( const fw::image &img ) {
+    std::vector<std::set<uint32_t>> reads( img.functions.size() );
+    for( const fw::reference &r : img.references )
+      if( r.function >= 0 )
+        reads[ r.function ].insert( r.offset );
+
+    int errors = 0;
+    int thunks = 0;
+    for( size_t i=0;i<img.functions.size();i++ ) {
+      const fw::function &f = img.functions[i];
+      if( reads[i].size() != 1 || f.name.compare( 0, 3, "vex" ) != 0 )
+        continue;
+      thunks++;
+
+      uint32_t slot = *reads[i].begin();
+      auto     e    = offsets.find( f.name );
+      if( e == offsets.end() ) {
+        printf( "  missing   %-40s 0x%03X, not in the offsets file\n", f.name.c_str(), slot );
+        errors++;
+      }
+      else if( e->second != slot ) {
+        printf( "  mismatch  %-40s 0x%03X in the file, 0x%03X in the image\n", f.name.c_str(), e->second, slot );
+        errors++;
+      }
+      else
+        confirmed.insert( f.name );
+    }
+    printf( "  %d thunks checked, %d errors\n", thunks, errors );
+    return errors;
+}
+
+//
+// Raw images only give offsets, any slot the firmware reads must be known.
+//
+static int
+checkRaw( const fw::image &img ) {
+    std::map<uint32_t, uint32_t> sites;
+    for( const fw::reference &r : img.references )
+      sites.emplace( r.offset, r.site );
+
+    int errors = 0;
+    for( auto &s : sites ) {
+      if( names.count( s.first ) == 0 ) {
+        printf( "  unknown   0x%03X read at 0x%08X\n", s.first, s.second );
+        errors++;
+      }
+      else
+        confirmed.insert( names[ s.first ] );
+    }
+    printf( "  %zu slots read, %d unknown\n", sites.size(), errors );
+    return errors;
+}
+
+int
+main( int argc, char **argv ) {
+    const char *offsetsFile = nullptr;
+    uint32_t    base        = fw::RAW_BASE;
+    bool        functions   = false;
+    std::vector<const char *> inputs;
+
+    for( int i=1;i<argc;i++ ) {
+      if( strcmp( argv[i], "--offsets" ) == 0 && i + 1 < argc )
+        offsetsFile = argv[++i];
+      else if( strcmp( argv[i], "--base" ) == 0 && i + 1 < argc )
+        base = (uint32_t)strtoul( argv[++i], nullptr, 0 );
+      else if( strcmp( argv[i], "--functions" ) == 0 )
+        functions = true;
+      else if( argv[i][0] == '-' ) {
+        fprintf( stderr, "unknown option %s\n", argv[i] );
+        return 2;
+      }
+      else
+        inputs.push_back( argv[i] );
+    }
+    if( inputs.empty() ) {
+      fprintf( stderr, "usage: fwscan [--offsets firmware_offsets.txt] [--base 0x03400000] [--functions] image...\n" );
+      return 2;
+    }
+
+    if( offsetsFile != nullptr ) {
+      if( !fw::readOffsets( offsetsFile, offsets ) )
+        return 2;
+      // aliases share a slot, report the first name
+      for( auto &o : offsets )
+        names.emplace( o.second, o.first );
+    }
+
+    int errors = 0;
+    for( const char *name : inputs ) {
+      auto start = std::chrono::steady_clock::now();
+
+      fw::mapping map;
+      fw::image   img;
+      if( !map.open( name ) )
+        return 2;
+      fw::load( map.data, map.size, base, img );
+
+      double ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count();
+      uint64_t instructions = 0;
+      for( const fw::function &f : img.functions )
+        instructions += f.instructions;
+
+      printf( "%s: %s, %zu functions, %llu instructions, %zu table reads, %.2f mS\n",
+              name, img.kind.c_str(), img.functions.size(), (unsigned long long)instructions,
+              img.references.size(), ms );
+
+      if( functions )
+        listFunctions( img );
+      if( offsetsFile != nullptr )
+        errors += img.kind == "raw" ? checkRaw( img ) : checkNamed( img );
+    }
+
+    if( offsetsFile != nullptr ) {
+      size_t unconfirmed = 0;
+      for( auto &o : offsets )
+        if( confirmed.count( o.first ) == 0 && confirmed.count( nameOf( o.second ) ) == 0 )
+          unconfirmed++;
+      printf( "%zu of %zu offsets confirmed, %zu not seen in any image\n",
+              offsets.size() - unconfirmed, offsets.size(), unconfirmed );
+    }
+    return errors ? 1 : 0;
+}
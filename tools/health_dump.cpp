@@ -0,0 +1,105 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     health_dump.cpp                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    health_dump.cpp
+  * @brief   Host side decoder for logs written by vex::health_monitor::log
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o health_dump health_dump.cpp
+// usage:  health_dump health.bin [port]
+//
+// Prints one line per event, ports are shown one-based as on the brain.
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#pragma pack(push, 1)
+struct header {
+    uint32_t  magic;
+    uint16_t  version;
+    uint16_t  recordSize;
+};
+
+struct event {
+    uint32_t  time;
+    uint8_t   port;
+    uint8_t   type;
+    uint16_t  value;
+};
+#pragma pack(pop)
+
+static const uint32_t  HEALTH_LOG_MAGIC = 0x48544c48;
+
+static const char *eventNames[] = {
+    "connected", "disconnected", "stale", "fresh", "stall start",
+    "stall end", "limit start", "limit end", "fault set", "fault cleared"
+};
+
+static void
+printFaults( uint16_t value ) {
+    static const char *names[] = { "over temp", "driver", "over current", "driver current" };
+    const char *sep = "";
+    for( int b = 0; b < 16; b++ ) {
+      if( !( value & ( 1 << b ) ) )
+        continue;
+      if( b < 4 )
+        printf( "%s%s", sep, names[b] );
+      else
+        printf( "%sbit %d", sep, b );
+      sep = ", ";
+    }
+}
+
+int
+main( int argc, char **argv ) {
+    if( argc < 2 ) {
+      fprintf( stderr, "usage: %s health.bin [port]\n", argv[0] );
+      return 1;
+    }
+
+    FILE *fp = fopen( argv[1], "rb" );
+    if( fp == nullptr ) {
+      perror( argv[1] );
+      return 1;
+    }
+
+    int only = ( argc > 2 ) ? atoi( argv[2] ) : 0;
+
+    header h;
+    if( fread( &h, sizeof(h), 1, fp ) != 1 || h.magic != HEALTH_LOG_MAGIC || h.recordSize != sizeof(event) ) {
+      fprintf( stderr, "%s: not a health log\n", argv[1] );
+      fclose( fp );
+      return 1;
+    }
+
+    event e;
+    long  count = 0;
+    while( fread( &e, sizeof(e), 1, fp ) == 1 ) {
+      if( only != 0 && e.port + 1 != only )
+        continue;
+
+      printf( "%8.3f  port %2d  ", e.time / 1000.0, e.port + 1 );
+      if( e.type < sizeof(eventNames) / sizeof(eventNames[0]) )
+        printf( "%-14s", eventNames[e.type] );
+      else
+        printf( "type %-9d", e.type );
+
+      if( e.type == 8 || e.type == 9 )
+        printFaults( e.value );
+      else
+        printf( "device type %d", e.value );
+      printf( "\n" );
+      count++;
+    }
+
+    fclose( fp );
+    fprintf( stderr, "%ld events\n", count );
+    return 0;
+}
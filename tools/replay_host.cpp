@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     replay_host.cpp                                             */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    replay_host.cpp
+  * @brief   Host side playback of recordings made by vex::replay::record
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -I../pub -I../priv -o run replay_host.cpp control.cpp
+//
+// Defines every function in VEX_REPLAY_FUNCTIONS plus vexDeviceGetByIndex
+// and vexDevicesGet.  Control code written against v5_api.h calls
+// vex::replay::play( "match.rply" ) and then runs as it did on the brain.
+// Outputs such as vexDeviceMotorVoltageSet are not defined here, the test
+// harness provides them, usually to capture what the code commanded.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <tuple>
+
+#include "v5_api.h"
+#include "vex_replay.h"
+
+#define X( id, offset, fn, arity )    + 1
+static const uint32_t FUNCTIONS = 0 VEX_REPLAY_FUNCTIONS( X );
+#undef  X
+
+using namespace vex;
+
+volatile replay::modeType replay::_mode = replay::modeType::idle;
+uint32_t              replay::_last[ replay::LAST_SIZE ];
+uint8_t               replay::_buffer[2][ replay::BUFFER_SIZE ];
+int32_t               replay::_current      = 0;
+int32_t               replay::_length       = 0;
+int32_t               replay::_position     = 0;
+volatile int32_t      replay::_pending[2]   = { 0, 0 };
+volatile bool         replay::_writing      = false;
+uint32_t              replay::_calls        = 0;
+uint32_t              replay::_stalls       = 0;
+int32_t               replay::_diverged     = -1;
+uint8_t              *replay::_deviceBase   = NULL;
+int32_t               replay::_deviceStride = 0;
+vex::task            *replay::_task         = NULL;
+FIL                  *replay::_file         = NULL;
+
+// one byte per port so the replay class maps handles back to ports
+static uint8_t  devices[V5_MAX_DEVICE_PORTS];
+
+V5_DeviceT
+vexDevicesGet( void ) {
+    return( (V5_DeviceT)devices );
+}
+
+V5_DeviceT
+vexDeviceGetByIndex( uint32_t index ) {
+    return( (V5_DeviceT)&devices[ index < V5_MAX_DEVICE_PORTS ? index : 0 ] );
+}
+
+void
+replay::_reset() {
+    memset( _last, 0, sizeof(_last) );
+    _current      = 0;
+    _length       = 0;
+    _position     = 0;
+    _calls        = 0;
+    _stalls       = 0;
+    _diverged     = -1;
+    _deviceBase   = devices;
+    _deviceStride = 1;
+}
+
+// nothing is recorded on the host
+void
+replay::_swap() {
+    _length = 0;
+}
+
+bool
+replay::_refill() {
+    size_t n = ( _file != NULL ) ? fread( _buffer[0], 1, BUFFER_SIZE, (FILE *)_file ) : 0;
+
+    _position = 0;
+    _length   = (int32_t)n;
+    return( _length > 0 );
+}
+
+bool
+replay::record( const char *name ) {
+    return( false );
+}
+
+bool
+replay::play( const char *name ) {
+    if( _mode != modeType::idle )
+      return( false );
+
+    FILE *fp = fopen( name, "rb" );
+    if( fp == NULL )
+      return( false );
+
+    header h;
+    if( fread( &h, sizeof(header), 1, fp ) != 1 ||
+        h.magic != MAGIC || h.version != VERSION || h.functions > FUNCTIONS ) {
+      fclose( fp );
+      return( false );
+    }
+
+    _reset();
+    _file = fp;
+    _mode = modeType::playing;
+    return( true );
+}
+
+void
+replay::stop() {
+    if( _mode == modeType::idle )
+      return;
+
+    _mode = modeType::idle;
+    fclose( (FILE *)_file );
+    _file = NULL;
+}
+
+replay::modeType
+replay::mode() {
+    return( _mode );
+}
+
+uint32_t
+replay::calls() {
+    return( _calls );
+}
+
+uint32_t
+replay::stalls() {
+    return( _stalls );
+}
+
+int32_t
+replay::diverged() {
+    return( _diverged );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Recorded functions                                               */
+/*---------------------------------------------------------------------------*/
+
+namespace vex {
+  class replay_host {
+    public:
+      template <int32_t ID, typename F>
+      static F thunk() {
+        return( &replay::_hook<ID, F>::play );
+      }
+  };
+};
+
+template <typename F> struct signature;
+template <typename R, typename... A>
+struct signature<R (*)( A... )> {
+  typedef R ret;
+  template <int N> struct arg {
+    typedef typename std::tuple_element<N, std::tuple<A...>>::type type;
+  };
+};
+
+#define RET( fn )             signature<decltype(&fn)>::ret
+#define ARG( fn, n )          signature<decltype(&fn)>::arg<n>::type
+#define PLAY( id, fn )        replay_host::thunk<id, decltype(&fn)>()
+
+#define DEFINE_0( id, fn )    RET(fn) fn( void ) { return PLAY( id, fn )(); }
+#define DEFINE_1( id, fn )    RET(fn) fn( ARG(fn,0) a ) { return PLAY( id, fn )( a ); }
+#define DEFINE_2( id, fn )    RET(fn) fn( ARG(fn,0) a, ARG(fn,1) b ) { return PLAY( id, fn )( a, b ); }
+#define DEFINE_3( id, fn )    RET(fn) fn( ARG(fn,0) a, ARG(fn,1) b, ARG(fn,2) c ) { return PLAY( id, fn )( a, b, c ); }
+
+#define X( id, offset, fn, arity )    DEFINE_##arity( id, fn )
+VEX_REPLAY_FUNCTIONS( X )
+#undef  X
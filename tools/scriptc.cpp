@@ -0,0 +1,390 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     scriptc.cpp                                                 */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    scriptc.cpp
+  * @brief   Compiles autonomous routines for vex::script
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -I../pub -o scriptc scriptc.cpp
+// usage:  scriptc auton.txt auton.bin          compile
+//         scriptc -l auton.bin                 list a compiled script
+//
+// One instruction per line, # starts a comment.  @n or @name picks the
+// drivetrain or motor group the script attached at that index, @0 when
+// left out.  Units default to the first one listed.  Motions wait for
+// completion unless the line ends with nowait.
+//
+//   alias intake 1                     name an index
+//   wait 500 [msec|sec]
+//   drivevelocity [@d] 50 [pct|rpm|dps]
+//   turnvelocity [@d] 30 [pct|rpm|dps]
+//   drive [@d] 24 [in|mm|cm] [nowait]
+//   turn [@d] 90 [deg|rev] [nowait]     positive is to the right
+//   heading [@d] 180 [deg|rev] [nowait] smartdrive only
+//   stop [@d] [brake|coast|hold]
+//   waitdrive [@d]
+//   velocity @g 100 [pct|rpm|dps]
+//   spin @g 360 [deg|rev|sec|msec] [nowait]
+//   spinto @g 90 [deg|rev] [nowait]
+//   stopgroup @g [brake|coast|hold]
+//   waitgroup @g
+//   signal 3                           broadcast the event attached to 3
+//   await 3 [timeout mS]               wait for script.signal( 3 )
+//   repeat 4 ... next
+//   end
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "v5_api.h"
+#include "vex_units.h"
+#include "vex_script.h"
+
+using vex::script;
+typedef script::opcode opcode;
+
+#define X( id, name, format )   { #name, format },
+static const struct {
+    const char   *name;
+    const char   *format;
+} opcodes[] = { VEX_SCRIPT_OPCODES( X ) };
+#undef  X
+
+struct unit {
+    const char   *name;
+    int           value;
+};
+
+static const unit velocities[] = { { "pct", (int)vex::velocityUnits::pct }, { "rpm", (int)vex::velocityUnits::rpm }, { "dps", (int)vex::velocityUnits::dps }, { nullptr, 0 } };
+static const unit distances[]  = { { "in",  (int)vex::distanceUnits::in },  { "mm",  (int)vex::distanceUnits::mm },  { "cm",  (int)vex::distanceUnits::cm },  { nullptr, 0 } };
+static const unit rotations[]  = { { "deg", (int)vex::rotationUnits::deg }, { "rev", (int)vex::rotationUnits::rev }, { nullptr, 0 } };
+static const unit times[]      = { { "msec", (int)vex::timeUnits::msec },   { "sec", (int)vex::timeUnits::sec },    { nullptr, 0 } };
+static const unit brakes[]     = { { "brake", (int)vex::brakeType::brake }, { "coast", (int)vex::brakeType::coast }, { "hold", (int)vex::brakeType::hold }, { nullptr, 0 } };
+
+struct compiler {
+    const char                   *file;
+    int                           line;
+    int                           errors;
+    std::vector<uint8_t>          code;
+    std::vector<size_t>           repeats;
+    std::map<std::string, int>    aliases;
+    int                           last;                   // last opcode emitted
+
+    // tokens of the current line, consumed from the front
+    std::vector<std::string>      words;
+    size_t                        at;
+
+    void error( const char *what, const std::string &word = "" ) {
+      fprintf( stderr, "%s:%d: %s%s%s\n", file, line, what, word.empty() ? "" : " ", word.c_str() );
+      errors++;
+    }
+
+    bool more() {
+      return at < words.size();
+    }
+    bool peek( const char *word ) {
+      return more() && words[at] == word;
+    }
+
+    int index( int limit ) {
+      if( !more() || words[at][0] != '@' )
+        return 0;
+      std::string name = words[at++].substr( 1 );
+      auto a = aliases.find( name );
+      char *end;
+      long n = ( a != aliases.end() ) ? a->second : strtol( name.c_str(), &end, 10 );
+      if( ( a == aliases.end() && ( name.empty() || *end != 0 ) ) || n < 0 || n >= limit ) {
+        error( "bad index", "@" + name );
+        return 0;
+      }
+      return (int)n;
+    }
+
+    float number() {
+      if( !more() ) {
+        error( "missing number" );
+        return 0;
+      }
+      char *end;
+      const std::string &w = words[at++];
+      float f = strtof( w.c_str(), &end );
+      if( w.empty() || *end != 0 )
+        error( "bad number", w );
+      return f;
+    }
+
+    int units( const unit *list ) {
+      for( const unit *u=list;more() && u->name!=nullptr;u++ ) {
+        if( words[at] == u->name ) {
+          at++;
+          return u->value;
+        }
+      }
+      return list[0].value;
+    }
+
+    int flag( const char *word ) {
+      if( peek( word ) ) {
+        at++;
+        return 1;
+      }
+      return 0;
+    }
+
+    // operands in the order of the opcode format
+    void emit( opcode op, std::initializer_list<double> operands ) {
+      const char *format = opcodes[ (int)op ].format;
+      auto        v      = operands.begin();
+
+      last = (int)op;
+      code.push_back( (uint8_t)op );
+      for( const char *f=format;*f;f++, v++ ) {
+        if( *f == 'f' ) {
+          float x = (float)*v;
+          uint8_t b[4];
+          memcpy( b, &x, 4 );
+          code.insert( code.end(), b, b + 4 );
+        }
+        else if( *f == 'c' || *f == 'o' ) {
+          int16_t x = (int16_t)*v;
+          code.push_back( (uint8_t)( x & 0xFF ) );
+          code.push_back( (uint8_t)( ( x >> 8 ) & 0xFF ) );
+        }
+        else
+          code.push_back( (uint8_t)*v );
+      }
+    }
+
+    void statement();
+};
+
+void
+compiler::statement() {
+    std::string cmd = words[at++];
+    int         d, u;
+    float       v;
+
+    if( cmd == "alias" ) {
+      if( words.size() != 3 )
+        error( "usage: alias name index" );
+      else
+        aliases[ words[1] ] = atoi( words[2].c_str() );
+      at = words.size();
+    }
+    else if( cmd == "wait" ) {
+      v = number();
+      u = units( times );
+      emit( opcode::wait, { u == (int)vex::timeUnits::sec ? v * 1000 : v } );
+    }
+    else if( cmd == "drivevelocity" || cmd == "turnvelocity" ) {
+      d = index( script::MAX_DRIVES );
+      v = number();
+      emit( cmd == "drivevelocity" ? opcode::driveVelocity : opcode::turnVelocity, { (double)d, v, (double)units( velocities ) } );
+    }
+    else if( cmd == "drive" ) {
+      d = index( script::MAX_DRIVES );
+      v = number();
+      u = units( distances );
+      emit( opcode::driveFor, { (double)d, v, (double)u, (double)!flag( "nowait" ) } );
+    }
+    else if( cmd == "turn" || cmd == "heading" ) {
+      d = index( script::MAX_DRIVES );
+      v = number();
+      u = units( rotations );
+      emit( cmd == "turn" ? opcode::turnFor : opcode::turnToHeading, { (double)d, v, (double)u, (double)!flag( "nowait" ) } );
+    }
+    else if( cmd == "stop" ) {
+      d = index( script::MAX_DRIVES );
+      emit( opcode::driveStop, { (double)d, (double)units( brakes ) } );
+    }
+    else if( cmd == "waitdrive" ) {
+      emit( opcode::driveWait, { (double)index( script::MAX_DRIVES ) } );
+    }
+    else if( cmd == "velocity" ) {
+      d = index( script::MAX_GROUPS );
+      v = number();
+      emit( opcode::groupVelocity, { (double)d, v, (double)units( velocities ) } );
+    }
+    else if( cmd == "spin" || cmd == "spinto" ) {
+      d = index( script::MAX_GROUPS );
+      v = number();
+      if( cmd == "spin" && ( peek( "sec" ) || peek( "msec" ) ) )
+        emit( opcode::spinForTime, { (double)d, v, (double)units( times ) } );
+      else {
+        u = units( rotations );
+        emit( cmd == "spin" ? opcode::spinFor : opcode::spinToPosition, { (double)d, v, (double)u, (double)!flag( "nowait" ) } );
+      }
+    }
+    else if( cmd == "stopgroup" ) {
+      d = index( script::MAX_GROUPS );
+      emit( opcode::groupStop, { (double)d, (double)units( brakes ) } );
+    }
+    else if( cmd == "waitgroup" ) {
+      emit( opcode::groupWait, { (double)index( script::MAX_GROUPS ) } );
+    }
+    else if( cmd == "signal" || cmd == "await" ) {
+      v = number();
+      if( v < 0 || v >= script::MAX_SIGNALS || v != (int)v )
+        error( "signal must be 0 to 31" );
+      if( cmd == "signal" )
+        emit( opcode::signal, { v } );
+      else
+        emit( opcode::await, { v, more() ? number() : 0 } );
+    }
+    else if( cmd == "repeat" ) {
+      v = number();
+      if( v < 1 || v > 65535 || v != (int)v )
+        error( "repeat count must be 1 to 65535" );
+      if( repeats.size() >= (size_t)script::MAX_DEPTH )
+        error( "repeats nested too deep" );
+      emit( opcode::repeat, { (double)(int16_t)(uint16_t)v } );
+      repeats.push_back( code.size() );
+    }
+    else if( cmd == "next" ) {
+      if( repeats.empty() ) {
+        error( "next without repeat" );
+        return;
+      }
+      // the offset is from the end of the next instruction
+      long offset = (long)repeats.back() - (long)( code.size() + 3 );
+      repeats.pop_back();
+      if( offset < -32768 )
+        error( "repeat body too long" );
+      emit( opcode::next, { (double)offset } );
+    }
+    else if( cmd == "end" ) {
+      emit( opcode::end, {} );
+    }
+    else
+      error( "unknown instruction", cmd );
+
+    if( more() )
+      error( "unexpected", words[at] );
+}
+
+static bool
+compile( const char *in, const char *out ) {
+    FILE *fp = fopen( in, "r" );
+    if( fp == nullptr ) {
+      perror( in );
+      return false;
+    }
+
+    compiler c;
+    c.file   = in;
+    c.line   = 0;
+    c.errors = 0;
+    c.last   = -1;
+
+    char text[512];
+    while( fgets( text, sizeof(text), fp ) != nullptr ) {
+      c.line++;
+      char *hash = strchr( text, '#' );
+      if( hash != nullptr )
+        *hash = 0;
+
+      c.words.clear();
+      c.at = 0;
+      for( char *w=strtok( text, " \t\r\n" );w!=nullptr;w=strtok( nullptr, " \t\r\n" ) )
+        c.words.push_back( w );
+      if( !c.words.empty() )
+        c.statement();
+    }
+    fclose( fp );
+
+    if( !c.repeats.empty() )
+      c.error( "repeat without next" );
+    if( c.last != (int)opcode::end )
+      c.emit( opcode::end, {} );
+    if( c.code.size() > (size_t)script::MAX_CODE )
+      c.error( "script too large" );
+    if( c.errors )
+      return false;
+
+    script::header h;
+    h.magic   = script::MAGIC;
+    h.version = script::VERSION;
+    h.size    = (uint16_t)c.code.size();
+
+    fp = fopen( out, "wb" );
+    if( fp == nullptr ) {
+      perror( out );
+      return false;
+    }
+    fwrite( &h, sizeof(h), 1, fp );
+    fwrite( c.code.data(), 1, c.code.size(), fp );
+    fclose( fp );
+
+    printf( "%s: %zu bytes\n", out, sizeof(h) + c.code.size() );
+    return true;
+}
+
+static bool
+list( const char *in ) {
+    FILE *fp = fopen( in, "rb" );
+    if( fp == nullptr ) {
+      perror( in );
+      return false;
+    }
+
+    script::header       h;
+    std::vector<uint8_t> code;
+    if( fread( &h, sizeof(h), 1, fp ) == 1 && h.magic == script::MAGIC ) {
+      code.resize( h.size );
+      code.resize( fread( code.data(), 1, h.size, fp ) );
+    }
+    fclose( fp );
+    if( h.magic != script::MAGIC || code.size() != h.size ) {
+      fprintf( stderr, "%s: not a script\n", in );
+      return false;
+    }
+
+    for( size_t pc=0;pc<code.size(); ) {
+      uint8_t op = code[pc];
+      if( op >= (uint8_t)opcode::count ) {
+        printf( "%04zx  bad opcode %d\n", pc, op );
+        return false;
+      }
+      printf( "%04zx  %-16s", pc++, opcodes[op].name );
+      for( const char *f=opcodes[op].format;*f && pc<code.size();f++ ) {
+        if( *f == 'f' ) {
+          float x;
+          memcpy( &x, &code[pc], 4 );
+          printf( " %g", x );
+          pc += 4;
+        }
+        else if( *f == 'c' || *f == 'o' ) {
+          int16_t x = (int16_t)( code[pc] | ( code[pc+1] << 8 ) );
+          printf( " %d", *f == 'c' ? (uint16_t)x : x );
+          pc += 2;
+        }
+        else
+          printf( " %s%u", *f == 'd' ? "@" : "", code[pc++] );
+      }
+      printf( "\n" );
+    }
+    return true;
+}
+
+int
+main( int argc, char **argv ) {
+    if( argc == 3 && strcmp( argv[1], "-l" ) == 0 )
+      return list( argv[2] ) ? 0 : 1;
+    if( argc != 3 ) {
+      fprintf( stderr, "usage: scriptc routine.txt routine.bin\n" );
+      fprintf( stderr, "       scriptc -l routine.bin\n" );
+      return 2;
+    }
+    return compile( argv[1], argv[2] ) ? 0 : 1;
+}
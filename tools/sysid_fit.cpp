@@ -0,0 +1,249 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     sysid_fit.cpp                                               */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    sysid_fit.cpp
+  * @brief   Host side fitter for logs written by vex::sysid::save
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o sysid_fit sysid_fit.cpp
+// usage:  sysid_fit sysid.csv [window]
+//
+// The brain does a plain central difference for acceleration, on the PC
+// we can afford a smoothed derivative.  Velocity is differentiated with a
+// least squares slope over +/- window samples (default 2) which removes most
+// of the quantization noise in the kA term.  Fits are reported for the
+// quasistatic runs, the dynamic runs and everything combined.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct sample {
+    double    time;         // s, device timestamp
+    int       test;
+    int       run;
+    double    voltage;      // V
+    double    position;     // deg
+    double    velocity;     // rpm
+    double    current;      // A
+    double    accel;        // rpm/s, computed
+    bool      valid;
+};
+
+struct fit {
+    double    kS, kV, kA, r2;
+    int       n;
+};
+
+static const double  MIN_FIT_VELOCITY = 1.0;
+static const double  MAX_VOLTAGE      = 12.0;
+
+static bool
+readLog( const char *name, std::vector<sample> &log, int &gearset ) {
+    FILE *fp = fopen( name, "r" );
+    if( fp == nullptr ) {
+      perror( name );
+      return false;
+    }
+
+    char line[256];
+    gearset = -1;
+    while( fgets( line, sizeof(line), fp ) != nullptr ) {
+      if( line[0] == '#' ) {
+        const char *g = strstr( line, "gearset=" );
+        if( g != nullptr )
+          gearset = atoi( g + 8 );
+        continue;
+      }
+      if( line[0] < '0' || line[0] > '9' )
+        continue;
+
+      unsigned long time, timestamp;
+      int  test, run, mv;
+      double pos, vel;
+      long ma;
+      if( sscanf( line, "%lu,%lu,%d,%d,%d,%lf,%lf,%ld", &time, &timestamp, &test, &run, &mv, &pos, &vel, &ma ) != 8 )
+        continue;
+
+      sample s;
+      s.time     = timestamp / 1000.0;
+      s.test     = test;
+      s.run      = run;
+      s.voltage  = mv / 1000.0;
+      s.position = pos;
+      s.velocity = vel;
+      s.current  = ma / 1000.0;
+      s.accel    = 0;
+      s.valid    = false;
+      log.push_back( s );
+    }
+
+    fclose( fp );
+    return true;
+}
+
+// least squares slope of velocity against time over a window within one run
+static void
+differentiate( std::vector<sample> &log, int window ) {
+    for( size_t i = 0; i < log.size(); i++ ) {
+      double st = 0, sv = 0, stt = 0, stv = 0;
+      int    n  = 0;
+      for( int k = -window; k <= window; k++ ) {
+        long j = (long)i + k;
+        if( j < 0 || j >= (long)log.size() || log[j].run != log[i].run )
+          continue;
+        double t = log[j].time - log[i].time;
+        st  += t;
+        sv  += log[j].velocity;
+        stt += t * t;
+        stv += t * log[j].velocity;
+        n++;
+      }
+      double d = n * stt - st * st;
+      if( n < 3 || d <= 0 )
+        continue;
+      log[i].accel = ( n * stv - st * sv ) / d;
+      log[i].valid = true;
+    }
+}
+
+static bool
+solve3( double a[3][3], double b[3], double x[3] ) {
+    double m[3][4];
+    for( int j = 0; j < 3; j++ ) {
+      for( int k = 0; k < 3; k++ )
+        m[j][k] = a[j][k];
+      m[j][3] = b[j];
+    }
+    for( int c = 0; c < 3; c++ ) {
+      int p = c;
+      for( int j = c + 1; j < 3; j++ )
+        if( fabs( m[j][c] ) > fabs( m[p][c] ) )
+          p = j;
+      if( fabs( m[p][c] ) < 1e-12 )
+        return false;
+      for( int k = 0; k < 4; k++ )
+        std::swap( m[c][k], m[p][k] );
+      for( int j = 0; j < 3; j++ ) {
+        if( j == c )
+          continue;
+        double f = m[j][c] / m[c][c];
+        for( int k = c; k < 4; k++ )
+          m[j][k] -= f * m[c][k];
+      }
+    }
+    for( int j = 0; j < 3; j++ )
+      x[j] = m[j][3] / m[j][j];
+    return true;
+}
+
+// test < 0 selects every sample
+static fit
+fitModel( const std::vector<sample> &log, int test ) {
+    fit    f = { 0, 0, 0, 0, 0 };
+    double ata[3][3] = {{0}};
+    double atb[3] = { 0 };
+    double sy = 0, syy = 0;
+
+    for( const sample &s : log ) {
+      if( !s.valid || ( test >= 0 && s.test != test ) )
+        continue;
+      if( fabs( s.velocity ) < MIN_FIT_VELOCITY || s.voltage == 0 )
+        continue;
+
+      double x[3] = { s.velocity > 0 ? 1.0 : -1.0, s.velocity, s.accel };
+      for( int j = 0; j < 3; j++ ) {
+        for( int k = 0; k < 3; k++ )
+          ata[j][k] += x[j] * x[k];
+        atb[j] += x[j] * s.voltage;
+      }
+      sy  += s.voltage;
+      syy += s.voltage * s.voltage;
+      f.n++;
+    }
+
+    double beta[3];
+    if( f.n < 3 || !solve3( ata, atb, beta ) ) {
+      f.n = 0;
+      return f;
+    }
+
+    f.kS = beta[0];
+    f.kV = beta[1];
+    f.kA = beta[2];
+
+    double sse = syy;
+    for( int j = 0; j < 3; j++ ) {
+      sse -= 2 * beta[j] * atb[j];
+      for( int k = 0; k < 3; k++ )
+        sse += beta[j] * beta[k] * ata[j][k];
+    }
+    double sst = syy - sy * sy / f.n;
+    f.r2 = sst > 0 ? 1.0 - sse / sst : 0;
+    return f;
+}
+
+static void
+report( const char *label, const fit &f, double nominal ) {
+    if( f.n == 0 ) {
+      printf( "%-12s not enough data\n", label );
+      return;
+    }
+    if( f.kV <= 1e-9 ) {
+      // a single step in one direction has a constant voltage and sign
+      // column, kS absorbs everything
+      printf( "%-12s degenerate, combine with a quasistatic run\n", label );
+      return;
+    }
+
+    printf( "%-12s n=%-6d kS=%8.4f V  kV=%10.6f V/rpm  kA=%10.6f V/(rpm/s)  r2=%.4f\n",
+            label, f.n, f.kS, f.kV, f.kA, f.r2 );
+
+    double free = ( MAX_VOLTAGE - f.kS ) / f.kV;
+    printf( "%-12s free speed %.1f rpm", "", free );
+    if( nominal > 0 )
+      printf( " (%.0f%% of %.0f rpm cartridge)", 100.0 * free / nominal, nominal );
+    printf( ", time constant %.1f ms\n", 1000.0 * f.kA / f.kV );
+}
+
+int
+main( int argc, char **argv ) {
+    if( argc < 2 ) {
+      fprintf( stderr, "usage: %s sysid.csv [window]\n", argv[0] );
+      return 1;
+    }
+
+    int window = ( argc > 2 ) ? atoi( argv[2] ) : 2;
+    if( window < 1 )
+      window = 1;
+
+    std::vector<sample> log;
+    int gearset;
+    if( !readLog( argv[1], log, gearset ) )
+      return 1;
+    if( log.empty() ) {
+      fprintf( stderr, "%s: no samples\n", argv[1] );
+      return 1;
+    }
+
+    differentiate( log, window );
+
+    // kMotorGearSet_36, _18 and _06 free speeds
+    static const double nominal[] = { 100.0, 200.0, 600.0 };
+    double rpm = ( gearset >= 0 && gearset <= 2 ) ? nominal[gearset] : 0;
+
+    printf( "%s: %zu samples, gearset %d\n", argv[1], log.size(), gearset );
+    report( "quasistatic", fitModel( log, 0 ), rpm );
+    report( "dynamic",     fitModel( log, 1 ), rpm );
+    report( "combined",    fitModel( log, -1 ), rpm );
+    return 0;
+}
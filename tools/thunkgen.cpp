@@ -0,0 +1,451 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     thunkgen.cpp                                                */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    thunkgen.cpp
+  * @brief   Generates jumptable offsets and inline thunks from firmware_offsets.txt
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -o thunkgen thunkgen.cpp
+// usage:  thunkgen firmware_offsets.txt pub/v5_api.h > priv/vex_thunks.h
+//         thunkgen --sort firmware_offsets.txt
+//
+// Every function in the offsets file becomes a constexpr offset in
+// vex::offsets.  Functions that are also declared in one of the headers
+// get an always inline thunk in vex::fast with the same signature, it
+// loads the target straight from the jumptable and calls it, skipping the
+// libv5rt thunk and __vex_function_prolog.  Variadic functions are left
+// out, use their va_list forms.
+//
+// vex::offsets::symbols lists the same names sorted for lookup by name at
+// run time, as vex::module does when it binds a payload's imports.
+// Variadic functions are not in it, their slot holds the va_list form.
+//
+// Names that share an offset are aliases, the first one in the file is
+// kept as the primary and the others are reported.  A name listed twice
+// with different offsets, or an offset outside the table, is an error.
+// So are aliases whose prototypes differ, other than a variadic function
+// sharing the slot of its va_list form.
+//
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+struct entry {
+    std::string   name;
+    uint32_t      offset;
+    int           line;
+    std::string   alias;        // primary name when this shares an offset
+};
+
+struct prototype {
+    std::string               ret;
+    std::string               params;
+    std::vector<std::string>  names;
+    std::vector<std::string>  types;        // ... is listed as va_list
+    bool                      variadic;
+};
+
+static const uint32_t  TABLE_BASE = 0x037FC000;
+static const uint32_t  TABLE_SIZE = 0x1000;
+
+static std::string
+trim( const std::string &s ) {
+    size_t a = s.find_first_not_of( " \t\r\n" );
+    size_t b = s.find_last_not_of( " \t\r\n" );
+    return ( a == std::string::npos ) ? std::string() : s.substr( a, b - a + 1 );
+}
+
+static std::string
+squeeze( const std::string &s ) {
+    std::string out;
+    bool        space = false;
+    for( char c : s ) {
+      if( isspace( (unsigned char)c ) ) {
+        space = !out.empty();
+        continue;
+      }
+      if( space )
+        out += ' ';
+      out += c;
+      space = false;
+    }
+    return out;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  firmware_offsets.txt                                             */
+/*---------------------------------------------------------------------------*/
+
+static bool
+readOffsets( const char *name, std::vector<entry> &entries ) {
+    FILE *fp = fopen( name, "r" );
+    if( fp == nullptr ) {
+      perror( name );
+      return false;
+    }
+
+    std::map<std::string, size_t>  byName;
+    std::map<uint32_t, size_t>     byOffset;
+    bool  ok = true;
+    char  line[256];
+    int   n  = 0;
+
+    while( fgets( line, sizeof(line), fp ) != nullptr ) {
+      n++;
+      char id[128];
+      char value[64];
+      if( line[0] == '#' || sscanf( line, "%127s %63s", id, value ) != 2 )
+        continue;
+
+      // vexos+ lines are data addresses, the newlib hooks such as _write_user are slots
+      if( ( strncmp( id, "vex", 3 ) != 0 && id[0] != '_' ) || strchr( id, '+' ) != nullptr )
+        continue;
+
+      entry e;
+      e.name   = id;
+      e.offset = (uint32_t)strtoul( value, nullptr, 16 );
+      e.line   = n;
+
+      if( e.offset >= TABLE_SIZE || (e.offset & 3) != 0 ) {
+        fprintf( stderr, "%s:%d: %s offset 0x%x is not a table slot\n", name, n, id, e.offset );
+        ok = false;
+        continue;
+      }
+
+      auto dup = byName.find( e.name );
+      if( dup != byName.end() ) {
+        const entry &d = entries[ dup->second ];
+        if( d.offset != e.offset ) {
+          fprintf( stderr, "%s:%d: %s at 0x%03x, already at 0x%03x on line %d\n", name, n, id, e.offset, d.offset, d.line );
+          ok = false;
+        }
+        continue;
+      }
+
+      auto same = byOffset.find( e.offset );
+      if( same != byOffset.end() ) {
+        e.alias = entries[ same->second ].name;
+        fprintf( stderr, "%s:%d: %s is an alias of %s at 0x%03x\n", name, n, id, e.alias.c_str(), e.offset );
+      }
+      else
+        byOffset[ e.offset ] = entries.size();
+
+      byName[ e.name ] = entries.size();
+      entries.push_back( e );
+    }
+
+    fclose( fp );
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Prototypes                                                       */
+/*---------------------------------------------------------------------------*/
+
+// the parameter name is the last identifier, or the one after (* for a function pointer
+static std::string
+paramName( const std::string &p ) {
+    size_t fp = p.find( "(*" );
+    size_t i  = ( fp != std::string::npos ) ? fp + 2 : p.size();
+
+    if( fp != std::string::npos ) {
+      while( i < p.size() && isspace( (unsigned char)p[i] ) )
+        i++;
+      size_t s = i;
+      while( i < p.size() && ( isalnum( (unsigned char)p[i] ) || p[i] == '_' ) )
+        i++;
+      return p.substr( s, i - s );
+    }
+
+    std::string q = p.substr( 0, p.find( '[' ) );
+    size_t e = q.find_last_not_of( " \t" );
+    if( e == std::string::npos )
+      return std::string();
+    size_t s = e;
+    while( s > 0 && ( isalnum( (unsigned char)p[s-1] ) || p[s-1] == '_' ) )
+      s--;
+    std::string name = p.substr( s, e - s + 1 );
+    if( name.empty() || !( isalpha( (unsigned char)name[0] ) || name[0] == '_' ) )
+      return std::string();
+
+    // a lone type such as "V5_DeviceT" has no name
+    std::string before = trim( p.substr( 0, s ) );
+    if( before.empty() || before == "const" || before == "struct" || before == "unsigned" )
+      return std::string();
+    return name;
+}
+
+static void
+readPrototypes( const char *name, std::map<std::string, prototype> &protos ) {
+    FILE *fp = fopen( name, "r" );
+    if( fp == nullptr ) {
+      perror( name );
+      return;
+    }
+
+    std::string text;
+    char        buf[4096];
+    size_t      n;
+    while( ( n = fread( buf, 1, sizeof(buf), fp ) ) > 0 )
+      text.append( buf, n );
+    fclose( fp );
+
+    // drop comments so they do not confuse the scan
+    for( size_t i=0;i<text.size();i++ ) {
+      if( text.compare( i, 2, "//" ) == 0 ) {
+        size_t e = text.find( '\n', i );
+        text.replace( i, ( e == std::string::npos ? text.size() : e ) - i, " " );
+      }
+      else if( text.compare( i, 2, "/*" ) == 0 ) {
+        size_t e = text.find( "*/", i + 2 );
+        text.replace( i, ( e == std::string::npos ? text.size() : e + 2 ) - i, " " );
+      }
+    }
+
+    size_t pos = 0;
+    while( ( pos = text.find( "vex", pos ) ) != std::string::npos ) {
+      size_t s = pos;
+      size_t e = s;
+      while( e < text.size() && ( isalnum( (unsigned char)text[e] ) || text[e] == '_' ) )
+        e++;
+      pos = e;
+
+      if( s > 0 && ( isalnum( (unsigned char)text[s-1] ) || text[s-1] == '_' ) )
+        continue;
+
+      size_t open = text.find_first_not_of( " \t", e );
+      if( open == std::string::npos || text[open] != '(' )
+        continue;
+
+      // the return type is everything back to the previous statement
+      size_t rs = text.find_last_of( ";{}#\n", s - 1 );
+      std::string ret = squeeze( text.substr( rs + 1, s - rs - 1 ) );
+      if( ret.empty() || ret.find( '=' ) != std::string::npos || ret.find( "return" ) != std::string::npos )
+        continue;
+
+      int    depth = 0;
+      size_t close = open;
+      for( ;close<text.size();close++ ) {
+        if( text[close] == '(' )
+          depth++;
+        else if( text[close] == ')' && --depth == 0 )
+          break;
+      }
+      size_t semi = text.find_first_not_of( " \t\r\n", close + 1 );
+      if( close >= text.size() || semi == std::string::npos || text[semi] != ';' )
+        continue;
+
+      prototype p;
+      p.ret    = ret;
+      p.params = squeeze( text.substr( open + 1, close - open - 1 ) );
+
+      std::string fn = text.substr( s, e - s );
+      if( protos.count( fn ) )
+        continue;
+
+      // split at top level commas
+      std::string cur;
+      depth = 0;
+      std::vector<std::string> parts;
+      for( char c : p.params ) {
+        if( c == '(' ) depth++;
+        if( c == ')' ) depth--;
+        if( c == ',' && depth == 0 ) {
+          parts.push_back( trim( cur ) );
+          cur.clear();
+        }
+        else
+          cur += c;
+      }
+      if( !trim( cur ).empty() )
+        parts.push_back( trim( cur ) );
+
+      if( parts.size() == 1 && parts[0] == "void" )
+        parts.clear();
+
+      std::string params;
+      p.variadic = false;
+      for( size_t i=0;i<parts.size();i++ ) {
+        if( parts[i] == "..." ) {
+          p.variadic = true;
+          p.types.push_back( "va_list" );
+          break;
+        }
+        std::string pn = paramName( parts[i] );
+        if( pn.empty() ) {
+          p.types.push_back( squeeze( parts[i] ) );
+          pn = "a" + std::to_string( i );
+          parts[i] += " " + pn;
+        }
+        else {
+          std::string t = parts[i];
+          t.erase( t.rfind( pn ), pn.size() );
+          p.types.push_back( squeeze( t ) );
+        }
+        p.names.push_back( pn );
+        params += ( i ? ", " : "" ) + parts[i];
+      }
+      p.params = params.empty() ? "void" : params;
+      protos[fn] = p;
+    }
+}
+
+// an alias calls the primary's code, it must take the same arguments
+static bool
+checkAliases( const char *name, const std::vector<entry> &entries, const std::map<std::string, prototype> &protos ) {
+    bool ok = true;
+
+    for( const entry &e : entries ) {
+      if( e.alias.empty() )
+        continue;
+
+      auto a = protos.find( e.name );
+      auto b = protos.find( e.alias );
+      if( a == protos.end() || b == protos.end() )
+        continue;
+
+      if( a->second.ret != b->second.ret || a->second.types != b->second.types ) {
+        fprintf( stderr, "%s:%d: %s shares 0x%03x with %s but the prototypes differ\n",
+                 name, e.line, e.name.c_str(), e.offset, e.alias.c_str() );
+        ok = false;
+      }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Output                                                           */
+/*---------------------------------------------------------------------------*/
+
+static void
+emit( const std::vector<entry> &entries, const std::map<std::string, prototype> &protos ) {
+    size_t width = 0;
+    for( const entry &e : entries )
+      width = std::max( width, e.name.size() );
+
+    printf( "/*----------------------------------------------------------------------------*/\n" );
+    printf( "/*                                                                            */\n" );
+    printf( "/*    Module:     vex_thunks.h                                                */\n" );
+    printf( "/*                                                                            */\n" );
+    printf( "/*    Generated by tools/thunkgen.cpp from firmware_offsets.txt, do not edit  */\n" );
+    printf( "/*                                                                            */\n" );
+    printf( "/*----------------------------------------------------------------------------*/\n\n" );
+    printf( "#ifndef   VEX_THUNKS_H\n" );
+    printf( "#define   VEX_THUNKS_H\n\n" );
+    printf( "#include <cstdint>\n\n" );
+    printf( "/*-----------------------------------------------------------------------------*/\n" );
+    printf( "/** @file    vex_thunks.h\n" );
+    printf( "  * @brief   Jumptable offsets and inline thunks\n" );
+    printf( "*//*---------------------------------------------------------------------------*/\n\n" );
+
+    printf( "namespace vex {\n" );
+    printf( "  namespace offsets {\n" );
+    printf( "    constexpr uint32_t %-*s = 0x%08X;\n", (int)width, "TABLE_BASE", TABLE_BASE );
+    printf( "\n" );
+    for( const entry &e : entries ) {
+      printf( "    constexpr uint32_t %-*s = 0x%03x;", (int)width, e.name.c_str(), e.offset );
+      if( !e.alias.empty() )
+        printf( "    // alias of %s", e.alias.c_str() );
+      printf( "\n" );
+    }
+
+    // variadic functions share a slot with their va_list form, binding one by name would call it wrong
+    std::vector<const entry *> named;
+    for( const entry &e : entries ) {
+      auto p = protos.find( e.name );
+      if( p == protos.end() || !p->second.variadic )
+        named.push_back( &e );
+    }
+    std::sort( named.begin(), named.end(), []( const entry *a, const entry *b ) {
+      return strcmp( a->name.c_str(), b->name.c_str() ) < 0;
+    } );
+
+    printf( "\n" );
+    printf( "    typedef struct _symbol {\n" );
+    printf( "      const char   *name;\n" );
+    printf( "      uint32_t      offset;\n" );
+    printf( "    } symbol;\n\n" );
+    printf( "    // every name above in strcmp order, variadic functions left out\n" );
+    printf( "    constexpr uint32_t SYMBOL_COUNT = %zu;\n", named.size() );
+    printf( "    constexpr symbol   symbols[SYMBOL_COUNT] = {\n" );
+    for( const entry *e : named )
+      printf( "      { %-*s 0x%03x },\n", (int)width + 3, ( "\"" + e->name + "\"," ).c_str(), e->offset );
+    printf( "    };\n" );
+    printf( "  };\n\n" );
+
+    printf( "  namespace fast {\n" );
+    printf( "    template <typename F>\n" );
+    printf( "    [[gnu::always_inline]] inline F slot( uint32_t offset ) {\n" );
+    printf( "      return( reinterpret_cast<F>( *reinterpret_cast<void * const *>( offsets::TABLE_BASE + offset ) ) );\n" );
+    printf( "    }\n" );
+
+    int thunks = 0;
+    for( const entry &e : entries ) {
+      auto p = protos.find( e.name );
+      if( p == protos.end() || p->second.variadic )
+        continue;
+
+      std::string args;
+      for( size_t i=0;i<p->second.names.size();i++ )
+        args += ( i ? ", " : "" ) + p->second.names[i];
+
+      printf( "\n    [[gnu::always_inline]] inline %s %s( %s ) {\n", p->second.ret.c_str(), e.name.c_str(), p->second.params.c_str() );
+      printf( "      %sslot<%s (*)( %s )>( offsets::%s )( %s );\n",
+              p->second.ret == "void" ? "" : "return ",
+              p->second.ret.c_str(), p->second.params.c_str(), e.name.c_str(), args.c_str() );
+      printf( "    }\n" );
+      thunks++;
+    }
+    printf( "  };\n" );
+    printf( "};\n\n" );
+    printf( "#endif // VEX_THUNKS_H\n" );
+
+    fprintf( stderr, "%zu offsets, %zu symbols, %d thunks\n", entries.size(), named.size(), thunks );
+}
+
+int
+main( int argc, char **argv ) {
+    bool sort = ( argc > 1 && strcmp( argv[1], "--sort" ) == 0 );
+    int  first = sort ? 2 : 1;
+
+    if( argc <= first ) {
+      fprintf( stderr, "usage: thunkgen firmware_offsets.txt [header.h ...] > vex_thunks.h\n" );
+      fprintf( stderr, "       thunkgen --sort firmware_offsets.txt\n" );
+      return 2;
+    }
+
+    std::vector<entry> entries;
+    bool ok = readOffsets( argv[first], entries );
+
+    std::stable_sort( entries.begin(), entries.end(), []( const entry &a, const entry &b ) {
+      return a.offset < b.offset;
+    } );
+
+    if( sort ) {
+      for( const entry &e : entries )
+        printf( "%-36s 0x%03x\n", e.name.c_str(), e.offset );
+      return ok ? 0 : 1;
+    }
+
+    std::map<std::string, prototype> protos;
+    for( int i=first+1;i<argc;i++ )
+      readPrototypes( argv[i], protos );
+
+    if( !checkAliases( argv[first], entries, protos ) )
+      return 1;
+
+    emit( entries, protos );
+    return ok ? 0 : 1;
+}
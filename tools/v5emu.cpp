@@ -0,0 +1,1058 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:     v5emu.cpp                                                   */
+/*    Created:    18 Oct 2026                                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/** @file    v5emu.cpp
+  * @brief   Runs V5 user program binaries on the host against a host v5_api
+*//*---------------------------------------------------------------------------*/
+//
+// build:  g++ -std=c++17 -O2 -I../pub -I../priv -o v5emu v5emu.cpp
+// usage:  v5emu [--offsets firmware_offsets.txt] [--ms 60000] [--competition n]
+//               [--sd dir] [--stats] program.bin | program.elf
+//
+// Loads the program as the brain does, a raw .bin at 0x03800000 or the
+// PT_LOAD segments of an ELF, and runs it from vexStartup with libv5rt
+// linked in, exactly as deployed.  Every jumptable slot points outside
+// guest memory, a call through the table returns to the host which runs
+// the host implementation of the call, then continues at lr.
+//
+// Time is virtual.  It advances with the instructions run, at the rate of
+// the brain, and jumps forward when every task is asleep, so a program
+// that waits runs as fast as the host allows.  --ms stops the run after
+// that much virtual time.
+//
+// Tasks are cooperative as on the brain.  Each task added by
+// vexTaskAdd has its own register state and stack, vexTasksRun in the
+// firmware loop of libv5rt switches to the next task that is ready and
+// vexTaskSleep or vexTaskYield switches back.
+//
+// Calls that are not implemented here are reported once and return 0.
+// Exit status is 0 when the program exits or the time runs out and 1 on
+// a fault.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "v5_api.h"
+#include "vex_thunks.h"
+
+#include "a32.h"
+#include "fwimage.h"
+
+static const uint32_t RAM_BASE       = 0x03000000;
+static const uint32_t RAM_SIZE       = 0x06000000;     // to 0x09000000
+static const uint32_t USER_BASE      = 0x03800000;
+static const uint32_t USER_ENTRY     = 0x03800020;     // after vexCodeSig
+static const uint32_t VERSION_BASE   = vex::offsets::TABLE_BASE + 0x1000;
+static const uint32_t SYSTEM_VERSION = 0x01010200;     // 1.1.2.0
+
+// above the user image, the brain has firmware memory here instead
+static const uint32_t STACK_BASE     = 0x08000000;
+static const uint32_t STACK_SIZE     = 0x00040000;
+static const uint32_t MAX_TASKS      = 59;
+static const uint32_t LOOP_STACK     = STACK_BASE + STACK_SIZE * ( MAX_TASKS + 1 );
+static const uint32_t HOST_BASE      = LOOP_STACK;     // objects handed to the program
+static const uint32_t HOST_END       = RAM_BASE + RAM_SIZE;
+
+static const uint32_t TRAP_BASE      = 0x0F000000;     // slot offset is added
+static const uint32_t HALT           = TRAP_BASE + 0x1000;
+static const uint32_t TASK_EXIT      = TRAP_BASE + 0x1004;
+
+static const uint64_t SLICE          = 1000000;        // instructions between checks
+static const uint32_t CORE_MHZ       = 667;            // one instruction a cycle
+static const uint64_t TIMESLICE      = 1000;           // uS, assumed
+static const uint32_t POLL_GAP       = 200;            // instructions between polls
+static const uint32_t POLL_STREAK    = 16;
+
+static a32::core  cpu( RAM_BASE, RAM_SIZE );
+static a32::state reset;
+
+static uint64_t   skipped;                             // uS jumped while asleep
+static uint32_t   competition;
+static std::string sdRoot = ".";
+static bool       halted;
+static const char *haltReason = "";
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Guest memory helpers                                             */
+/*---------------------------------------------------------------------------*/
+
+static uint64_t
+now() {
+    return skipped + cpu.instructions / CORE_MHZ;
+}
+
+static uint32_t hostNext = HOST_BASE;
+
+static void *
+hostAlloc( uint32_t size ) {
+    uint32_t a = ( hostNext + 7 ) & ~7u;
+    if( a + size > HOST_END )
+      throw a32::fault{ cpu.s.r[15], a, "host object area full" };
+    hostNext = a + size;
+    return cpu.ptr( a, size );
+}
+
+static const char *
+text( uint32_t a ) {
+    if( a == 0 )
+      return nullptr;
+    const char *p = (const char *)cpu.ptr( a, 1 );
+    if( memchr( p, 0, RAM_BASE + RAM_SIZE - a ) == nullptr )
+      throw a32::fault{ cpu.s.r[15], a, "unterminated string" };
+    return p;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  AAPCS arguments, softfp                                          */
+/*---------------------------------------------------------------------------*/
+
+struct abi {
+    uint32_t    ncrn = 0;                  // next core register
+    uint32_t    nsaa;                      // next stacked argument
+
+    abi() : nsaa( cpu.s.r[13] ) {}
+
+    // a va_list is the address of the next argument
+    explicit abi( uint32_t ap ) : ncrn( 4 ), nsaa( ap ) {}
+
+    uint32_t word() {
+      if( ncrn < 4 )
+        return cpu.s.r[ ncrn++ ];
+      uint32_t v = cpu.rd32( nsaa );
+      nsaa += 4;
+      return v;
+    }
+    uint64_t dword() {
+      ncrn = ( ncrn + 1 ) & ~1u;
+      if( ncrn < 4 ) {
+        uint64_t v = (uint64_t)cpu.s.r[ ncrn + 1 ] << 32 | cpu.s.r[ ncrn ];
+        ncrn += 2;
+        return v;
+      }
+      ncrn = 4;
+      nsaa = ( nsaa + 7 ) & ~7u;
+      uint64_t v = cpu.rd64( nsaa );
+      nsaa += 8;
+      return v;
+    }
+};
+
+template <typename T, typename = void>
+struct argument {
+    static T get( abi &a ) {
+      static_assert( sizeof(T) <= 4, "argument type not supported" );
+      return (T)a.word();
+    }
+};
+
+template <typename T>
+struct argument<T, typename std::enable_if<std::is_integral<T>::value && sizeof(T) == 8>::type> {
+    static T get( abi &a ) { return (T)a.dword(); }
+};
+
+template <>
+struct argument<double> {
+    static double get( abi &a ) { uint64_t v = a.dword(); double d; memcpy( &d, &v, 8 ); return d; }
+};
+
+template <>
+struct argument<float> {
+    static float get( abi &a ) { uint32_t v = a.word(); float f; memcpy( &f, &v, 4 ); return f; }
+};
+
+template <typename T>
+struct argument<T *> {
+    static T *get( abi &a ) {
+      uint32_t p = a.word();
+      return p == 0 ? nullptr : (T *)cpu.ptr( p, 1 );
+    }
+};
+
+template <typename T>
+static void
+result( T v ) {
+    if constexpr( std::is_pointer<T>::value ) {
+      const uint8_t *p = (const uint8_t *)v;
+      cpu.s.r[0] = p >= cpu.mem && p < cpu.mem + RAM_SIZE ? cpu.guest( p ) : 0;
+    }
+    else if constexpr( std::is_same<T, double>::value || sizeof(T) == 8 ) {
+      uint64_t x;
+      memcpy( &x, &v, 8 );
+      cpu.s.r[0] = (uint32_t)x;
+      cpu.s.r[1] = (uint32_t)( x >> 32 );
+    }
+    else if constexpr( std::is_same<T, float>::value )
+      memcpy( &cpu.s.r[0], &v, 4 );
+    else
+      cpu.s.r[0] = (uint32_t)v;
+}
+
+// calls a host function with the prototype from v5_api.h
+template <typename F, F fn>
+struct service;
+
+template <typename R, typename... A, R (*fn)( A... )>
+struct service<R (*)( A... ), fn> {
+    static void call() {
+      abi a;
+      std::tuple<A...> args{ argument<A>::get( a )... };     // braces keep the order
+      if constexpr( std::is_void<R>::value )
+        std::apply( fn, args );
+      else
+        result<R>( std::apply( fn, args ) );
+    }
+};
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Guest formatting                                                 */
+/*---------------------------------------------------------------------------*/
+
+static std::string
+format( const char *fmt, abi &a ) {
+    std::string out;
+    char        spec[32];
+    char        buffer[512];
+
+    for( const char *p=fmt;*p;p++ ) {
+      if( *p != '%' ) {
+        out += *p;
+        continue;
+      }
+      if( p[1] == '%' ) {
+        out += '%';
+        p++;
+        continue;
+      }
+
+      // flags, width and precision are copied, * takes an argument
+      size_t n = 0;
+      spec[n++] = *p++;
+      while( *p && strchr( "-+ #0", *p ) && n < 20 )
+        spec[n++] = *p++;
+      for( int part=0;part<2;part++ ) {
+        if( part == 1 ) {
+          if( *p != '.' )
+            break;
+          spec[n++] = *p++;
+        }
+        if( *p == '*' ) {
+          n += snprintf( spec + n, sizeof(spec) - n, "%d", (int32_t)a.word() );
+          p++;
+        }
+        while( *p >= '0' && *p <= '9' && n < 28 )
+          spec[n++] = *p++;
+      }
+
+      int longs = 0;
+      while( *p && strchr( "hlLqjzt", *p ) ) {
+        if( *p == 'l' || *p == 'q' || *p == 'L' || *p == 'j' )
+          longs++;
+        p++;
+      }
+      if( *p == 0 )
+        break;
+
+      char conversion = *p;
+      spec[n] = 0;
+      switch( conversion ) {
+        case 'd': case 'i':
+          strcat( spec, "lld" );
+          snprintf( buffer, sizeof(buffer), spec, longs > 1 ? (long long)(int64_t)a.dword() : (long long)(int32_t)a.word() );
+          break;
+        case 'u': case 'x': case 'X': case 'o':
+          spec[n] = 'l';
+          spec[n + 1] = 'l';
+          spec[n + 2] = conversion;
+          spec[n + 3] = 0;
+          snprintf( buffer, sizeof(buffer), spec, longs > 1 ? (unsigned long long)a.dword() : (unsigned long long)a.word() );
+          break;
+        case 'c':
+          strcat( spec, "c" );
+          snprintf( buffer, sizeof(buffer), spec, (int)a.word() );
+          break;
+        case 'p':
+          snprintf( buffer, sizeof(buffer), "0x%08x", a.word() );
+          break;
+        case 's': {
+          const char *s = text( a.word() );
+          strcat( spec, "s" );
+          snprintf( buffer, sizeof(buffer), spec, s ? s : "(null)" );
+          break;
+        }
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+          uint64_t v = a.dword();
+          double   d;
+          memcpy( &d, &v, 8 );
+          spec[n] = conversion;
+          spec[n + 1] = 0;
+          snprintf( buffer, sizeof(buffer), spec, d );
+          break;
+        }
+        case 'n':
+          a.word();
+          buffer[0] = 0;
+          break;
+        default:
+          snprintf( buffer, sizeof(buffer), "%s%c", spec, conversion );
+          break;
+      }
+      out += buffer;
+    }
+    return out;
+}
+
+static int32_t
+store( uint32_t out, uint32_t max, const std::string &s ) {
+    if( out != 0 && max != 0 ) {
+      uint32_t n = (uint32_t)std::min<size_t>( s.size(), max - 1 );
+      uint8_t *p = cpu.ptr( out, n + 1 );
+      memcpy( p, s.data(), n );
+      p[n] = 0;
+      cpu.written( out, n + 1 );
+    }
+    return (int32_t)s.size();
+}
+
+// vex_printf and friends call these slots with a va_list
+static void
+vprintfService() {
+    abi a( cpu.s.r[1] );
+    std::string s = format( text( cpu.s.r[0] ), a );
+    fwrite( s.data(), 1, s.size(), stdout );
+    cpu.s.r[0] = (uint32_t)s.size();
+}
+
+static void
+vsprintfService() {
+    abi a( cpu.s.r[2] );
+    std::string s = format( text( cpu.s.r[1] ), a );
+    cpu.s.r[0] = (uint32_t)store( cpu.s.r[0], RAM_BASE + RAM_SIZE - cpu.s.r[0], s );
+}
+
+static void
+vsnprintfService() {
+    abi a( cpu.s.r[3] );
+    std::string s = format( text( cpu.s.r[2] ), a );
+    cpu.s.r[0] = (uint32_t)store( cpu.s.r[0], cpu.s.r[1], s );
+}
+
+// screen text goes to stdout, one line per call
+static void
+screen( const char *where, uint32_t fmt, uint32_t ap ) {
+    abi a( ap );
+    std::string s = format( text( fmt ), a );
+    printf( "[screen %s] %s\n", where, s.c_str() );
+}
+
+static void
+displayLineService() {
+    char where[16];
+    snprintf( where, sizeof(where), "line %d", (int32_t)cpu.s.r[0] );
+    screen( where, cpu.s.r[1], cpu.s.r[2] );
+}
+
+static void
+displayAtService() {
+    char where[32];
+    snprintf( where, sizeof(where), "%d,%d", (int32_t)cpu.s.r[0], (int32_t)cpu.s.r[1] );
+    screen( where, cpu.s.r[2], cpu.s.r[3] );
+}
+
+static void
+displayPrintfService() {
+    char where[32];
+    snprintf( where, sizeof(where), "%d,%d", (int32_t)cpu.s.r[0], (int32_t)cpu.s.r[1] );
+    screen( where, cpu.s.r[3], cpu.rd32( cpu.s.r[13] ) );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Host v5_api.h                                                    */
+/*---------------------------------------------------------------------------*/
+
+static uint8_t             *devices;
+static std::map<uint32_t, FILE *> files;
+
+uint64_t
+vexSystemHighResTimeGet( void ) {
+    return( now() );
+}
+
+uint64_t
+vexSystemPowerupTimeGet( void ) {
+    return( now() );
+}
+
+// a loop that only polls the time moves it to the next mS
+uint32_t
+vexSystemTimeGet( void ) {
+    static uint64_t last;
+    static uint32_t streak;
+    streak = cpu.instructions - last < POLL_GAP ? streak + 1 : 0;
+    last   = cpu.instructions;
+    if( streak >= POLL_STREAK )
+      skipped += 1000 - now() % 1000;
+    return( (uint32_t)( now() / 1000 ) );
+}
+
+uint32_t
+vexDevicesGetNumber( void ) {
+    return( 0 );
+}
+
+V5_DeviceT
+vexDevicesGet( void ) {
+    return( (V5_DeviceT)devices );
+}
+
+V5_DeviceT
+vexDeviceGetByIndex( uint32_t index ) {
+    return( (V5_DeviceT)&devices[ index % V5_MAX_DEVICE_PORTS ] );
+}
+
+int32_t
+vexDeviceGetStatus( V5_DeviceType *buffer ) {
+    memset( buffer, 0, sizeof(V5_DeviceTypeBuffer) );
+    return( 0 );
+}
+
+int32_t
+vexDeviceGetTimestamp( V5_DeviceT ) {
+    return( (int32_t)vexSystemTimeGet() );
+}
+
+int32_t
+vexControllerGet( V5_ControllerId, V5_ControllerIndex ) {
+    return( 0 );
+}
+
+V5_ControllerStatus
+vexControllerConnectionStatusGet( V5_ControllerId ) {
+    return( kV5ControllerOffline );
+}
+
+uint32_t
+vexCompetitionStatus( void ) {
+    return( competition );
+}
+
+/*---------------------------------------------------------------------------*/
+/* files live under --sd, FIL is a cell in guest memory                      */
+/*---------------------------------------------------------------------------*/
+
+static FIL *
+openFile( const char *filename, const char *mode ) {
+    if( filename == nullptr )
+      return( nullptr );
+    std::string path = sdRoot + "/" + filename;
+    FILE *fp = fopen( path.c_str(), mode );
+    if( fp == nullptr )
+      return( nullptr );
+    void *cell = hostAlloc( 4 );
+    files[ cpu.guest( cell ) ] = fp;
+    return( (FIL *)cell );
+}
+
+static FILE *
+file( FIL *fdp ) {
+    auto f = fdp == nullptr ? files.end() : files.find( cpu.guest( fdp ) );
+    return( f == files.end() ? nullptr : f->second );
+}
+
+FRESULT   vexFileMountSD( void )                                      { return( FR_OK ); }
+bool      vexFileDriveStatus( uint32_t )                              { return( true ); }
+FIL      *vexFileOpen( const char *filename, const char * )           { return( openFile( filename, "rb" ) ); }
+FIL      *vexFileOpenWrite( const char *filename )                    { return( openFile( filename, "wb" ) ); }
+FIL      *vexFileOpenCreate( const char *filename )                   { return( openFile( filename, "wb" ) ); }
+
+void
+vexFileClose( FIL *fdp ) {
+    FILE *fp = file( fdp );
+    if( fp != nullptr ) {
+      fclose( fp );
+      files.erase( cpu.guest( fdp ) );
+    }
+}
+
+int32_t
+vexFileRead( char *buf, uint32_t size, uint32_t nItems, FIL *fdp ) {
+    FILE *fp = file( fdp );
+    if( fp == nullptr || buf == nullptr )
+      return( 0 );
+    cpu.ptr( cpu.guest( buf ), size * nItems );
+    cpu.written( cpu.guest( buf ), size * nItems );
+    return( (int32_t)fread( buf, size, nItems, fp ) );
+}
+
+int32_t
+vexFileWrite( char *buf, uint32_t size, uint32_t nItems, FIL *fdp ) {
+    FILE *fp = file( fdp );
+    if( fp == nullptr || buf == nullptr )
+      return( 0 );
+    cpu.ptr( cpu.guest( buf ), size * nItems );
+    return( (int32_t)fwrite( buf, size, nItems, fp ) );
+}
+
+int32_t
+vexFileSize( FIL *fdp ) {
+    FILE *fp = file( fdp );
+    if( fp == nullptr )
+      return( 0 );
+    long at = ftell( fp );
+    fseek( fp, 0, SEEK_END );
+    long size = ftell( fp );
+    fseek( fp, at, SEEK_SET );
+    return( (int32_t)size );
+}
+
+FRESULT
+vexFileSeek( FIL *fdp, uint32_t offset, int32_t whence ) {
+    FILE *fp = file( fdp );
+    return( fp != nullptr && fseek( fp, offset, whence ) == 0 ? FR_OK : FR_INVALID_OBJECT );
+}
+
+int32_t
+vexFileTell( FIL *fdp ) {
+    FILE *fp = file( fdp );
+    return( fp == nullptr ? -1 : (int32_t)ftell( fp ) );
+}
+
+void
+vexFileSync( FIL *fdp ) {
+    FILE *fp = file( fdp );
+    if( fp != nullptr )
+      fflush( fp );
+}
+
+uint32_t
+vexFileStatus( const char *filename ) {
+    if( filename == nullptr )
+      return( 0 );
+    std::string path = sdRoot + "/" + filename;
+    FILE *fp = fopen( path.c_str(), "rb" );
+    if( fp != nullptr )
+      fclose( fp );
+    return( fp != nullptr ? 1 : 0 );
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Tasks                                                            */
+/*---------------------------------------------------------------------------*/
+
+struct task {
+    a32::state      s;
+    uint32_t        callback;
+    uint32_t        arg;
+    uint32_t        id;
+    std::string     label;
+    uint64_t        wake;
+    int32_t         priority;
+    bool            started;
+    bool            done;
+    bool            suspended;
+};
+
+static std::vector<task>            tasks;
+static int32_t                      current = -1;     // -1 is the firmware loop
+static uint64_t                     sliceStart;
+static a32::state                   loop;             // the loop while a task runs
+static size_t                       turn;
+static std::map<uint32_t, int32_t>  owners;           // semaphore to task
+static uint32_t                     semaphores;
+
+static void
+add( uint32_t callback, uint32_t arg, uint32_t id, uint32_t label, int32_t priority ) {
+    if( tasks.size() >= MAX_TASKS ) {
+      fprintf( stderr, "v5emu: more than %u tasks\n", MAX_TASKS );
+      cpu.s.r[0] = (uint32_t)-1;
+      return;
+    }
+    const char *name = text( label );
+    task t{};
+    t.callback = callback;
+    t.arg      = arg;
+    t.id       = id;
+    t.label    = name ? name : "";
+    t.priority = priority;
+    t.wake     = now();
+    tasks.push_back( t );
+    cpu.s.r[0] = (uint32_t)( tasks.size() - 1 );
+}
+
+// the task gives up the processor, resume is where it continues
+static void
+leave( uint32_t resume, uint64_t wake ) {
+    task &t = tasks[ current ];
+    t.s       = cpu.s;
+    t.s.r[15] = resume;
+    t.wake    = wake;
+    cpu.s     = loop;
+    current   = -1;
+}
+
+static void
+finish( int32_t index ) {
+    tasks[ index ].done = true;
+    for( auto &o : owners )
+      if( o.second == index )
+        o.second = -1;
+    if( index == current ) {
+      cpu.s   = loop;
+      current = -1;
+    }
+}
+
+static void vexTaskAddService()                 { add( cpu.s.r[0], 0, 0, cpu.s.r[2], 7 ); }
+static void vexTaskAddWithPriorityService()     { add( cpu.s.r[0], 0, 0, cpu.s.r[2], (int32_t)cpu.s.r[3] ); }
+static void vexTaskAddWithArgService()          { add( cpu.s.r[0], cpu.s.r[2], cpu.s.r[2], cpu.s.r[3], 7 ); }
+
+static void
+vexTaskAddWithPriorityWithArgService() {
+    add( cpu.s.r[0], cpu.s.r[2], cpu.s.r[2], cpu.s.r[3], (int32_t)cpu.rd32( cpu.s.r[13] ) );
+}
+
+// called from the firmware loop, returns when the task gives up
+static void
+vexTasksRunService() {
+    size_t live = 0;
+    uint64_t wake = UINT64_MAX;
+    for( const task &t : tasks ) {
+      if( !t.done && !t.suspended ) {
+        live++;
+        wake = std::min( wake, t.wake );
+      }
+    }
+    if( live == 0 || current >= 0 ) {
+      cpu.s.r[0] = live != 0;
+      return;
+    }
+    if( wake > now() )
+      skipped += wake - now();
+
+    for( size_t i=0;i<tasks.size();i++ ) {
+      size_t n = ( turn + i ) % tasks.size();
+      task  &t = tasks[n];
+      if( t.done || t.suspended || t.wake > now() )
+        continue;
+
+      turn       = n + 1;
+      loop       = cpu.s;
+      loop.r[0]  = 1;
+      current    = (int32_t)n;
+      if( !t.started ) {
+        t.started = true;
+        memset( &t.s, 0, sizeof(t.s) );
+        t.s.fpscr  = loop.fpscr;
+        t.s.r[0]   = t.arg;
+        t.s.r[13]  = STACK_BASE + STACK_SIZE * (uint32_t)( n + 1 );
+        t.s.r[14]  = TASK_EXIT;
+        t.s.r[15]  = t.callback;
+      }
+      cpu.s      = t.s;
+      sliceStart = now();
+      return;
+    }
+    cpu.s.r[0] = 1;
+}
+
+static void
+vexTaskSleepService() {
+    uint64_t wake = now() + (uint64_t)cpu.s.r[0] * 1000;
+    if( current >= 0 )
+      leave( cpu.s.r[15], wake );
+    else
+      skipped += (uint64_t)cpu.s.r[0] * 1000;
+}
+
+static void
+vexTaskYieldService() {
+    if( current >= 0 )
+      leave( cpu.s.r[15], now() );
+}
+
+// libv5rt checks before most calls, a task that has used its slice yields
+static void
+vexTaskCheckTimesliceService() {
+    if( current >= 0 && now() - sliceStart >= TIMESLICE )
+      leave( cpu.s.r[15], now() );
+}
+
+static int32_t
+find( uint32_t callback, uint32_t id, bool withId ) {
+    for( size_t i=0;i<tasks.size();i++ )
+      if( !tasks[i].done && tasks[i].callback == callback && ( !withId || tasks[i].id == id ) )
+        return (int32_t)i;
+    return -1;
+}
+
+static void
+stop( bool withId ) {
+    int32_t i = find( cpu.s.r[0], cpu.s.r[1], withId );
+    if( i >= 0 )
+      finish( i );
+}
+
+static void
+suspend( bool withId, bool state ) {
+    int32_t i = find( cpu.s.r[0], cpu.s.r[1], withId );
+    if( i < 0 )
+      return;
+    tasks[i].suspended = state;
+    if( state && i == current )
+      leave( cpu.s.r[15], now() );
+}
+
+static void vexTaskStopService()            { stop( false ); }
+static void vexTaskStopWithIdService()      { stop( true ); }
+static void vexTaskSuspendService()         { suspend( false, true ); }
+static void vexTaskSuspendWithIdService()   { suspend( true, true ); }
+static void vexTaskResumeService()          { suspend( false, false ); }
+static void vexTaskResumeWithIdService()    { suspend( true, false ); }
+static void vexTaskGetIndexService()        { cpu.s.r[0] = (uint32_t)current; }
+static void vexTaskGetTaskIndexService()    { cpu.s.r[0] = (uint32_t)find( cpu.s.r[0], 0, false ); }
+static void vexTaskGetTaskIndexWithIdService() { cpu.s.r[0] = (uint32_t)find( cpu.s.r[0], cpu.s.r[1], true ); }
+static void vexTaskStateGetService()        { cpu.s.r[0] = find( cpu.s.r[0], 0, false ) >= 0; }
+static void vexTaskStateGetWithIdService()  { cpu.s.r[0] = find( cpu.s.r[0], cpu.s.r[1], true ) >= 0; }
+static void vexTaskHardwareConcurrencyService() { cpu.s.r[0] = 1; }
+
+static void
+vexTaskStopAllService() {
+    for( size_t i=0;i<tasks.size();i++ )
+      if( !tasks[i].done )
+        finish( (int32_t)i );
+}
+
+static void
+taskExit() {
+    finish( current );
+}
+
+static void
+vexSemaphoreInitService() {
+    owners[ ++semaphores ] = -1;
+    cpu.s.r[0] = semaphores;
+}
+
+// a task that finds the semaphore taken sleeps and calls again
+static void
+vexSemaphoreLockService() {
+    auto o = owners.find( cpu.s.r[0] );
+    if( o == owners.end() || o->second == -1 || o->second == current || current < 0 ) {
+      owners[ cpu.s.r[0] ] = current;
+      cpu.s.r[0] = 1;
+      return;
+    }
+    leave( TRAP_BASE + vex::offsets::vexSemaphoreLock, now() + 1000 );
+}
+
+static void
+vexSemaphoreUnlockService() {
+    owners[ cpu.s.r[0] ] = -1;
+    cpu.s.r[0] = 1;
+}
+
+static void
+vexSemaphoreGetOwnerService() {
+    auto o = owners.find( cpu.s.r[0] );
+    cpu.s.r[0] = o == owners.end() ? (uint32_t)-1 : (uint32_t)o->second;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  System                                                           */
+/*---------------------------------------------------------------------------*/
+
+static void
+vexSystemExitRequestService() {
+    halted     = true;
+    haltReason = "exit requested";
+}
+
+// a program linked against another stdlib takes its version and starts again
+static void
+vexStdlibMismatchErrorService() {
+    fprintf( stderr, "v5emu: program stdlib 0x%08X, using it in place of 0x%08X\n", cpu.s.r[1], cpu.s.r[0] );
+    cpu.wr32( VERSION_BASE + 4, cpu.s.r[1] );
+    cpu.s = reset;
+}
+
+static void quiet() { cpu.s.r[0] = 0; }
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Slot table                                                       */
+/*---------------------------------------------------------------------------*/
+
+struct binding {
+    void      (*fn)();
+    const char *name;
+    uint64_t    calls;
+    bool        reported;
+};
+
+static binding                          slots[0x400];
+static std::map<uint32_t, std::string>  names;
+
+#define BIND( fn )        slots[ vex::offsets::fn / 4 ] = { service<decltype(&fn), &fn>::call, #fn, 0, false }
+#define BIND_AS( fn, s )  slots[ vex::offsets::fn / 4 ] = { s, #fn, 0, false }
+
+static void
+bind() {
+    BIND( vexSystemTimeGet );
+    BIND( vexSystemHighResTimeGet );
+    BIND( vexSystemPowerupTimeGet );
+    BIND( vexDevicesGetNumber );
+    BIND( vexDevicesGet );
+    BIND( vexDeviceGetByIndex );
+    BIND( vexDeviceGetStatus );
+    BIND( vexDeviceGetTimestamp );
+    BIND( vexControllerGet );
+    BIND( vexControllerConnectionStatusGet );
+    BIND( vexCompetitionStatus );
+    BIND( vexFileMountSD );
+    BIND( vexFileDriveStatus );
+    BIND( vexFileOpen );
+    BIND( vexFileOpenWrite );
+    BIND( vexFileOpenCreate );
+    BIND( vexFileClose );
+    BIND( vexFileRead );
+    BIND( vexFileWrite );
+    BIND( vexFileSize );
+    BIND( vexFileSeek );
+    BIND( vexFileTell );
+    BIND( vexFileSync );
+    BIND( vexFileStatus );
+
+    // these slots take a va_list, libv5rt's vex_vsnprintf uses 0x0F8
+    BIND_AS( vex_printf,                  vprintfService );
+    BIND_AS( vex_vsprintf,                vsprintfService );
+    BIND_AS( vex_snprintf,                vsnprintfService );
+    BIND_AS( vexDisplayVPrintf,           displayPrintfService );
+    BIND_AS( vexDisplayVString,           displayLineService );
+    BIND_AS( vexDisplayVStringAt,         displayAtService );
+    BIND_AS( vexDisplayVBigString,        displayLineService );
+    BIND_AS( vexDisplayVBigStringAt,      displayAtService );
+    BIND_AS( vexDisplayVCenteredString,   displayLineService );
+    BIND_AS( vexDisplayVBigCenteredString, displayLineService );
+    BIND_AS( vexDisplayVSmallStringAt,    displayAtService );
+
+    BIND_AS( vexTaskAdd,                  vexTaskAddService );
+    BIND_AS( vexTaskAddWithPriority,      vexTaskAddWithPriorityService );
+    BIND_AS( vexTaskAddWithArg,           vexTaskAddWithArgService );
+    BIND_AS( vexTaskAddWithPriorityWithArg, vexTaskAddWithPriorityWithArgService );
+    BIND_AS( vexTasksRun,                 vexTasksRunService );
+    BIND_AS( vexTaskSleep,                vexTaskSleepService );
+    BIND_AS( vexTaskYield,                vexTaskYieldService );
+    BIND_AS( vexTaskCheckTimeslice,       vexTaskCheckTimesliceService );
+    BIND_AS( vexTaskStop,                 vexTaskStopService );
+    BIND_AS( vexTaskStopWithId,           vexTaskStopWithIdService );
+    BIND_AS( vexTaskSuspend,              vexTaskSuspendService );
+    BIND_AS( vexTaskSuspendWithId,        vexTaskSuspendWithIdService );
+    BIND_AS( vexTaskResume,               vexTaskResumeService );
+    BIND_AS( vexTaskResumeWithId,         vexTaskResumeWithIdService );
+    BIND_AS( vexTaskGetIndex,             vexTaskGetIndexService );
+    BIND_AS( vexTaskGetTaskIndex,         vexTaskGetTaskIndexService );
+    BIND_AS( vexTaskGetTaskIndexWithId,   vexTaskGetTaskIndexWithIdService );
+    BIND_AS( vexTaskStateGet,             vexTaskStateGetService );
+    BIND_AS( vexTaskStateGetWithId,       vexTaskStateGetWithIdService );
+    BIND_AS( vexTaskHardwareConcurrency,  vexTaskHardwareConcurrencyService );
+    BIND_AS( vexTaskStopAll,              vexTaskStopAllService );
+    BIND_AS( vexTaskStopAllUser,          vexTaskStopAllService );
+    BIND_AS( vexTaskRemoveAllUser,        vexTaskStopAllService );
+    BIND_AS( vexSemaphoreInit,            vexSemaphoreInitService );
+    BIND_AS( vexSemaphoreLock,            vexSemaphoreLockService );
+    BIND_AS( vexSemaphoreUnlock,          vexSemaphoreUnlockService );
+    BIND_AS( vexSemaphoreGetOwner,        vexSemaphoreGetOwnerService );
+
+    BIND_AS( vexSystemExitRequest,        vexSystemExitRequestService );
+    BIND_AS( vexStdlibMismatchError,      vexStdlibMismatchErrorService );
+
+    // nothing to do on the host
+    BIND_AS( vexTasksDump,                quiet );
+    BIND_AS( vexTaskCompletionIdSet,      quiet );
+    BIND_AS( vexPrivateApiEnable,         quiet );
+    BIND_AS( vexPrivateApiDisable,        quiet );
+}
+
+#undef  BIND
+#undef  BIND_AS
+
+static void
+call( uint32_t offset ) {
+    binding &b = slots[ offset / 4 ];
+    b.calls++;
+    cpu.s.r[15] = cpu.s.r[14];
+    if( b.fn != nullptr ) {
+      b.fn();
+      return;
+    }
+    if( !b.reported ) {
+      auto n = names.find( offset );
+      fprintf( stderr, "v5emu: 0x%03X %s not implemented, returns 0\n", offset,
+               n == names.end() ? "?" : n->second.c_str() );
+      b.reported = true;
+    }
+    cpu.s.r[0] = 0;
+    cpu.s.r[1] = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/** @brief  Loader                                                           */
+/*---------------------------------------------------------------------------*/
+
+static bool
+loadProgram( const char *name, uint32_t &entry ) {
+    fw::mapping map;
+    if( !map.open( name ) )
+      return false;
+    const uint8_t *p = map.data;
+
+    if( map.size >= 52 && memcmp( p, "\x7f" "ELF\x01\x01", 6 ) == 0 ) {
+      uint32_t phoff = fw::word( p + 28 );
+      uint16_t phnum = fw::half( p + 44 );
+      for( int i=0;i<phnum;i++ ) {
+        const uint8_t *ph = p + phoff + i * 32;
+        if( phoff + ( i + 1 ) * 32 > map.size || fw::word( ph ) != 1 )          // PT_LOAD
+          continue;
+        uint32_t offset = fw::word( ph + 4 ), paddr = fw::word( ph + 12 );
+        uint32_t filesz = fw::word( ph + 16 ), memsz = fw::word( ph + 20 );
+        if( !cpu.inside( paddr, memsz ) || offset + filesz > map.size ) {
+          fprintf( stderr, "%s: segment at 0x%08X does not fit\n", name, paddr );
+          return false;
+        }
+        memcpy( cpu.ptr( paddr, memsz ), p + offset, filesz );
+      }
+      entry = fw::word( p + 24 ) ? fw::word( p + 24 ) : USER_ENTRY;
+    }
+    else {
+      if( !cpu.inside( USER_BASE, (uint32_t)map.size ) ) {
+        fprintf( stderr, "%s: too large\n", name );
+        return false;
+      }
+      memcpy( cpu.ptr( USER_BASE, (uint32_t)map.size ), p, map.size );
+      entry = USER_ENTRY;
+    }
+    return true;
+}
+
+int
+main( int argc, char **argv ) {
+    const char *offsetsFile = nullptr;
+    const char *program     = nullptr;
+    uint64_t    limit       = 60000;
+    bool        stats       = false;
+
+    for( int i=1;i<argc;i++ ) {
+      if( strcmp( argv[i], "--offsets" ) == 0 && i + 1 < argc )
+        offsetsFile = argv[++i];
+      else if( strcmp( argv[i], "--ms" ) == 0 && i + 1 < argc )
+        limit = strtoull( argv[++i], nullptr, 0 );
+      else if( strcmp( argv[i], "--competition" ) == 0 && i + 1 < argc )
+        competition = (uint32_t)strtoul( argv[++i], nullptr, 0 );
+      else if( strcmp( argv[i], "--sd" ) == 0 && i + 1 < argc )
+        sdRoot = argv[++i];
+      else if( strcmp( argv[i], "--stats" ) == 0 )
+        stats = true;
+      else if( argv[i][0] == '-' || program != nullptr ) {
+        fprintf( stderr, "unknown option %s\n", argv[i] );
+        return 2;
+      }
+      else
+        program = argv[i];
+    }
+    if( program == nullptr || cpu.mem == nullptr ) {
+      fprintf( stderr, "usage: v5emu [--offsets firmware_offsets.txt] [--ms 60000] [--competition n] [--sd dir] [--stats] program\n" );
+      return 2;
+    }
+
+    if( offsetsFile != nullptr ) {
+      std::map<std::string, uint32_t> offsets;
+      if( !fw::readOffsets( offsetsFile, offsets ) )
+        return 2;
+      for( auto &o : offsets )
+        names.emplace( o.second, o.first );
+    }
+
+    uint32_t entry;
+    if( !loadProgram( program, entry ) )
+      return 2;
+
+    for( uint32_t o=0;o<0x1000;o+=4 )
+      cpu.wr32( vex::offsets::TABLE_BASE + o, TRAP_BASE + o );
+    cpu.wr32( VERSION_BASE, SYSTEM_VERSION );
+    cpu.wr32( VERSION_BASE + 8, SYSTEM_VERSION );
+    devices = (uint8_t *)hostAlloc( V5_MAX_DEVICE_PORTS );
+    bind();
+
+    cpu.s.r[13] = LOOP_STACK;
+    cpu.s.r[14] = HALT;
+    cpu.s.r[15] = entry;
+    cpu.s.fpscr = 0x03000000;                  // default NaN, flush to zero
+    reset = cpu.s;
+
+    auto start = std::chrono::steady_clock::now();
+    int  status = 0;
+    try {
+      while( !halted ) {
+        uint32_t pc = cpu.run( SLICE );
+        if( pc - TRAP_BASE < 0x1000 )
+          call( pc - TRAP_BASE );
+        else if( pc == HALT ) {
+          halted     = true;
+          haltReason = "returned from vexStartup";
+        }
+        else if( pc == TASK_EXIT )
+          taskExit();
+        else if( !cpu.inside( pc, 4 ) )
+          throw a32::fault{ pc, pc, "jump outside guest memory" };
+        if( !halted && now() / 1000 >= limit ) {
+          halted     = true;
+          haltReason = "time limit";
+        }
+      }
+    }
+    catch( const a32::fault &f ) {
+      fprintf( stderr, "v5emu: %s at 0x%08X, address 0x%08X, task %d\n", f.what, f.pc, f.address, current );
+      for( int i=0;i<16;i+=4 )
+        fprintf( stderr, "  r%-2d %08X  r%-2d %08X  r%-2d %08X  r%-2d %08X\n",
+                 i, cpu.s.r[i], i + 1, cpu.s.r[i + 1], i + 2, cpu.s.r[i + 2], i + 3, cpu.s.r[i + 3] );
+      haltReason = "fault";
+      status     = 1;
+    }
+    fflush( stdout );
+
+    double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    fprintf( stderr, "v5emu: %s after %llu mS, %llu instructions in %.3f S, %.0f MIPS\n", haltReason,
+             (unsigned long long)( now() / 1000 ), (unsigned long long)cpu.instructions, seconds,
+             seconds > 0 ? cpu.instructions / seconds / 1e6 : 0 );
+
+    if( stats ) {
+      uint64_t moves = cpu.lookups + cpu.chained;
+      fprintf( stderr, "  %llu blocks decoded, %llu flushes, %.1f%% of block changes chained\n",
+               (unsigned long long)cpu.blocks, (unsigned long long)cpu.flushes,
+               moves ? 100.0 * cpu.chained / moves : 0 );
+      std::vector<const binding *> used;
+      for( const binding &b : slots )
+        if( b.calls )
+          used.push_back( &b );
+      std::sort( used.begin(), used.end(), []( const binding *a, const binding *b ) { return a->calls > b->calls; } );
+      for( const binding *b : used ) {
+        auto n = names.find( (uint32_t)( b - slots ) * 4 );
+        fprintf( stderr, "  %10llu  %s\n", (unsigned long long)b->calls,
+                 b->name ? b->name : n != names.end() ? n->second.c_str() : "?" );
+      }
+    }
+    return status;
+}